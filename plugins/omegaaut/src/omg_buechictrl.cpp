@@ -282,6 +282,92 @@ bool ControlledBuechiLiveness(
 */
 
 
+// ControlledBuechiLiveness(...), variant on bit vectors
+// (literal transscript of the reference implementation below, with all
+// iterates represented as DenseStateSet and the mu/nu loops unwound by
+// DenseFixpoint())
+static void ControlledBuechiLivenessDense(
+  Generator& rSupCandGen, 
+  const EventSet& rCAlph,
+  const StateSet& rPlantMarking,
+  Idx maxidx) 
+{
+  // declare iterate sets
+  DenseStateSet resolved(maxidx), initialK(maxidx), targetLstar(maxidx);
+  DenseStateSet initialL(maxidx), targetL(maxidx);
+  DenseStateSet domainL(maxidx), target1(maxidx);
+  DenseStateSet target(maxidx), domain(maxidx), theta(maxidx);
+
+  // convenience
+  DenseStateSet full(rSupCandGen.States(),maxidx);
+  DenseStateSet markedK(rSupCandGen.MarkedStates(),maxidx);
+  DenseStateSet markedL(rPlantMarking,maxidx);
+  TransSet::ConstView trans(rSupCandGen.TransRel());
+  Idx fsz=full.Size();
+
+  // evaluate mu(resolved).nu(initialK)[ p(initialK * markedK + resolved )) ];
+  DenseFixpoint(resolved,fsz,[&]{
+    initialK = full;
+    DenseFixpoint(initialK,0,[&]{
+      // targetLstar = initialK * markedK + resolved 
+      targetLstar = initialK;
+      targetLstar &= markedK;
+      targetLstar |= resolved;
+      FD_DF("ControlledBuechiLiveness(): [DNS] iterate resolved/targetLstar #" << resolved.Size() << "/" << targetLstar.Size());
+      // evaluate p(targetLstar) = mu(initialL).[ thetaTilde(targetLstar+initialL) ] 
+      initialL.Clear();
+      DenseFixpoint(initialL,fsz,[&]{
+        targetL = targetLstar;
+        targetL |= initialL;
+        // evaluate thetaTilde(targetL)=nu(domainL).mu(target1)[ theta(targetL+(target1-markL), domainL-markL) ];
+        domainL = full;
+        DenseFixpoint(domainL,0,[&]{
+          FD_WPC(1,2,"ControlledBuechiLiveness(): [DNS] iterating reverse dynamics"); 
+          domain = domainL;
+          domain.AndNot(markedL);
+          // evaluate mu(target1)[ theta(targetL+(target1-markL), domain) ];
+          target1.Clear();
+          DenseFixpoint(target1,fsz,[&]{
+            target = target1;
+            target.AndNot(markedL);
+            target |= targetL;
+            // evaluate theta(target,domain) 
+            theta.Clear();
+            for(Idx q=full.First(); q!=0; q=full.Next(q)) {
+              bool pass = false;
+              bool fail = false;      
+              TransSet::ConstView::Iterator tit = trans.Begin(q);
+              TransSet::ConstView::Iterator tit_end = trans.End(q);
+              for(;tit!=tit_end; ++tit) {
+                if(target.Exists(tit->X2)) {pass = true; continue;}
+                if(domain.Exists(tit->X2)) {continue;}
+                if(!rCAlph.Exists(tit->Ev)){ fail = true; break;}
+              }
+              if(pass && !fail) theta.Insert(q);
+            } // end: theta   
+            // mu-loop on target1
+            target1 |= theta;
+          }); // end: mu
+          // nu-loop on domainL
+          domainL &= target1;
+        }); // end: nu
+        // mu-loop on initialL
+        initialL |= domainL;
+      }); // end: mu
+      // nu-loop on initialK
+      initialK &= initialL;
+    }); // end: nu
+    // mu-loop on resolved
+    resolved |= initialK;
+  }); // end: mu
+ 
+  // restrict candidate to resolved states
+  full.AndNot(resolved);
+  StateSet unresolved;
+  full.ToStateSet(unresolved);
+  rSupCandGen.DelStates(unresolved);
+}
+
 /*
 This implementation is a direct transscript of the mu-calculus formulas stated in "Control of 
 w-Automata, Church's Problem, and the Emptiness Problem for Tree w-Automata", by J. Thistle and 
@@ -302,6 +388,15 @@ bool ControlledBuechiLiveness(
 	
   FD_DF("ControlledBuechiLiveness()");
 
+  // use bit vectors when state indices are dense
+  if(!rSupCandGen.States().Empty()) {
+    Idx maxidx = *(--rSupCandGen.StatesEnd());
+    if(DenseStateSet::Suitable(maxidx,rSupCandGen.Size())) {
+      ControlledBuechiLivenessDense(rSupCandGen,rCAlph,rPlantMarking,maxidx);
+      return true;
+    }
+  }
+
   // declare iterate sets
   StateSet resolved, initialK, targetLstar;
   StateSet initialL, targetL;
@@ -310,6 +405,7 @@ bool ControlledBuechiLiveness(
  
   // convenience
   const StateSet& full = rSupCandGen.States();
+  TransSet::ConstView trans(rSupCandGen.TransRel());
   Idx fsz=full.Size();
 
   // evaluate mu(resolved).nu(initialK)[ p(initialK * markedK + resolved )) ];
@@ -371,8 +467,8 @@ bool ControlledBuechiLiveness(
             for(;sit!=sit_end;++sit) {
               bool pass = false;
               bool fail = false;      
-              TransSet::Iterator tit = rSupCandGen.TransRelBegin(*sit);
-              TransSet::Iterator tit_end = rSupCandGen.TransRelEnd(*sit);
+              TransSet::ConstView::Iterator tit = trans.Begin(*sit);
+              TransSet::ConstView::Iterator tit_end = trans.End(*sit);
               for(;tit!=tit_end; ++tit) {
                 if(target.Exists(tit->X2)) {pass = true; continue;}
                 if(domain.Exists(tit->X2)) {continue;}
@@ -913,7 +1009,10 @@ void SupBuechiConProduct(
   OPSState currentp, nextp;
   // current/next state as target index
   Idx currentt, nextt;  
-  TransSet::Iterator ptit, ptit_end, stit, stit_end;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView ptrans(rPlantGen.TransRel());
+  TransSet::ConstView strans(rSpecGen.TransRel());
+  TransSet::ConstView::Iterator ptit, ptit_end, stit, stit_end;
   std::map< OPSState, Idx>::iterator rcit;
   // critical states
   StateSet critical;
@@ -945,10 +1044,10 @@ void SupBuechiConProduct(
     FD_DF("SupBuechiConProduct: processing (" << currentp.Str() << " -> " << currentt <<")");
 
     // iterate over transitions, pass1: figure whether current state becomes critical (tmoor 201308)
-    ptit = rPlantGen.TransRelBegin(currentp.q1);
-    ptit_end = rPlantGen.TransRelEnd(currentp.q1);
-    stit = rSpecGen.TransRelBegin(currentp.q2);
-    stit_end = rSpecGen.TransRelEnd(currentp.q2);
+    ptit = ptrans.Begin(currentp.q1);
+    ptit_end = ptrans.End(currentp.q1);
+    stit = strans.Begin(currentp.q2);
+    stit_end = strans.End(currentp.q2);
     disable.Clear();
     // process all transitions and increment iterators strategically
     while((ptit != ptit_end) && (stit != stit_end)) {
@@ -1028,10 +1127,10 @@ void SupBuechiConProduct(
 
     // iterate over transitions, pass2: execute shared events (tmoor 201308)
     FD_DF("SupBuechiConProduct(): processing pass2"); 
-    ptit = rPlantGen.TransRelBegin(currentp.q1);
-    ptit_end = rPlantGen.TransRelEnd(currentp.q1);
-    stit = rSpecGen.TransRelBegin(currentp.q2);
-    stit_end = rSpecGen.TransRelEnd(currentp.q2);
+    ptit = ptrans.Begin(currentp.q1);
+    ptit_end = ptrans.End(currentp.q1);
+    stit = strans.Begin(currentp.q2);
+    stit_end = strans.End(currentp.q2);
     // process all transitions and increment iterators strategically
     while((ptit != ptit_end) && (stit != stit_end)) {
       FD_DF("SupBuechiConProduct: current plant-transition: " << rPlantGen.TStr(*ptit) );
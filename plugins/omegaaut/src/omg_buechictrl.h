@@ -94,6 +94,34 @@ extern FAUDES_API bool IsBuechiControllable(
 
 
 
+/**
+ * Controlled liveness w.r.t. Buechi acceptance
+ *
+ * Restricts the supervisor candidate H to those states from which the 
+ * plant marking can be attained infinitely often by the means of control. 
+ * This is the outer iteration step of SupBuechiCon and implemented
+ * as a literal transscript of the mu-calculus formulas stated by 
+ * Thistle/Wonham, 1992, for the special case of deterministic Buechi 
+ * automata. When the state indices of H are (almost) contiguous, the 
+ * iterates are represented as bit vectors.
+ *
+ * @param rSupCandGen
+ *   Supervisor candidate H, states are removed in-place
+ * @param rCAlph
+ *   Controllable events
+ * @param rPlantMarking
+ *   States of H that correspond to marked plant states
+ *
+ * @return 
+ *   true
+ *
+ * @ingroup OmgPlugin
+ */
+extern FAUDES_API bool ControlledBuechiLiveness(
+  Generator& rSupCandGen, 
+  const EventSet& rCAlph,
+  const StateSet& rPlantMarking);
+
 
 /**
  * Omega-synthesis w.r.t. Buechi acceptance condition
@@ -190,7 +190,10 @@ void BuechiProduct(
   // state
   Idx tmpstate;  
   StateSet::Iterator lit1, lit2;
-  TransSet::Iterator tit1, tit1_end, tit2, tit2_end;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView trans1(rGen1.TransRel());
+  TransSet::ConstView trans2(rGen2.TransRel());
+  TransSet::ConstView::Iterator tit1, tit1_end, tit2, tit2_end;
   std::map< OPState, Idx>::iterator rcit;
   // push all combinations of initial states on todo stack
   FD_DF("BuechiProduct: adding all combinations of initial states to todo:");
@@ -213,12 +216,12 @@ void BuechiProduct(
     todo.pop();
     FD_DF("BuechiProduct: processing (" << currentstates.Str() << " -> " << reverseCompositionMap[currentstates]);
     // iterate over all rGen1 transitions  
-    tit1 = rGen1.TransRelBegin(currentstates.q1);
-    tit1_end = rGen1.TransRelEnd(currentstates.q1);
+    tit1 = trans1.Begin(currentstates.q1);
+    tit1_end = trans1.End(currentstates.q1);
     for(; tit1 != tit1_end; ++tit1) {
       // find transition in rGen2
-      tit2 = rGen2.TransRelBegin(currentstates.q2, tit1->Ev);
-      tit2_end = rGen2.TransRelEnd(currentstates.q2, tit1->Ev);
+      tit2 = trans2.Begin(currentstates.q2, tit1->Ev);
+      tit2_end = trans2.End(currentstates.q2, tit1->Ev);
       for (; tit2 != tit2_end; ++tit2) {
         newstates = OPState(tit1->X2, tit2->X2,currentstates.m1required);
         // figure whether marking was resolved
@@ -343,7 +346,10 @@ void BuechiParallel(
   // state
   Idx tmpstate;  
   StateSet::Iterator lit1, lit2;
-  TransSet::Iterator tit1, tit1_end, tit2, tit2_end;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView trans1(rGen1.TransRel());
+  TransSet::ConstView trans2(rGen2.TransRel());
+  TransSet::ConstView::Iterator tit1, tit1_end, tit2, tit2_end;
   std::map< OPState, Idx>::iterator rcit;
   // push all combinations of initial states on todo stack
   FD_DF("BuechiParallel: adding all combinations of initial states to todo:");
@@ -373,8 +379,8 @@ void BuechiParallel(
         << reverseCompositionMap[currentstates]);
     // iterate over all rGen1 transitions 
     // (includes execution of shared events)
-    tit1 = rGen1.TransRelBegin(currentstates.q1);
-    tit1_end = rGen1.TransRelEnd(currentstates.q1);
+    tit1 = trans1.Begin(currentstates.q1);
+    tit1_end = trans1.End(currentstates.q1);
     for(; tit1 != tit1_end; ++tit1) {
       // if event not shared
       if(! sharedalphabet.Exists(tit1->Ev)) {
@@ -411,8 +417,8 @@ void BuechiParallel(
       else {
         FD_DF("BuechiParallel:   common event");
         // find shared transitions
-        tit2 = rGen2.TransRelBegin(currentstates.q2, tit1->Ev);
-        tit2_end = rGen2.TransRelEnd(currentstates.q2, tit1->Ev);
+        tit2 = trans2.Begin(currentstates.q2, tit1->Ev);
+        tit2_end = trans2.End(currentstates.q2, tit1->Ev);
         for (; tit2 != tit2_end; ++tit2) {
           newstates = OPState(tit1->X2,tit2->X2,currentstates.m1required);
           // figure whether marking was resolved
@@ -450,8 +456,8 @@ void BuechiParallel(
     }
     // iterate over all remaining rGen2 transitions 
     // (without execution of shared events)
-    tit2 = rGen2.TransRelBegin(currentstates.q2);
-    tit2_end = rGen2.TransRelEnd(currentstates.q2);
+    tit2 = trans2.Begin(currentstates.q2);
+    tit2_end = trans2.End(currentstates.q2);
     for (; tit2 != tit2_end; ++tit2) {
       if (! sharedalphabet.Exists(tit2->Ev)) {
         FD_DF("BuechiParallel:   exists only in rGen2: " << sharedalphabet.Str(tit2->Ev));
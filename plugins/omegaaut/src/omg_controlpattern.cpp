@@ -241,6 +241,9 @@ RabinAutomaton ControlPatternGenerator::ExpandToControlPatterns(
     
     // Create mapping from original events to expanded events
     std::map<Idx, std::vector<Idx>> eventMapping;
+
+    // Dense table of original event flags
+    EventFlagTable flags = rGen.EventFlags();
     
     // Build expanded alphabet using original event names
     EventSet::Iterator eventIt;
@@ -266,19 +269,19 @@ RabinAutomaton ControlPatternGenerator::ExpandToControlPatterns(
                 // Insert into rRes alphabet
                 Idx expandedEvent = rRes.InsEvent(expandedEventName);
                 
-                // Copy controllability attributes
+                // Copy controllability attributes and observability from original event
+                AttributeCFlags attr = rRes.EventAttribute(expandedEvent);
                 if (actualControllableEvents.Exists(originalEvent)) {
-                    rRes.SetControllable(expandedEvent);
+                    attr.SetControllable();
                 } else {
-                    rRes.ClrControllable(expandedEvent);
+                    attr.ClrControllable();
                 }
-                
-                // Copy observability from original event
-                if (rGen.Observable(originalEvent)) {
-                    rRes.SetObservable(expandedEvent);
+                if (flags.Observable(originalEvent)) {
+                    attr.SetObservable();
                 } else {
-                    rRes.ClrObservable(expandedEvent);
+                    attr.ClrObservable();
                 }
+                rRes.EventAttribute(expandedEvent, attr);
                 
                 // Add to mapping
                 eventMapping[originalEvent].push_back(expandedEvent);
@@ -381,76 +384,16 @@ void RabinProduct(const RabinAutomaton& rGen1, const RabinAutomaton& rGen2, Rabi
     // 1. Construct alphabet intersection
     EventSet intersectAlphabet = rGen1.Alphabet() * rGen2.Alphabet();
     
-    // 2. Create alphabet with attributes - inherit ALL event properties
-    EventSet::Iterator evit;
-    for(evit = intersectAlphabet.Begin(); evit != intersectAlphabet.End(); ++evit) {
-        Idx event = *evit;
-        
-        // Get event name first
-        std::string eventName;
-        if(rGen1.ExistsEvent(event)) {
-            eventName = rGen1.EventName(event);
-        } else if(rGen2.ExistsEvent(event)) {
-            eventName = rGen2.EventName(event);
-        }
-        
-        // Insert event with name
-        rRes.InsEvent(event);
-        if(!eventName.empty()) {
-            rRes.EventName(event, eventName);
-        }
-        
-        // Inherit controllability (from the automaton that has this event)
-        bool isControllable = false;
-        if(rGen1.ExistsEvent(event) && rGen1.Controllable(event)) {
-            isControllable = true;
-        }
-        if(rGen2.ExistsEvent(event) && rGen2.Controllable(event)) {
-            isControllable = true;
-        }
-        
-        if(isControllable) {
-            rRes.SetControllable(event);
-        } else {
-            rRes.ClrControllable(event);
-        }
-        
-        // Inherit observability (from the automaton that has this event)
-        bool isObservable = true;  // Default to observable
-        if(rGen1.ExistsEvent(event)) {
-            isObservable = rGen1.Observable(event);
-        } else if(rGen2.ExistsEvent(event)) {
-            isObservable = rGen2.Observable(event);
-        }
-        
-        if(isObservable) {
-            rRes.SetObservable(event);
-        } else {
-            rRes.ClrObservable(event);
-        }
-        
-        // Inherit forcibility (from the automaton that has this event)
-        bool isForcible = false;  // Default to not forcible
-        if(rGen1.ExistsEvent(event)) {
-            isForcible = rGen1.Forcible(event);
-        } else if(rGen2.ExistsEvent(event)) {
-            isForcible = rGen2.Forcible(event);
-        }
-        
-        if(isForcible) {
-            rRes.SetForcible(event);
-        } else {
-            rRes.ClrForcible(event);
-        }
-    }
-    
-    // 3-5. Construct states, transitions etc. (unchanged)
+    // 2. Construct states, transitions etc. in append-only buffers
+    GeneratorBuilder builder;
+    builder.InsEvents(intersectAlphabet);
     std::map<std::pair<Idx, Idx>, Idx> stateMap;
     StateSet::Iterator sit1, sit2;
     for(sit1 = rGen1.StatesBegin(); sit1 != rGen1.StatesEnd(); ++sit1) {
         for(sit2 = rGen2.StatesBegin(); sit2 != rGen2.StatesEnd(); ++sit2) {
             std::string stateName = rGen1.StateName(*sit1) + "|" + rGen2.StateName(*sit2);
-            Idx newState = rRes.InsState(stateName);
+            Idx newState = builder.InsState();
+            builder.StateName(newState, stateName);
             stateMap[std::make_pair(*sit1, *sit2)] = newState;
         }
     }
@@ -458,14 +401,14 @@ void RabinProduct(const RabinAutomaton& rGen1, const RabinAutomaton& rGen2, Rabi
     StateSet::Iterator init1, init2;
     for(init1 = rGen1.InitStatesBegin(); init1 != rGen1.InitStatesEnd(); ++init1) {
         for(init2 = rGen2.InitStatesBegin(); init2 != rGen2.InitStatesEnd(); ++init2) {
-            rRes.SetInitState(stateMap[std::make_pair(*init1, *init2)]);
+            builder.SetInitState(stateMap[std::make_pair(*init1, *init2)]);
         }
     }
     
     StateSet::Iterator marked1, marked2;
     for(marked1 = rGen1.MarkedStatesBegin(); marked1 != rGen1.MarkedStatesEnd(); ++marked1) {
         for(marked2 = rGen2.MarkedStatesBegin(); marked2 != rGen2.MarkedStatesEnd(); ++marked2) {
-            rRes.SetMarkedState(stateMap[std::make_pair(*marked1, *marked2)]);
+            builder.SetMarkedState(stateMap[std::make_pair(*marked1, *marked2)]);
         }
     }
     
@@ -475,12 +418,49 @@ void RabinProduct(const RabinAutomaton& rGen1, const RabinAutomaton& rGen2, Rabi
             if(tit1->Ev == tit2->Ev && intersectAlphabet.Exists(tit1->Ev)) {
                 Idx srcState = stateMap[std::make_pair(tit1->X1, tit2->X1)];
                 Idx dstState = stateMap[std::make_pair(tit1->X2, tit2->X2)];
-                rRes.SetTransition(srcState, tit1->Ev, dstState);
+                builder.SetTransition(srcState, tit1->Ev, dstState);
             }
         }
     }
     
-    // 6. Construct Rabin acceptance condition - ensure at least one empty pair to start the loop
+    builder.Finalize(rRes);
+    
+    // 3. Set up alphabet with attributes - inherit ALL event properties
+    EventFlagTable flags1 = rGen1.EventFlags();
+    EventFlagTable flags2 = rGen2.EventFlags();
+    EventSet::Iterator evit;
+    for(evit = intersectAlphabet.Begin(); evit != intersectAlphabet.End(); ++evit) {
+        Idx event = *evit;
+        
+        // Get event name first
+        std::string eventName;
+        if(rGen1.ExistsEvent(event)) {
+            eventName = rGen1.EventName(event);
+        } else if(rGen2.ExistsEvent(event)) {
+            eventName = rGen2.EventName(event);
+        }
+        
+        // Insert event with name
+        rRes.InsEvent(event);
+        if(!eventName.empty()) {
+            rRes.EventName(event, eventName);
+        }
+        
+        // Inherit controllability, observability and forcibility (dense flag tables)
+        AttributeCFlags attr;
+        if(flags1.Controllable(event) || flags2.Controllable(event)) attr.SetControllable();
+        else attr.ClrControllable();
+        bool isObservable = flags1.Exists(event) ? flags1.Observable(event) :
+          (flags2.Exists(event) ? flags2.Observable(event) : true);
+        if(isObservable) attr.SetObservable();
+        else attr.ClrObservable();
+        bool isForcible = flags1.Exists(event) ? flags1.Forcible(event) : flags2.Forcible(event);
+        if(isForcible) attr.SetForcible();
+        else attr.ClrForcible();
+        rRes.EventAttribute(event, attr);
+    }
+    
+    // 4. Construct Rabin acceptance condition - ensure at least one empty pair to start the loop
     RabinAcceptance productAcc;
     RabinAcceptance acc1 = rGen1.RabinAcceptance();
     RabinAcceptance acc2 = rGen2.RabinAcceptance();
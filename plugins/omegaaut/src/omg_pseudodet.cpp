@@ -157,6 +157,10 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
     
     // Copy alphabet
     rRes.InjectAlphabet(rGen.Alphabet());
+
+    // Record result in append-only buffers
+    GeneratorBuilder builder;
+    builder.InsEvents(rGen.Alphabet());
     
     // Safety limits (increased but still reasonable)
     const int MAX_STATES = 10000;
@@ -181,7 +185,7 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
     }
     
     // Create initial state in output automaton
-    Idx initialState = rRes.InsInitState();
+    Idx initialState = builder.InsInitState();
     stateToTree[initialState] = initialTree;
     
     std::string initialSig = ComputeTreeSignature(initialTree);
@@ -195,6 +199,9 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
     while(!stateQueue.empty() && stateCounter < MAX_STATES && iterationCounter < MAX_ITERATIONS) {
         iterationCounter++;
         
+        // Stop on exceeded execution budget
+        if(ExecutionBudget::Check(stateCounter,builder.TransRelSize())) break;
+        
         Idx currentState = stateQueue.front();
         stateQueue.pop();
         
@@ -471,7 +478,7 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
                 std::cout << "Debug: Found existing state " << targetState << " for tree" << std::endl;
             } else {
                 // Create new state for this tree
-                targetState = rRes.InsState();
+                targetState = builder.InsState();
                 stateToTree[targetState] = newTree;
                 treeSignatureToState[treeSig] = targetState;
                 
@@ -497,13 +504,13 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
                 }
                 
                 if(shouldMark) {
-                    rRes.SetMarkedState(targetState);
+                    builder.SetMarkedState(targetState);
                     std::cout << "Debug: Marking state " << targetState << std::endl;
                 }
             }
             
             // Add transition from current state to target state
-            rRes.SetTransition(currentState, event, targetState);
+            builder.SetTransition(currentState, event, targetState);
         }
     }
     
@@ -515,6 +522,10 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
         std::cout << "Warning: Reached maximum iteration limit of " << MAX_ITERATIONS << std::endl;
     }
     
+    // Build result, restore alphabet incl. attributes
+    builder.Finalize(rRes);
+    rRes.InjectAlphabet(rGen.Alphabet());
+    
     // Create Rabin pairs for output automaton
     RabinAcceptance outputRabinPairs;
     
@@ -553,6 +564,9 @@ void PseudoDet(const RabinAutomaton& rGen, RabinAutomaton& rRes) {
               
     std::cout << "Debug: GlobalR has " << globalR.Size() << " states" << std::endl;
     std::cout << "Debug: GlobalI has " << globalI.Size() << " states" << std::endl;
+    
+    // Throw on exceeded execution budget
+    ExecutionBudget::Abort("PseudoDet()",rRes);
 }
 
 } // namespace faudes
\ No newline at end of file
@@ -216,9 +216,9 @@ void RabinCtrlPartialObs(const RabinAutomaton& rPlant,
         throw;
     }
     
-    // Copy result if needed
+    // Move result if needed
     if (pSupervisor != &rSupervisor) {
-        rSupervisor = *pSupervisor;
+        pSupervisor->Move(rSupervisor);
         delete pSupervisor;
     }
     
@@ -29,6 +29,78 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
 namespace faudes {
 
+// existential backward reach on bit vectors, optionally restricted to a domain
+// (the reverse transition relation must not refer to states beyond MaxIndex())
+static void RabinBackwardReachDense(
+  const TransSetX2EvX1::ConstView& rRevTrans,
+  const DenseStateSet* pDomain,
+  DenseStateSet& rReach)
+{
+  std::vector<Idx> todo;
+  for(Idx q=rReach.First(); q!=0; q=rReach.Next(q)) todo.push_back(q);
+  TransSetX2EvX1::ConstView::Iterator rit, rit_end;
+  while(!todo.empty()) {
+    Idx x2=todo.back();
+    todo.pop_back();
+    rit=rRevTrans.BeginByX2(x2);
+    rit_end=rRevTrans.EndByX2(x2);
+    for(;rit!=rit_end;++rit) {
+      if(rit->X1>rReach.MaxIndex()) {
+        std::stringstream errstr;
+        errstr << "reverse transition relation refers to state " << rit->X1 
+          << " beyond maximum index " << rReach.MaxIndex();
+        throw Exception("RabinLiveStates", errstr.str(), 95);
+      }
+      if(pDomain) if(!pDomain->Exists(rit->X1)) continue;
+      if(rReach.Exists(rit->X1)) continue;
+      rReach.Insert(rit->X1);
+      todo.push_back(rit->X1);
+    }
+  }
+}
+
+// RabinLiveStates, variant on bit vectors
+// (same fixpoint as below, but the nu-/mu-iterations are organised as
+// worklist passes with constant time membership tests)
+static void RabinLiveStatesDense(
+  const TransSet& rTransRel,
+  const TransSetX2EvX1& rRevTransRel,
+  const StateSet& rISet,
+  const StateSet& rRSet,
+  Idx maxidx,
+  StateSet& rInv)
+{
+  DenseStateSet inv(rISet,maxidx);
+  DenseStateSet rset(rRSet,maxidx);
+  DenseStateSet breach(maxidx);
+  TransSet::ConstView trans(rTransRel);
+  TransSetX2EvX1::ConstView revtrans(rRevTransRel);
+  // iterate for overall fixpoint
+  DenseFixpoint(inv,0,[&]{
+    // nu-iteration to restrict inv to an existential forward invariant
+    DenseFixpoint(inv,0,[&]{
+      for(Idx q=inv.First(); q!=0; q=inv.Next(q)) {
+        TransSet::ConstView::Iterator tit=trans.Begin(q);
+        TransSet::ConstView::Iterator tit_end=trans.End(q);
+        for(;tit!=tit_end;++tit)
+          if(inv.Exists(tit->X2)) break;
+        if(tit==tit_end) inv.Erase(q);
+      }
+    });
+    // mu-iteration to obtain existential backward reach from rset within inv
+    breach=inv;
+    breach&=rset;
+    RabinBackwardReachDense(revtrans,&inv,breach);
+    // restrict inv to breach
+    inv&=breach;
+  });
+  // one more mu-iteration to obtain existential backward reach from inv
+  RabinBackwardReachDense(revtrans,0,inv);
+  // done
+  inv.ToStateSet(rInv);
+}
+
+
 // RabinLiveStates 
 // compute states from a rabin pair that are not livelocks/deadlocks 
 void RabinLiveStates(
@@ -40,6 +112,16 @@ void RabinLiveStates(
   // convenience accessors
   const StateSet& iset=rRPair.ISet();
   const StateSet& rset=rRPair.RSet();
+  // use bit vectors when state indices are dense
+  Idx maxidx=0;
+  if(!iset.Empty()) maxidx=std::max(maxidx,*(--iset.End()));
+  if(!rTransRel.Empty()) maxidx=std::max(maxidx,(--rTransRel.End())->X1);
+  if(!rRevTransRel.Empty()) maxidx=std::max(maxidx,(--rRevTransRel.End())->X2);
+  Idx size=std::max((Idx) iset.Size(),(Idx) rTransRel.Size());
+  if(DenseStateSet::Suitable(maxidx,size)) {
+    RabinLiveStatesDense(rTransRel,rRevTransRel,iset,rset,maxidx,rInv);
+    return;
+  }
   // initialise optimistic candidate of life states
   rInv=iset;
   // iterate for overall fixpoint
@@ -115,7 +197,7 @@ void RabinLiveStates(
 {
   // convenience accessor
   const TransSet& transrel=rRAut.TransRel();
-  TransSetX2EvX1 revtransrel(transrel);
+  const TransSetX2EvX1& revtransrel=rRAut.TransRelX2EvX1();
   // run algorithm
   RabinLiveStates(transrel,revtransrel,rRPair,rInv);
 }
@@ -126,7 +208,7 @@ void RabinLiveStates(const RabinAutomaton& rRAut, StateSet& rInv) {
   // convenience accessor
   const RabinAcceptance& raccept=rRAut.RabinAcceptance();
   const TransSet& transrel=rRAut.TransRel();
-  TransSetX2EvX1 revtransrel(transrel);
+  const TransSetX2EvX1& revtransrel=rRAut.TransRelX2EvX1();
   // pessimistic candidate for the trim set
   rInv.Clear();
   // iterate over Rabin pairs 
@@ -156,7 +238,7 @@ bool RabinTrim(RabinAutomaton& rRAut) {
   // convenience accessor
   RabinAcceptance& raccept=rRAut.RabinAcceptance();
   const TransSet& transrel=rRAut.TransRel();
-  const TransSetX2EvX1 revtransrel(transrel);
+  const TransSetX2EvX1& revtransrel=rRAut.TransRelX2EvX1();
   // trim each Rabin pair to its  live states
   StateSet alive;
   StateSet plive;
@@ -186,6 +268,64 @@ bool RabinTrim(const RabinAutomaton& rRAut, RabinAutomaton& rRes) {
 }  
 
 
+// RabinBinaryWrite(rRAut,rFileName)
+void RabinBinaryWrite(const RabinAutomaton& rRAut, const std::string& rFileName) {
+  // encode acceptance condition
+  std::vector<uint32_t> rabn;
+  const RabinAcceptance& acc=rRAut.RabinAcceptance();
+  rabn.push_back(acc.Size());
+  RabinAcceptance::CIterator rit=acc.Begin();
+  for(;rit!=acc.End();++rit) {
+    rabn.push_back(rit->RSet().Size());
+    StateSet::Iterator sit=rit->RSet().Begin();
+    for(;sit!=rit->RSet().End();++sit) rabn.push_back(*sit);
+    rabn.push_back(rit->ISet().Size());
+    sit=rit->ISet().Begin();
+    for(;sit!=rit->ISet().End();++sit) rabn.push_back(*sit);
+  }
+  std::map<uint32_t,std::string> extra;
+  extra[BinaryGenerator::Tag("RABN")]=std::string((const char*) &rabn[0],rabn.size()*sizeof(uint32_t));
+  // write
+  BinaryWrite(rRAut,rFileName,extra);
+}
+
+// RabinBinaryRead(rFileName,rRAut)
+void RabinBinaryRead(const std::string& rFileName, RabinAutomaton& rRAut) {
+  BinaryGenerator bgen(rFileName);
+  bgen.ToGenerator(rRAut);
+  // decode acceptance condition
+  RabinAcceptance acc;
+  uint64_t size;
+  const uint32_t* rabn=(const uint32_t*) bgen.Section(BinaryGenerator::Tag("RABN"),&size);
+  uint64_t len= rabn ? size/sizeof(uint32_t) : 0;
+  uint64_t pos=0;
+  bool ok=true;
+  if(len>0) {
+    uint32_t npairs=rabn[pos++];
+    for(uint32_t i=0; ok && i<npairs; ++i) {
+      RabinPair pair;
+      for(int k=0; ok && k<2; ++k) {
+        StateSet& set = (k==0 ? pair.RSet() : pair.ISet());
+        ok = pos<len && rabn[pos] <= len-pos-1;
+        if(!ok) break;
+        uint32_t n=rabn[pos++];
+        for(uint32_t j=0; ok && j<n; ++j) {
+          ok = bgen.StatePos(rabn[pos])<bgen.Size();
+          set.Insert(rabn[pos++]);
+        }
+      }
+      if(ok) acc.Append(pair);
+    }
+  }
+  if(!ok) {
+    std::stringstream errstr;
+    errstr << "invalid section RABN in \"" << rFileName << "\"";
+    throw Exception("RabinBinaryRead", errstr.str(), 50);
+  }
+  rRAut.RabinAcceptance(acc);
+}
+
+
 
 } // namespace faudes
 
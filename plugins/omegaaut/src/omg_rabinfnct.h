@@ -147,6 +147,43 @@ extern FAUDES_API bool RabinTrim(RabinAutomaton& rRAut);
  */
 extern FAUDES_API bool RabinTrim(const RabinAutomaton& rRAut, RabinAutomaton& rRes);
 
+/**
+ * Write Rabin automaton in binary file format.
+ *
+ * The automaton is written by faudes::BinaryWrite, with an additional section
+ * "RABN" that holds the Rabin acceptance condition as a sequence of 32-bit integers:
+ * the number of Rabin pairs, followed by the size and the elements of the R-set
+ * and of the I-set for each pair.
+ *
+ * @param rRAut
+ *   Automaton to write
+ * @param rFileName
+ *   File to write
+ * @exception Exception
+ *   - cannot open or write file (id 2)
+ *
+ * @ingroup OmgPlugin
+ */
+extern FAUDES_API void RabinBinaryWrite(const RabinAutomaton& rRAut, const std::string& rFileName);
+
+/**
+ * Read Rabin automaton from binary file format.
+ *
+ * See RabinBinaryWrite for the file format. If the file has no "RABN" section,
+ * the acceptance condition is cleared.
+ *
+ * @param rFileName
+ *   File to read
+ * @param rRAut
+ *   Automaton to set up
+ * @exception Exception
+ *   - cannot open file (id 1)
+ *   - invalid file format (id 50)
+ *
+ * @ingroup OmgPlugin
+ */
+extern FAUDES_API void RabinBinaryRead(const std::string& rFileName, RabinAutomaton& rRAut);
+
 
 
 } // namespace faudes
@@ -385,6 +385,37 @@ int main() {
   FAUDES_TEST_DUMP("ex3super",ex3super);
   FAUDES_TEST_DUMP("ex3controller",ex3controller);
 
+
+  /////////////////////////////////////////////
+  // Controlled liveness on bit vectors vs state sets
+  //
+  // ControlledBuechiLiveness uses bit vectors when state indices are dense.
+  // An isolated state with a large index enforces the set based variant; it
+  // must be removed while the result otherwise matches.
+  /////////////////////////////////////////////
+
+  bool lvagree=true;
+  const Generator* lvcands[] = {&ex1spec, &ex2spec, &ex3spec, &specab11, &specab21, &specab31}; 
+  const System* lvplants[] = {&ex1plant, &ex2plant, &ex3plant, &machineab1, &machineab1, &machineab1}; 
+  for(int i=0; i<6; ++i) {
+    EventSet lvcalph = lvplants[i]->ControllableEvents();
+    Generator lvdense = *lvcands[i];
+    lvdense.StateNamesEnabled(false);
+    lvdense.MinStateIndex();
+    StateSet lvmarking = lvdense.MarkedStates();
+    Generator lvsparse = lvdense;
+    lvsparse.InsState(1000000);
+    ControlledBuechiLiveness(lvdense,lvcalph,lvmarking);
+    ControlledBuechiLiveness(lvsparse,lvcalph,lvmarking);
+    if(lvsparse.ExistsState(1000000)) lvagree=false;
+    if(lvdense.States()!=lvsparse.States()) lvagree=false;
+    if(lvdense.TransRel()!=lvsparse.TransRel()) lvagree=false;
+  }
+  std::cout << "################################\n";
+  std::cout << "# controlled liveness dense vs set based: " << (lvagree ? "agree" : "differ (test case error!)") << "\n";
+  std::cout << "################################\n";
+  FAUDES_TEST_DUMP("liveness dense",lvagree);
+
   return 0;
 }
 
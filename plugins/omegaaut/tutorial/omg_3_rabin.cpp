@@ -124,6 +124,74 @@ int main(void) {
   FAUDES_TEST_DUMP("raccept stats",raccept);
 
 
+  ////////////////////////////////////////////////////
+  // Live states on bit vectors vs state sets
+  ////////////////////////////////////////////////////
+
+  // RabinLiveStates uses bit vectors when state indices are dense; a selflooped 
+  // extra state with a large index enforces the set based variant and must not 
+  // be live unless it can reach the RSet
+  std::cout << "======== Rabin live states dense vs set based" << std::endl;  
+  RabinAutomaton lvdense;
+  lvdense.Read("data/omg_rnottrim.gen");
+  RabinAutomaton lvsparse=lvdense;
+  lvsparse.InsState(1000000);
+  lvsparse.SetTransition(1000000,lvsparse.EventIndex("a"),1000000);
+  bool lvagree=true;
+  RabinAcceptance::CIterator lvit=lvdense.RabinAcceptance().Begin();
+  for(;lvit!=lvdense.RabinAcceptance().End();++lvit) {
+    RabinPair lvpair=*lvit;
+    lvpair.ISet().Insert(1000000);
+    StateSet lvdenseinv, lvsparseinv;
+    RabinLiveStates(lvdense,*lvit,lvdenseinv);    
+    RabinLiveStates(lvsparse,lvpair,lvsparseinv);    
+    if(lvdenseinv!=lvsparseinv) lvagree=false;
+  }
+  std::cout << "=== " << (lvagree ? "agree" : "differ (test case error!)") << std::endl;
+  std::cout << std::endl;
+
+  // record test case
+  FAUDES_TEST_DUMP("live states dense", lvagree);
+
+
+  ////////////////////////////////////////////////////
+  // Binary file format incl. acceptance condition
+  ////////////////////////////////////////////////////
+
+  // write/read roundtrip, and a truncated file must be rejected
+  std::cout << "======== Rabin automaton binary file roundtrip" << std::endl;  
+  RabinAutomaton rbin;
+  rbin.Read("data/omg_rnottrim.gen");
+  RabinBinaryWrite(rbin,"tmp_rnottrim.fbg");
+  RabinAutomaton rbinback;
+  RabinBinaryRead("tmp_rnottrim.fbg",rbinback);
+  bool rbinok = rbin.Alphabet()==rbinback.Alphabet() && rbin.States()==rbinback.States();
+  rbinok = rbinok && rbin.TransRel()==rbinback.TransRel() && rbin.InitStates()==rbinback.InitStates();
+  rbinok = rbinok && rbin.RabinAcceptance().Size()==rbinback.RabinAcceptance().Size();
+  RabinAcceptance::CIterator rbit=rbin.RabinAcceptance().Begin();
+  RabinAcceptance::CIterator rbbit=rbinback.RabinAcceptance().Begin();
+  for(;rbinok && rbit!=rbin.RabinAcceptance().End(); ++rbit, ++rbbit) 
+    rbinok = rbit->RSet()==rbbit->RSet() && rbit->ISet()==rbbit->ISet();
+  std::string rbindata;
+  std::ifstream rbinin("tmp_rnottrim.fbg", std::ios::in|std::ios::binary);
+  rbindata.assign(std::istreambuf_iterator<char>(rbinin),std::istreambuf_iterator<char>());
+  rbinin.close();
+  std::ofstream rbinout("tmp_rnottrim_trunc.fbg", std::ios::out|std::ios::binary|std::ios::trunc);
+  rbinout.write(rbindata.data(),rbindata.size()-8);
+  rbinout.close();
+  try {
+    RabinBinaryRead("tmp_rnottrim_trunc.fbg",rbinback);
+    rbinok=false;
+  } catch(Exception& ex) {
+    if(ex.Id()!=50) rbinok=false;
+  }
+  std::cout << "=== " << (rbinok ? "ok" : "failed (test case error!)") << std::endl;
+  std::cout << std::endl;
+
+  // record test case
+  FAUDES_TEST_DUMP("binary roundtrip", rbinok);
+
+
   ////////////////////////////////////////////////////
   // Rabin automata basics
   ////////////////////////////////////////////////////
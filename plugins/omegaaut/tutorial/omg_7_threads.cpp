@@ -0,0 +1,157 @@
+/** @file omg_7_threads.cpp
+
+Tutorial/test on concurrent computations
+
+libFAUDES supports concurrent computations on independent objects,
+provided that the library has been configured with threads. This tutorial
+runs parallel composition, determinisation, controller synthesis and
+Rabin pseudo-determinisation from a number of threads and compares the
+results with those obtained by sequential execution.
+
+Each thread reads its own inputs from file: objects that share data by
+copy-on-write (i.e., a generator and its copies) must not be accessed from
+different threads concurrently.
+
+@ingroup Tutorials
+
+@include omg_7_threads.cpp
+
+*/
+
+#include "libfaudes.h"
+
+
+using namespace faudes;
+
+
+// number of threads and rounds per thread
+#define THREADS 8
+#define ROUNDS 4
+
+
+// results of one round
+struct Results {
+  Generator mParallel;
+  Generator mDeterministic;
+  Generator mSupCon;
+  RabinAutomaton mPseudoDet;
+};
+
+
+// one round of computations, inputs read from file
+void Compute(Results& rRes) {
+  // parallel composition of a-b-machines
+  Generator machineab1("data/omg_machineab1.gen");
+  Generator machineab2("data/omg_machineab2.gen");
+  Parallel(machineab1,machineab2,rRes.mParallel);
+  // determinisation of a nondeterministic generator
+  Generator nondet("data/omg_rnottrim.gen");
+  Deterministic(nondet,rRes.mDeterministic);
+  // supervisor synthesis for a-b-machine 1
+  System plant("data/omg_machineab1.gen");
+  Generator spec("data/omg_specab1.gen");
+  Generator plantspec;
+  Parallel(plant,spec,plantspec);
+  SupCon(plant,plantspec,rRes.mSupCon);
+  // pseudo-determinisation of a nondeterministic Rabin automaton
+  RabinAutomaton nra("data/eps_observed.gen");
+  PseudoDet(nra,rRes.mPseudoDet);
+}
+
+
+// compare results by their token representation
+bool Equal(const Results& rRes1, const Results& rRes2) {
+  if(rRes1.mParallel.ToText()!=rRes2.mParallel.ToText()) return false;
+  if(rRes1.mDeterministic.ToText()!=rRes2.mDeterministic.ToText()) return false;
+  if(rRes1.mSupCon.ToText()!=rRes2.mSupCon.ToText()) return false;
+  if(rRes1.mPseudoDet.ToText()!=rRes2.mPseudoDet.ToText()) return false;
+  return true;
+}
+
+
+// thread task
+struct Task {
+  Results mResults[ROUNDS];
+  bool mException;
+};
+
+
+// thread function
+void* Worker(void* arg) {
+  Task* task = static_cast<Task*>(arg);
+  try {
+    for(int r=0; r<ROUNDS; ++r) Compute(task->mResults[r]);
+  } catch(Exception&) {
+    task->mException=true;
+  }
+  return NULL;
+}
+
+
+int main() {
+
+  ///////////////////////////////////
+  // Sequential reference
+  ///////////////////////////////////
+
+  Results ref;
+  Compute(ref);
+
+  std::cout << "################################\n";
+  std::cout << "# sequential results, state count\n";
+  std::cout << "# parallel #" << ref.mParallel.Size() << "\n";
+  std::cout << "# deterministic #" << ref.mDeterministic.Size() << "\n";
+  std::cout << "# supcon #" << ref.mSupCon.Size() << "\n";
+  std::cout << "# pseudodet #" << ref.mPseudoDet.Size() << "\n";
+  std::cout << "################################\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("parallel",ref.mParallel);
+  FAUDES_TEST_DUMP("deterministic",ref.mDeterministic);
+  FAUDES_TEST_DUMP("supcon",ref.mSupCon);
+  FAUDES_TEST_DUMP("pseudodet",ref.mPseudoDet);
+
+  ///////////////////////////////////
+  // Concurrent computation
+  ///////////////////////////////////
+
+  std::vector<Task> tasks(THREADS);
+  for(int t=0; t<THREADS; ++t) tasks[t].mException=false;
+#ifdef FAUDES_THREADS
+  std::vector<faudes_thread_t> threads(THREADS);
+  std::vector<bool> running(THREADS,false);
+  for(int t=0; t<THREADS; ++t)
+    running[t] = (faudes_thread_create(&threads[t],Worker,&tasks[t]) == FAUDES_THREAD_SUCCESS);
+  for(int t=0; t<THREADS; ++t) {
+    if(running[t]) faudes_thread_join(threads[t],NULL);
+    else Worker(&tasks[t]);
+  }
+#else
+  // no threads configured: run sequentially
+  for(int t=0; t<THREADS; ++t) Worker(&tasks[t]);
+#endif
+
+  // compare with sequential reference (after join, results may be accessed by any thread)
+  bool identical=true;
+  for(int t=0; t<THREADS; ++t) {
+    if(tasks[t].mException) identical=false;
+    for(int r=0; r<ROUNDS; ++r)
+      if(!Equal(ref,tasks[t].mResults[r])) identical=false;
+  }
+
+  std::cout << "################################\n";
+  std::cout << "# concurrent results \n";
+  if(identical)
+    std::cout << "# identical to sequential results (expected)\n";
+  else
+    std::cout << "# differ from sequential results (test case error!)\n";
+  std::cout << "################################\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("concurrent",identical);
+
+  // validate
+  FAUDES_TEST_DIFF();
+
+  return 0;
+}
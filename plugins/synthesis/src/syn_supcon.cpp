@@ -74,6 +74,11 @@ void SupConClosedUnchecked(
   TransSetX2EvX1 rtransrel;
   // critical states
   StateSet critical;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView transg(rPlantGen.TransRel());
+  TransSet::ConstView transh(rSupCandGen.TransRel());
+  // dense table of controllable events
+  EventFlagTable cflags(rCAlph,AttributeCFlags::mControllableFlag);
 
   // push combined initial state on todo stack
   todog.push(*rPlantGen.InitStatesBegin());
@@ -111,10 +116,10 @@ void SupConClosedUnchecked(
 #endif 
 
     // process all h transitions while there could be matching g transitions
-    TransSet::Iterator titg = rPlantGen.TransRelBegin(currentg);
-    TransSet::Iterator titg_end = rPlantGen.TransRelEnd(currentg);
-    TransSet::Iterator tith = rSupCandGen.TransRelBegin(currenth);
-    TransSet::Iterator tith_end = rSupCandGen.TransRelEnd(currenth);
+    TransSet::ConstView::Iterator titg = transg.Begin(currentg);
+    TransSet::ConstView::Iterator titg_end = transg.End(currentg);
+    TransSet::ConstView::Iterator tith = transh.Begin(currenth);
+    TransSet::ConstView::Iterator tith_end = transh.End(currenth);
     while ((tith != tith_end) && (titg != titg_end)) {
       FD_DF("SupCon: processing g-transition: " << rPlantGen.SStr(titg->X1) 
 		  << "-" << rPlantGen.EStr(titg->Ev) << "-" << rPlantGen.SStr(titg->X2));
@@ -138,11 +143,11 @@ void SupConClosedUnchecked(
 	  ++tith;
 	}
 	// if successor state is critical and event uncontrollable 
-	else if (!rCAlph.Exists(titg->Ev)) {
+	else if (!cflags.Controllable(titg->Ev)) {
 	  FD_DF("SupCon: successor state " << rSupCandGen.SStr(tith->X2) << 
 	    " critical and event " << rPlantGen.EStr(titg->Ev) << " uncontrollable:");
 	  FD_DF("SupCon: TraverseUncontrollableBackwards(" << rSupCandGen.SStr(currenth) << ")");
-	    TraverseUncontrollableBackwards(rCAlph, rtransrel, critical, currenth);
+	    TraverseUncontrollableBackwards(cflags, rtransrel, critical, currenth);
 #ifdef FAUDES_CHECKED
 	    // just increment transrel iterators to find all h transitions not in g
 	    FD_DF("IsControllable: incrementing g an h transrel (FAUDES_CHECKED)");
@@ -170,11 +175,11 @@ void SupConClosedUnchecked(
 		 << " in h");
         // if uncontrollable transition violates specification
         // delete state from rResGen and put into criticalset
-        if (!rCAlph.Exists(titg->Ev)) {
+        if (!cflags.Controllable(titg->Ev)) {
 	  FD_DF("SupCon: asynchronous event " << rPlantGen.EStr(titg->Ev) 
 		     << " in g is uncontrollable");
 	  FD_DF("SupCon: TraverseUncontrollableBackwards(" << rSupCandGen.SStr(currenth) << ")");
-	  TraverseUncontrollableBackwards(rCAlph, rtransrel, critical, currenth);
+	  TraverseUncontrollableBackwards(cflags, rtransrel, critical, currenth);
 	  // exit all loops over g transrel
 	  titg = titg_end;
 	  break;
@@ -200,11 +205,11 @@ void SupConClosedUnchecked(
 		<< "-" << rPlantGen.EStr(titg->Ev) << "-" << rPlantGen.SStr(titg->X2));
       FD_DF("SupCon: actual h-transition: end");
       // if uncontrollable transition violates specification
-      if (!rCAlph.Exists(titg->Ev)) {
+      if (!cflags.Controllable(titg->Ev)) {
 	FD_DF("SupCon: asynchronous execution of uncontrollable event "
 		  << rPlantGen.EStr(titg->Ev) << " in g");
 	FD_DF("SupCon: TraverseUncontrollableBackwards(" << rPlantGen.SStr(currenth) << ")");
-        TraverseUncontrollableBackwards(rCAlph, rtransrel, critical, currenth);
+        TraverseUncontrollableBackwards(cflags, rtransrel, critical, currenth);
 	// exit this loop
 	break;
       }
@@ -261,6 +266,12 @@ bool IsControllableUnchecked(
   if(rPlantGen.InitStatesEmpty() || rSupCandGen.InitStatesEmpty()) 
     return true;
 
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView transg(rPlantGen.TransRel());
+  TransSet::ConstView transh(rSupCandGen.TransRel());
+  // dense table of controllable events
+  EventFlagTable cflags(rCAlph,AttributeCFlags::mControllableFlag);
+
   // push combined initial state on todo stack
   todo.push( std::make_pair(*rPlantGen.InitStatesBegin(),*rSupCandGen.InitStatesBegin()) );
   FD_DF("IsControllable: todo push: (" << rPlantGen.SStr(*rPlantGen.InitStatesBegin()) << "|"
@@ -293,10 +304,10 @@ bool IsControllableUnchecked(
 #endif 
 
     // process all h transitions while there could be matching g transitions
-    TransSet::Iterator titg = rPlantGen.TransRelBegin(currentg);
-    TransSet::Iterator titg_end = rPlantGen.TransRelEnd(currentg);
-    TransSet::Iterator tith = rSupCandGen.TransRelBegin(currenth);
-    TransSet::Iterator tith_end = rSupCandGen.TransRelEnd(currenth);
+    TransSet::ConstView::Iterator titg = transg.Begin(currentg);
+    TransSet::ConstView::Iterator titg_end = transg.End(currentg);
+    TransSet::ConstView::Iterator tith = transh.Begin(currenth);
+    TransSet::ConstView::Iterator tith_end = transh.End(currenth);
     while ((tith != tith_end) && (titg != titg_end)) {
       FD_DF("IsControllable: processing g-transition: " << rPlantGen.SStr(titg->X1) 
 		  << "-" << rPlantGen.EStr(titg->Ev) << "-" << rPlantGen.SStr(titg->X2));
@@ -324,7 +335,7 @@ bool IsControllableUnchecked(
 		 << " in h");
         // if uncontrollable transition violates specification
         // record that state as critical
-        if (!rCAlph.Exists(titg->Ev)) {
+        if (!cflags.Controllable(titg->Ev)) {
 	  FD_DF("IsControllable: asynchronous event " << rPlantGen.EStr(titg->Ev) 
 		     << " in g is uncontrollable");
 	  FD_DF("IsControllable: TraverseUncontrollableBackwards(" << rSupCandGen.SStr(currenth) << ")");
@@ -354,7 +365,7 @@ bool IsControllableUnchecked(
 		<< "-" << rPlantGen.EStr(titg->Ev) << "-" << rPlantGen.SStr(titg->X2));
       FD_DF("IsControllable: actual h-transition: end");
       // if uncontrollable transition violates specification
-      if (!rCAlph.Exists(titg->Ev)) {
+      if (!cflags.Controllable(titg->Ev)) {
 	FD_DF("IsControllable: asynchronous execution of uncontrollable event "
 		  << rPlantGen.EStr(titg->Ev) << " in g");
 	FD_DF("IsControllable: TraverseUncontrollableBackwards(" << rPlantGen.SStr(currenth) << ")");
@@ -404,7 +415,12 @@ void SupConProduct(
   Idx currentt, nextt;
   std::map< std::pair<Idx,Idx>, Idx>::iterator rcmapit;
   StateSet::Iterator lit1, lit2;
-  TransSet::Iterator titg, titg_end, tith, tith_end;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView transg(rPlantGen.TransRel());
+  TransSet::ConstView transh(rSpecGen.TransRel());
+  // dense table of controllable events
+  EventFlagTable cflags(rCAlph,AttributeCFlags::mControllableFlag);
+  TransSet::ConstView::Iterator titg, titg_end, tith, tith_end;
 
   // prepare
   rResGen.ClearStates();
@@ -445,6 +461,8 @@ void SupConProduct(
     // LoopCallback();
     // allow for user interrupt, incl progress report
     FD_WPC(rCompositionMap.size(),rCompositionMap.size()+todo.size(),"SupConProduct(): processing"); 
+    // stop on exceeded execution budget
+    if(ExecutionBudget::Check(rCompositionMap.size(),rResGen.TransRelSize())) break;
     // get next reachable pair of states from todo stack
     currentp = todo.top();
     todo.pop();
@@ -456,10 +474,10 @@ void SupConProduct(
     // might have been indicated to be critical
     if(critical.Exists(currentt)) continue;    
     // set up transition relation iterators	
-    titg = rPlantGen.TransRelBegin(currentp.first);
-    titg_end = rPlantGen.TransRelEnd(currentp.first);
-    tith = rSpecGen.TransRelBegin(currentp.second);
-    tith_end = rSpecGen.TransRelEnd(currentp.second);
+    titg = transg.Begin(currentp.first);
+    titg_end = transg.End(currentp.first);
+    tith = transh.Begin(currentp.second);
+    tith_end = transh.End(currentp.second);
 
 #ifdef FAUDES_DEBUG_FUNCTION
     // print all transitions of current states
@@ -469,8 +487,8 @@ void SupConProduct(
     for (;tith != tith_end; ++tith) {
       FD_DF("SupConParallel: h: " << rSpecGen.TStr(*tith));
     }
-    titg = rPlantGen.TransRelBegin(currentp.first);
-    tith = rSpecGen.TransRelBegin(currentp.second);
+    titg = transg.Begin(currentp.first);
+    tith = transh.Begin(currentp.second);
 #endif                                                                      
 
     // process all h transitions while there could be matching g transitions
@@ -515,7 +533,7 @@ void SupConProduct(
 	  ++tith;
 	}
 	// if successor state is critical and event is uncontrollable then this state becomes critical, too
-	else if (!rCAlph.Exists(titg->Ev)) {
+	else if (!cflags.Controllable(titg->Ev)) {
 	  FD_DF("SupConProduct: successor in critical with uncntr. shared event " << rSpecGen.EStr(titg->Ev)) 
 	  FD_DF("SupConProduct: critical insert, exit loop");
 	  critical.Insert(currentt);
@@ -535,7 +553,7 @@ void SupConProduct(
       else if (titg->Ev < tith->Ev) {
 	FD_DF("SupConProduct: event only enabled in g: " << rPlantGen.EStr(titg->Ev));
 	// when uncontrollable, current state is critical
-	if(!rCAlph.Exists(titg->Ev)) {
+	if(!cflags.Controllable(titg->Ev)) {
 	  FD_DF("SupConProduct: asynchronous event is uncontrollable, critical insert, exit loop");
 	  critical.Insert(currentt);
 	  // exit all loops
@@ -558,7 +576,7 @@ void SupConProduct(
     while (titg != titg_end) {
       FD_DF("SupConProduct: event only enabled in g: " << rPlantGen.EStr(titg->Ev));
       // if uncontrollable transition leaves specification
-      if (!rCAlph.Exists(titg->Ev)) {
+      if (!cflags.Controllable(titg->Ev)) {
 	FD_DF("SupConProduct: asynchronous event is uncontrollable, critical insert, exit loop");
 	critical.Insert(currentt);
 	// exit all loops
@@ -578,6 +596,8 @@ void SupConProduct(
   } // while todo
   FD_DF("SupConProduct: deleting critical states...");
   rResGen.DelStates(critical);
+  // throw on exceeded execution budget
+  ExecutionBudget::Abort("SupConProduct()",rResGen);
 }
 
 
@@ -604,12 +624,22 @@ void SupConUnchecked(
   // controllable events
   FD_DF("SupCon: controllable events: "   << rCAlph.ToString());
 
-  // ALGORITHM:
-  SupConProduct(rPlantGen, rCAlph, rSpecGen, rCompositionMap, *pResGen);
+  // ALGORITHM (pass on partial result on exceeded execution budget)
+  try {
+    SupConProduct(rPlantGen, rCAlph, rSpecGen, rCompositionMap, *pResGen);
+  } catch(const Exception& exception) {
+    if(pResGen != &rResGen) {
+      if(exception.Id()==111) pResGen->Move(rResGen);
+      delete pResGen;
+    }
+    throw;
+  }
 
   // make resulting generator trim until it's fully controllable
   while(true) {
     if(pResGen->Empty()) break;
+    // stop on exceeded execution budget
+    if(ExecutionBudget::Check(pResGen->Size(),pResGen->TransRelSize())) break;
     Idx state_num = pResGen->Size();
     SupConClosedUnchecked(rPlantGen, rCAlph, *pResGen);
     pResGen->Trim();
@@ -628,6 +658,8 @@ void SupConUnchecked(
     delete pResGen;
   }
 
+  // throw on exceeded execution budget
+  ExecutionBudget::Abort("SupCon()",rResGen);
 }
 
 // ControlProblemConsistencyCheck(rPlantGen, rCAlph, rSpecGen)
@@ -881,6 +913,44 @@ void TraverseUncontrollableBackwards(
 }
 
 
+// TraverseUncontrollableBackwards(rCFlags, rtransrel, critical, current)
+void TraverseUncontrollableBackwards(
+  const EventFlagTable& rCFlags, 
+  TransSetX2EvX1& rtransrel, 
+  StateSet& rCriticalStates, 
+  Idx current) {
+  FD_DF("TraverseUncontrollableBackwards: " << rCriticalStates.Str(current));
+
+  // HELPERS:
+  std::stack<Idx> todo;
+  TransSetX2EvX1::Iterator rtit = rtransrel.BeginByX2(current);
+  TransSetX2EvX1::Iterator rtit_end = rtransrel.EndByX2(current);
+
+  // ALGORITHM:
+  rCriticalStates.Insert(current);
+  todo.push(current);
+  FD_DF("TraverseUncontrollableBackwards: current rCriticalStates set: " 
+     << rCriticalStates.ToString());
+  // process todo stack
+  while(! todo.empty()) {
+    // get top state from todo stack
+    current = todo.top(); todo.pop();
+    // iteration over all transitions with x2 == current
+    rtit_end = rtransrel.EndByX2(current);
+    rtit = rtransrel.BeginByX2(current);
+    for(; rtit != rtit_end; ++rtit) {
+      // if uncontrollable event and predecessor state not already critical
+      if((!rCFlags.Controllable(rtit->Ev)) && (! rCriticalStates.Exists(rtit->X1))) {
+        FD_DF("TraverseUncontrollableBackwards: todo push " << rCriticalStates.Str(rtit->X1));
+	todo.push(rtit->X1);
+	FD_DF("TraverseUncontrollableBackwards: critical insert: " << rCriticalStates.Str(rtit->X1));
+	rCriticalStates.Insert(rtit->X1);
+      }
+    }
+  } // end while todo
+}
+
+
 // controllability test for System plant
 bool IsControllable(
   const System& rPlantGen, 
@@ -903,8 +973,16 @@ void SupCon(
     pResGen= rResGen.New();
   }
 
-  // execute 
-  SupCon(rPlantGen, rPlantGen.ControllableEvents(),rSpecGen,*pResGen);
+  // execute (pass on partial result on exceeded execution budget)
+  try {
+    SupCon(rPlantGen, rPlantGen.ControllableEvents(),rSpecGen,*pResGen);
+  } catch(const Exception& exception) {
+    if(pResGen != &rResGen) {
+      if(exception.Id()==111) pResGen->Move(rResGen);
+      delete pResGen;
+    }
+    throw;
+  }
 
   // copy all attributes of input alphabet
   pResGen->EventAttributes(rPlantGen.Alphabet());
@@ -461,6 +461,25 @@ extern FAUDES_API void TraverseUncontrollableBackwards(
   StateSet& rCriticalStates, 
   Idx current);
 
+/**
+ * Helper function for IsControllable, variant with a dense table of
+ * controllable events. See TraverseUncontrollableBackwards(const EventSet&, ...).
+ *
+ * @param rCFlags
+ *   Table of events, controllable events are flagged
+ * @param rtransrel
+ *   Reverse sorted transition relation
+ * @param rCriticalStates
+ *   Set of critical states in composition generator
+ * @param current
+ *   Current state
+ */
+extern FAUDES_API void TraverseUncontrollableBackwards(
+  const EventFlagTable& rCFlags,
+  TransSetX2EvX1& rtransrel,
+  StateSet& rCriticalStates,
+  Idx current);
+
 
 
 /**
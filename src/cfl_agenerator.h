@@ -1222,6 +1222,7 @@ TEMP bool THIS::SetTransition(const Transition& rTransition) {
     throw Exception("TaGenerator::SetTransition(..)", errstr.str(), 95);
   }
 #endif
+  ClearTransRelIndices();
   return pTransRel->Insert(rTransition);
 }
 
@@ -1249,6 +1250,7 @@ TEMP bool THIS::SetTransition(const Transition& rTransition, const TransAttr& rA
     throw Exception("TaGenerator::SetTransition(..)", errstr.str(), 95);
   }
 #endif
+  ClearTransRelIndices();
   return pTransRel->Insert(rTransition,rAttr);
 }
 
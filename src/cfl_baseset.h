@@ -33,6 +33,7 @@
 #include "cfl_attributes.h"
 #include <set>
 #include <algorithm>
+#include <iterator>
 
 // fix mingw toochain
 #ifdef THIS
@@ -377,6 +378,40 @@ public:
   /** Detach and lock any further reallocation */
   void Lock(void) const;
 
+  /** 
+   * Read-only view on a TBaseSet.
+   *
+   * A ConstView provides plain STL const iterators on the current storage of a set 
+   * and thereby bypasses the iterator tracking implemented by TBaseSet::Iterator. It is meant for
+   * hot loops in algorithms that only read the set. Other than with Lock(), the set itself
+   * is not affected. The set, and any other set that shares its storage by the deferred copy 
+   * mechanism, must not be modified while the view is in use. As an exception, elements may be 
+   * inserted to or erased from the viewed set itself, provided that it has been detached before the view 
+   * was constructed; as with STL sets, this only invalidates view iterators that refer to erased elements.
+   */
+  class ConstView {
+  public:
+    /** Iterator type: STL const iterator, no tracking */
+    typedef typename std::set<T,Cmp>::const_iterator Iterator;
+    /** Construct view on set */
+    explicit ConstView(const TBaseSet& rSet) : mpSet(rSet.pSet) {};
+    /** Iterator to first element */
+    Iterator Begin(void) const { return mpSet->begin(); };
+    /** Iterator one beyond last element */
+    Iterator End(void) const { return mpSet->end(); };
+    /** Find element */
+    Iterator Find(const T& rElem) const { return mpSet->find(rElem); };
+    /** Test existence of element */
+    bool Exists(const T& rElem) const { return mpSet->find(rElem)!=mpSet->end(); };
+    /** Number of elements */
+    Idx Size(void) const { return (Idx) mpSet->size(); };
+    /** Test for empty set */
+    bool Empty(void) const { return mpSet->empty(); };
+  protected:
+    /** STL set to view */
+    const std::set<T,Cmp>* mpSet;
+  };
+
   /** 
    * Iterator class for high-level API to TBaseSet.
    * This class is derived from STL iterators to additionally provide
@@ -941,6 +976,15 @@ protected:
 protected:
 
 
+  /** Assign union of two other sets by linear merge, excl. attributes (this must not be an argument) */
+  void DoSetUnion(const TBaseSet& rSetA, const TBaseSet& rSetB);
+
+  /** Assign intersection of two other sets by linear merge, excl. attributes (this must not be an argument) */
+  void DoSetIntersection(const TBaseSet& rSetA, const TBaseSet& rSetB);
+
+  /** Assign difference of two other sets by linear merge, excl. attributes (this must not be an argument) */
+  void DoSetDifference(const TBaseSet& rSetA, const TBaseSet& rSetB);
+
   /** Pointer on STL set to operate on */
   std::set<T,Cmp>* pSet;
 
@@ -1320,7 +1364,7 @@ TEMP void THIS::DoAssign(const THIS& rSourceSet) {
     if(typeid(*this->AttributeType()) != typeid(const AttributeVoid)) {
       for(aiterator ait=rSourceSet.pAttributes->begin(); ait!=rSourceSet.pAttributes->end(); ++ait) {
         AttributeVoid* attr= ait->second->Copy();
-        (*mpAttributes)[ait->first]=attr;
+        mpAttributes->insert(mpAttributes->end(),std::make_pair(ait->first,attr));
       }
     }
     // todo: if element is of faudes type, copy object names
@@ -1383,7 +1427,7 @@ TEMP void THIS::Detach(DetachMode flag) const {
   if(flag==AttrIncl) {
     for(aiterator ait=pAttributes->begin(); ait!=pAttributes->end(); ++ait) {
       AttributeVoid* attr= ait->second->Copy();
-      (*acopy)[ait->first]=attr;
+      acopy->insert(acopy->end(),std::make_pair(ait->first,attr));
     }
   }
 
@@ -2049,30 +2093,40 @@ TEMP void THIS::Inject(const T& rElem) {
 // InsertSet(set)
 TEMP void THIS::InsertSet(const TBaseSet& rOtherSet) {
   FD_DC("TBaseSet(" << this << ")::InsertSet(" << &rOtherSet << ")");
+  // trivial cases: nothing to insert
+  if(rOtherSet.pSet->empty()) return;
+  if(rOtherSet.pSet==pSet) return;
   if(!mDetached) Detach();
+  // trivial case: plain copy
+  if(pSet->empty()) {
+    *pSet = *rOtherSet.pSet;
+    return;
+  }
   /*
   rm: cannot use stl since result overlaps with arguments
 
   std::insert_iterator< std::set<T,Cmp> > insit(*pSet, rpSet->begin());
   std::set_union(pSet->begin(), pSet->end(), rOtherSet.pSet->begin(), rOtherSet.pSet->end(), insit);
   */
+  // linear merge: the insertion hint is the immediate successor, i.e. amortized constant
+  Cmp cmp;
   iterator it1 = pSet->begin();
   iterator it2 = rOtherSet.pSet->begin();
   while ((it1 != pSet->end()) && (it2 != rOtherSet.pSet->end())) {
-    if (*it1 < *it2) {
+    if (cmp(*it1,*it2)) {
       ++it1;
     }
-    else if (*it1 == *it2) {
+    else if (!cmp(*it2,*it1)) {
       ++it1;
       ++it2;
     }
     else { // (*it1 > *it2)
-      pSet->insert(*it2);
+      pSet->insert(it1,*it2);
       ++it2;
     }
   }
   while (it2 != rOtherSet.pSet->end()) {
-    pSet->insert(*it2);
+    pSet->insert(pSet->end(),*it2);
     ++it2;
   }
 }
@@ -2104,15 +2158,23 @@ TEMP typename THIS::Iterator THIS::Erase(const Iterator& pos) {
 //EraseSet(set)
 TEMP void THIS::EraseSet(const TBaseSet& rOtherSet) {
   FD_DC("TBaseSet(" << this << ")::EraseSet(" << &rOtherSet << ")");
+  // trivial cases
+  if(pSet->empty()) return;
+  if(rOtherSet.pSet->empty()) return;
   if(!mDetached) Detach();
-  // TODO: test and optimize 
+  if(rOtherSet.pSet==pSet) {
+    pSet->clear();
+    return;
+  }
+  // merge, skip ranges by log-n search
+  Cmp cmp;
   iterator it = pSet->begin();
   iterator oit = rOtherSet.pSet->begin();
   while ((it != pSet->end()) && (oit != rOtherSet.pSet->end())) {
-    if (*it < *oit) {
+    if (cmp(*it,*oit)) {
       it=pSet->lower_bound(*oit); // alt: ++it;
     }
-    else if (*it == *oit) { 
+    else if (!cmp(*oit,*it)) { 
       ++oit;
       pSet->erase(it++);
     }
@@ -2126,15 +2188,21 @@ TEMP void THIS::EraseSet(const TBaseSet& rOtherSet) {
 //RestrictSet(set)
 TEMP void THIS::RestrictSet(const TBaseSet& rOtherSet) {
   FD_DC("TBaseSet(" << this << ")::RestrictSet(" << &rOtherSet << ")");
+  // trivial cases
+  if(rOtherSet.pSet==pSet) return;
+  if(pSet->empty()) return;
   if(!mDetached) Detach();
-  // TODO: test and optimize 
+  // merge, erase ranges of elements not in other set
+  Cmp cmp;
   iterator it = pSet->begin();
   iterator oit = rOtherSet.pSet->begin();
   while ((it != pSet->end()) && (oit != rOtherSet.pSet->end())) {
-    if (*it < *oit) {
-      pSet->erase(it++);
+    if (cmp(*it,*oit)) {
+      iterator del = it;
+      it=pSet->lower_bound(*oit);
+      pSet->erase(del,it);
     }
-    else if (*it == *oit) { 
+    else if (!cmp(*oit,*it)) { 
       ++it;
       ++oit;
     }
@@ -2142,9 +2210,41 @@ TEMP void THIS::RestrictSet(const TBaseSet& rOtherSet) {
       oit=rOtherSet.pSet->lower_bound(*it); 
     }
   }
-  while(it != pSet->end()) {
-    pSet->erase(it++);
-  }
+  pSet->erase(it,pSet->end());
+}
+
+
+// DoSetUnion(set, set)
+TEMP void THIS::DoSetUnion(const TBaseSet& rSetA, const TBaseSet& rSetB) {
+  FD_DC("TBaseSet(" << this << ")::DoSetUnion(" << &rSetA << ", " << &rSetB << ")");
+  // release data without copy
+  THIS::Clear();
+  Detach();
+  // sorted insertion with hint at end is amortized constant
+  std::set_union(rSetA.pSet->begin(), rSetA.pSet->end(), rSetB.pSet->begin(), rSetB.pSet->end(), 
+    std::inserter(*pSet, pSet->end()), Cmp());
+}
+
+// DoSetIntersection(set, set)
+TEMP void THIS::DoSetIntersection(const TBaseSet& rSetA, const TBaseSet& rSetB) {
+  FD_DC("TBaseSet(" << this << ")::DoSetIntersection(" << &rSetA << ", " << &rSetB << ")");
+  // release data without copy
+  THIS::Clear();
+  Detach();
+  // sorted insertion with hint at end is amortized constant
+  std::set_intersection(rSetA.pSet->begin(), rSetA.pSet->end(), rSetB.pSet->begin(), rSetB.pSet->end(), 
+    std::inserter(*pSet, pSet->end()), Cmp());
+}
+
+// DoSetDifference(set, set)
+TEMP void THIS::DoSetDifference(const TBaseSet& rSetA, const TBaseSet& rSetB) {
+  FD_DC("TBaseSet(" << this << ")::DoSetDifference(" << &rSetA << ", " << &rSetB << ")");
+  // release data without copy
+  THIS::Clear();
+  Detach();
+  // sorted insertion with hint at end is amortized constant
+  std::set_difference(rSetA.pSet->begin(), rSetA.pSet->end(), rSetB.pSet->begin(), rSetB.pSet->end(), 
+    std::inserter(*pSet, pSet->end()), Cmp());
 }
 
 
@@ -2182,23 +2282,23 @@ TEMP bool  THIS::Exists(const T& rElem) const {
 
 // operator+
 TEMP THIS THIS::operator+ (const TBaseSet& rOtherSet) const {
-  TBaseSet res(*this);
-  res.InsertSet(rOtherSet);
+  TBaseSet res;
+  res.DoSetUnion(*this,rOtherSet);
   return res;
 }
 
 // operator-
 TEMP THIS THIS::operator- (const TBaseSet& rOtherSet) const {
-  TBaseSet res(*this);
-  res.EraseSet(rOtherSet);
+  TBaseSet res;
+  res.DoSetDifference(*this,rOtherSet);
   return res;
 }
 
      
 // operator*
 TEMP THIS THIS::operator* (const TBaseSet& rOtherSet) const {
-  TBaseSet res(*this);
-  res.RestrictSet(rOtherSet);
+  TBaseSet res;
+  res.DoSetIntersection(*this,rOtherSet);
   return res;
 }
 
@@ -290,6 +290,22 @@ void vBaseVector::Erase(const Position& pos) {
   mVector.erase(pit);
 }
 
+// take (erase without delete)
+Type* vBaseVector::Take(const Position& pos) {
+#ifdef FAUDES_CHECKED
+  if(pos >= mVector.size()) {
+    std::stringstream errstr;
+    errstr << "index out of range" << std::endl;
+    throw Exception("vBaseVector::Take", errstr.str(), 62);
+  }
+#endif
+  iterator pit=mVector.begin()+pos;
+  Type* res=pit->pElement;
+  if(!pit->mMine) res=res->Copy();
+  mVector.erase(pit);
+  return res;
+}
+
 
 // insert (copy)
 void vBaseVector::Insert(const Position& pos, const Type& rElem) {
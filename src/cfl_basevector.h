@@ -32,6 +32,7 @@
 #include "cfl_attributes.h"
 #include <vector>
 #include <algorithm>
+#include <utility>
 
 // fix mingw toochain
 #ifdef THIS
@@ -273,6 +274,21 @@ public:
    */
   virtual void Erase(const Position& pos); 
 
+  /** 
+   * Take entry by position.
+   * The entry is removed from the vector without being destructed and the
+   * caller becomes the owner of the returned object. If the vector did not own
+   * the entry, a copy is returned and the original entry remains untouched.
+   *
+   * @param pos
+   *    Specify entry to take
+   * @return
+   *    Entry, to be deleted by the caller
+   * @exception Exception
+   *   - Position out of range (id 62)
+   */
+  virtual Type* Take(const Position& pos);
+
   /** 
    * Insert specified entry.
    * This method takes a copy of the entry to be inserted and the
@@ -622,6 +638,7 @@ public:
   using vBaseVector::operator!=;
   using vBaseVector::Insert;
   using vBaseVector::Erase;
+  using vBaseVector::Append;
 
   /**
    * Constructor. 
@@ -770,6 +787,69 @@ public:
    *    Iterator to element to erase
    */
   virtual Iterator Erase(const Iterator& vit);
+
+  /** 
+   * Append specified entry by move.
+   * The vector becomes the owner of a new entry of the same type as the
+   * specified element, which receives the data of the specified element. 
+   * For element types that provide a destructive copy Move(), e.g. generators,
+   * this avoids to copy the data. The specified element is invalidated.
+   *
+   * @param rElem
+   *    Element to append
+   */
+  void Append(T&& rElem);
+
+  /** 
+   * Insert specified entry by move.
+   * See also Append(T&&).
+   *
+   * @param pos
+   *    Position at which to insert
+   * @param rElem
+   *    Element to insert
+   * @exception Exception
+   *   - Position out of range (id 62)
+   */
+  void Insert(const Position& pos, T&& rElem);
+
+  /** 
+   * Construct entry in place.
+   * A new entry is appended and constructed with the specified arguments, e.g.,
+   * a file name to read from. The vector owns the new entry.
+   *
+   * @param args
+   *    Arguments passed to the element constructor
+   * @return
+   *    Reference to new entry
+   */
+  template<class... Args> T& Emplace(Args&&... args);
+
+  /** 
+   * Take entry by position.
+   * The entry is removed from the vector without being destructed and the
+   * caller becomes the owner. See also vBaseVector::Take().
+   *
+   * @param pos
+   *    Specify entry to take
+   * @return
+   *    Entry, to be deleted by the caller
+   * @exception Exception
+   *   - Position out of range (id 62)
+   */
+  virtual T* Take(const Position& pos);
+
+  /** 
+   * Take entry by position and move it to the specified destination.
+   *
+   * @param pos
+   *    Specify entry to take
+   * @param rElem
+   *    Destination
+   * @exception Exception
+   *   - Position out of range (id 62)
+   */
+  void Take(const Position& pos, T& rElem);
  
    /** 
    * Iterator class, e add one layer of dereferencing.
@@ -786,11 +866,11 @@ public:
      const typename std::vector<ElementRecord>::iterator& StlIterator(void) const {return *this;};
      /** Reimplement dereference */ 
      T* operator-> (void) const {
-       return dynamic_cast<T*>(std::vector<ElementRecord>::iterator::operator*().pElement);
+       return static_cast<T*>(std::vector<ElementRecord>::iterator::operator*().pElement);
      };
      /** Reimplement derefernce */
      T& operator* (void) const {
-       return *( dynamic_cast<T*>(std::vector<ElementRecord>::iterator::operator*().pElement) );
+       return *( static_cast<T*>(std::vector<ElementRecord>::iterator::operator*().pElement) );
      };
    };
 
@@ -807,11 +887,11 @@ public:
      CIterator(const typename std::vector<ElementRecord>::const_iterator& sit) : std::vector<ElementRecord>::const_iterator(sit) {};
      /** Reimplement dereference */ 
      const T* operator-> (void) const {
-       return dynamic_cast<const T*>(std::vector<ElementRecord>::const_iterator::operator*().pElement);
+       return static_cast<const T*>(std::vector<ElementRecord>::const_iterator::operator*().pElement);
      };
      /** Reimplement derefernce */
      const T& operator* (void) const {
-       return *( dynamic_cast<const T*>(std::vector<ElementRecord>::const_iterator::operator*().pElement) );
+       return *( static_cast<const T*>(std::vector<ElementRecord>::const_iterator::operator*().pElement) );
      };
    };
 
@@ -821,6 +901,14 @@ public:
   /** Assignment method  */
   void DoAssign(const TBaseVector<T>& rSourceVector);
 
+  /** Move element data, using a destructive copy Move() if the element type provides one */
+  template<class E> static auto DoMoveElement(E& rSrc, E& rDst, int) 
+    -> decltype(rSrc.Move(rDst), void()) { rSrc.Move(rDst); }
+
+  /** Move element data, fallback to assignment */
+  template<class E> static void DoMoveElement(E& rSrc, E& rDst, long) 
+    { rDst.Assign(rSrc); }
+
 
 };
 
@@ -928,7 +1016,7 @@ TEMP const T& THIS::At(const Position& pos) const {
     throw Exception("TBaseVector::At", errstr.str(), 63);
   }
 #endif
-  return *dynamic_cast<T*>(mVector[pos].pElement);
+  return *static_cast<T*>(mVector[pos].pElement);
 }
 
 // At()
@@ -947,7 +1035,7 @@ TEMP T& THIS::At(const Position& pos) {
     throw Exception("TBaseVector::At", errstr.str(), 63);
   }
 #endif
-  return *dynamic_cast<T*>(mVector[pos].pElement);
+  return *static_cast<T*>(mVector[pos].pElement);
 }
 
 
@@ -967,6 +1055,57 @@ TEMP typename THIS::Iterator THIS::Erase(const Iterator& pit) {
   return rit; 
 };
 
+// append (move)
+TEMP void THIS::Append(T&& rElem) {
+  Insert(mVector.size(),std::move(rElem));
+}
+
+// insert (move)
+TEMP void THIS::Insert(const Position& pos, T&& rElem) {
+#ifdef FAUDES_CHECKED
+  if(pos > mVector.size()) {
+    std::stringstream errstr;
+    errstr << "index out of range" << std::endl;
+    throw Exception("TBaseVector::Insert", errstr.str(), 62);
+  }
+#endif
+  if(!ElementTry(rElem)) {
+    std::stringstream errstr;
+    errstr << "cannot cast element " << std::endl;
+    throw Exception("TBaseVector::Insert(pos,elem)", errstr.str(), 63);
+  }
+  // new element of same type, elements are guaranteed to derive from T
+  T* pelem=static_cast<T*>(rElem.New());
+  DoMoveElement<T>(rElem,*pelem,0);
+  ElementRecord elem;
+  elem.pElement = pelem;
+  elem.mMine=true;
+  elem.mFileName="";
+  mVector.insert(mVector.begin()+pos,elem);
+}
+
+// emplace
+TEMP template<class... Args> T& THIS::Emplace(Args&&... args) {
+  ElementRecord elem;
+  elem.pElement = new T(std::forward<Args>(args)...);
+  elem.mMine=true;
+  elem.mFileName="";
+  mVector.push_back(elem);
+  return *static_cast<T*>(elem.pElement);
+}
+
+// take (erase without delete)
+TEMP T* THIS::Take(const Position& pos) {
+  return static_cast<T*>(BASE::Take(pos));
+}
+
+// take (move)
+TEMP void THIS::Take(const Position& pos, T& rElem) {
+  T* pelem=Take(pos);
+  DoMoveElement<T>(*pelem,rElem,0);
+  delete pelem;
+}
+
 
 /* undefine local shortcuts */
 #undef THIS
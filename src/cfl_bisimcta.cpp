@@ -33,6 +33,7 @@
    Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
 #include "cfl_bisimcta.h"
+#include <atomic>
 
 
 // *******************************
@@ -73,7 +74,8 @@ namespace faudes {
 
 class BisimulationCTA{
 public:
-    BisimulationCTA(const Generator &rGen, const std::vector<StateSet> &rPrePartition) : mGen(&rGen), mPrePartition(rPrePartition){}
+    BisimulationCTA(const Generator &rGen, const std::vector<StateSet> &rPrePartition) :
+        mGen(&rGen), mPrePartition(rPrePartition), mThreads(BisimulationCTAThreads()){}
     virtual ~BisimulationCTA() = default;
 
     /*!
@@ -140,6 +142,9 @@ protected:
     /*! state prepartition with original state idx (the same as state label as in cited paper). Empty for trivial prepartition. */
     const std::vector<StateSet> mPrePartition;
 
+    /*! backend configuration, taken from BisimulationCTAThreads() once per invocation */
+    const unsigned int mThreads;
+
     /*! persisted data structures, see cited paper. */
     std::vector<bool> mAffected;
     std::vector<bool> mChanged;
@@ -154,14 +159,58 @@ protected:
      */
     std::vector<Idx> mPartition;
 
-private:
-
     /*!
      * \brief ComputeBisimulation
      * perform the overall iteration
      */
     void ComputeBisimulation(void);
 
+    /*!
+     * \brief ComputeSignatureRefinement
+     * Alternative to the change-tracking iteration: per round, the signature of each state, i.e., the
+     * set of pairs (event, c-value of successor) together with the own c-value, is computed for all
+     * states in parallel. States are then re-partitioned by their signatures. The iteration terminates
+     * when a round does not increase the number of classes. The resulting partition is identical to the
+     * one obtained by change tracking.
+     */
+    void ComputeSignatureRefinement(void);
+
+    /*!
+     * \brief ComputeSignatures
+     * compute signatures and their hash values for states in range [begin,end). Invoked concurrently
+     * for disjoint ranges.
+     */
+    void ComputeSignatures(Idx begin, Idx end);
+
+#ifdef FAUDES_THREADS
+    /*! synchronisation of signature worker threads, shared by all workers of one refinement */
+    struct SignaturePool {
+        faudes_mutex_t mMutex;
+        faudes_cond_t mStart;   // signalled when a new round begins or the workers shall stop
+        faudes_cond_t mDone;    // signalled when the last worker completed the current round
+        Idx mRound;             // number of the current round
+        Idx mPending;           // number of workers still busy with the current round
+        bool mStop;
+    };
+
+    /*! payload of signature worker threads */
+    struct SignatureTask {
+        BisimulationCTA* pBisim;
+        SignaturePool* pPool;
+        Idx mBegin;
+        Idx mEnd;
+    };
+
+    /*! signature worker thread entry: process the own range once per round until stopped */
+    static void* SignatureWorker(void* arg);
+#endif
+
+    /*! signatures and hash values, persisted for reuse of allocated memory */
+    std::vector< std::vector<Idx> > mSignatures;
+    std::vector<Idx> mSigHash;
+
+private:
+
     /*!
      * \brief ComputeChangedAfters
      * Compute changed afters of each affected state. (see Fig 5. in cited paper)
@@ -245,6 +294,107 @@ private:
 
 
 
+/*!
+ * \brief The SilentClosure class
+ * Encodes a generator in vector form and computes the reflexive and transitive closure
+ * w.r.t. silent transitions. Silent strongly connected components (SCCs) are collapsed
+ * first (Tarjan, iterative), such that the closure is computed once per SCC on the
+ * resulting acyclic graph, processing SCCs in reverse topological order and sharing the
+ * closure among all states of an SCC. Closures are kept as sorted vectors of SCC indices
+ * in a flat array, i.e., memory is linear in the size of the closure of the condensed graph
+ * rather than in the size of the saturated transition relation.
+ *
+ * This is the common basis of ExtendTransRel (materialised saturation) and
+ * SaturatedBisimulationCTA (on-the-fly saturation).
+ */
+class SilentClosure {
+public:
+    SilentClosure(const Generator& rGen, const EventSet& rSilent);
+
+    /*! number of states; states are encoded by 1..Size() */
+    Idx Size(void) const { return mIds.size()-1; }
+    /*! number of SCCs; SCCs are encoded by 0..SccCount()-1 in reverse topological order */
+    Idx SccCount(void) const { return mSccBegin.size()-1; }
+    /*! original state index of encoded state */
+    Idx Id(Idx q) const { return mIds[q]; }
+    /*! encoded state of original index */
+    Idx Code(Idx x) const { return std::lower_bound(mIds.begin()+1,mIds.end(),x)-mIds.begin(); }
+    /*! SCC of encoded state */
+    Idx Scc(Idx q) const { return mScc[q]; }
+
+    /*! transitions of encoded state (event by original index, target encoded) */
+    const std::pair<Idx,Idx>* TransBegin(Idx q) const { return mTrans.data()+mTransBegin[q]; }
+    const std::pair<Idx,Idx>* TransEnd(Idx q) const { return mTrans.data()+mTransBegin[q+1]; }
+    /*! encoded member states of SCC */
+    const Idx* MembersBegin(Idx c) const { return mMembers.data()+mSccBegin[c]; }
+    const Idx* MembersEnd(Idx c) const { return mMembers.data()+mSccBegin[c+1]; }
+    /*! SCCs silently reachable from SCC c (incl. c itself, sorted) */
+    const Idx* ClosureBegin(Idx c) const { return mClosure.data()+mClosureBegin[c]; }
+    const Idx* ClosureEnd(Idx c) const { return mClosure.data()+mClosureBegin[c+1]; }
+
+    /*! test for silent event */
+    bool Silent(Idx ev) const { return mSilent.Exists(ev); }
+
+private:
+    EventSet mSilent;
+    std::vector<Idx> mIds;                    // encoded state -> original index [starting with 1]
+    std::vector<Idx> mTransBegin;             // CSR offsets into mTrans
+    std::vector< std::pair<Idx,Idx> > mTrans; // (event, encoded target)
+    std::vector<Idx> mScc;                    // encoded state -> SCC
+    std::vector<Idx> mSccBegin;               // CSR offsets into mMembers
+    std::vector<Idx> mMembers;                // encoded states per SCC
+    std::vector<Idx> mClosureBegin;           // CSR offsets into mClosure
+    std::vector<Idx> mClosure;                // silently reachable SCCs per SCC
+};
+
+/*!
+ * \brief The SaturatedBisimulationCTA class
+ * Change-tracking bisimulation on the delayed (rTaskFlag == 1) or observed (rTaskFlag == 2)
+ * saturation of the given generator, incl. silent selfloops. The saturated transitions are
+ * obtained on the fly from a SilentClosure and encoded directly into the vector form
+ * used by BisimulationCTA, i.e., they are never inserted into a TransSet. Since states
+ * within one silent SCC exhibit identical saturated successors, they are represented by a single
+ * node provided that the prepartition does not separate them.
+ *
+ * The result coincides with that of BisimulationCTA applied to the generator
+ * obtained by ExtendTransRel and InstallSelfloops.
+ */
+class SaturatedBisimulationCTA : public BisimulationCTA {
+public:
+    SaturatedBisimulationCTA(const Generator& rGen, const EventSet& rSilent, const Idx& rTaskFlag, const std::vector<StateSet>& rPrePartition)
+        : BisimulationCTA(rGen,rPrePartition), mSilent(rSilent), mTaskFlag(rTaskFlag), mCollapse(false) {}
+
+    virtual void ComputePartition(std::list<StateSet>& rResult);
+
+private:
+    /*! silent events */
+    const EventSet mSilent;
+
+    /*! flag for task: 1 for delayed, 2 for observed saturation */
+    const Idx mTaskFlag;
+
+    /*! true if nodes represent silent SCCs rather than individual states */
+    bool mCollapse;
+
+    /*! original states represented by each node (flat, offsets by node) */
+    std::vector<Idx> mNodeBegin;
+    std::vector<Idx> mNodeStates;
+
+    /*!
+     * \brief EncodeData
+     * encode saturated transition relation from silent closure
+     */
+    virtual void EncodeData(void);
+
+    /*!
+     * \brief GenerateResult
+     * generate partition w.r.t. original state indices, expanding collapsed SCCs
+     */
+    void GenerateResult(std::list<StateSet>& rResult);
+};
+
+
+
 // *******************************
 // *******************************
 // topological sort
@@ -304,52 +454,148 @@ bool topoSort (const Generator& rGen, const EventSet& rEvs, std::list<Idx>& resu
 // *******************************
 
 
+// set up silent closure
+SilentClosure::SilentClosure(const Generator& rGen, const EventSet& rSilent) : mSilent(rSilent) {
+  // encode states
+  mIds.reserve(rGen.Size()+1);
+  mIds.push_back(0);
+  StateSet::Iterator sit=rGen.StatesBegin();
+  for(; sit != rGen.StatesEnd(); ++sit)
+    mIds.push_back(*sit);
+  Idx n=Size();
+  // encode transition relation as flat array (TransRel is sorted by X1, so is our encoding)
+  mTransBegin.resize(n+2,0);
+  mTrans.reserve(rGen.TransRelSize());
+  Idx q=1;
+  TransSet::Iterator tit=rGen.TransRelBegin();
+  TransSet::Iterator tit_end=rGen.TransRelEnd();
+  for(; tit != tit_end; ++tit) {
+    while(mIds[q]!=tit->X1) mTransBegin[++q]=mTrans.size();
+    mTrans.push_back(std::make_pair(tit->Ev,Code(tit->X2)));
+  }
+  while(q<=n) mTransBegin[++q]=mTrans.size();
+  // Tarjan's SCC algorithm on silent transitions, iterative to avoid deep recursion
+  const Idx undef=0;
+  std::vector<Idx> index(n+1,undef);
+  std::vector<Idx> lowlink(n+1,0);
+  std::vector<bool> onstack(n+1,false);
+  std::vector<Idx> stack;
+  std::vector< std::pair<Idx,Idx> > dfs; // (state, position in transitions)
+  mScc.resize(n+1,0);
+  mSccBegin.push_back(0);
+  mMembers.reserve(n);
+  Idx next=1;
+  for(Idx root=1; root<=n; ++root) {
+    if(index[root]!=undef) continue;
+    dfs.push_back(std::make_pair(root,mTransBegin[root]));
+    index[root]=lowlink[root]=next++;
+    stack.push_back(root);
+    onstack[root]=true;
+    while(!dfs.empty()) {
+      Idx v=dfs.back().first;
+      Idx& pos=dfs.back().second;
+      // proceed with next silent successor
+      bool descend=false;
+      for(; pos<mTransBegin[v+1]; ++pos) {
+        if(!mSilent.Exists(mTrans[pos].first)) continue;
+        Idx w=mTrans[pos].second;
+        if(index[w]==undef) {
+          index[w]=lowlink[w]=next++;
+          stack.push_back(w);
+          onstack[w]=true;
+          ++pos;
+          dfs.push_back(std::make_pair(w,mTransBegin[w]));
+          descend=true;
+          break;
+        }
+        if(onstack[w]) lowlink[v]=std::min(lowlink[v],index[w]);
+      }
+      if(descend) continue;
+      // v is done: pop SCC if root
+      if(lowlink[v]==index[v]) {
+        Idx c=mSccBegin.size()-1;
+        Idx w;
+        do {
+          w=stack.back();
+          stack.pop_back();
+          onstack[w]=false;
+          mScc[w]=c;
+          mMembers.push_back(w);
+        } while(w!=v);
+        std::sort(mMembers.begin()+mSccBegin.back(),mMembers.end());
+        mSccBegin.push_back(mMembers.size());
+      }
+      dfs.pop_back();
+      if(!dfs.empty()) {
+        Idx u=dfs.back().first;
+        lowlink[u]=std::min(lowlink[u],lowlink[v]);
+      }
+    }
+  }
+  // closure per SCC: SCCs are numbered in reverse topological order, i.e., all
+  // silent successor SCCs of c have a smaller number and their closure is available
+  Idx m=SccCount();
+  std::vector<Idx> stamp(m,m);
+  mClosureBegin.push_back(0);
+  for(Idx c=0; c<m; ++c) {
+    Idx beg=mClosure.size();
+    mClosure.push_back(c);
+    stamp[c]=c;
+    for(const Idx* mit=MembersBegin(c); mit!=MembersEnd(c); ++mit) {
+      for(const std::pair<Idx,Idx>* pit=TransBegin(*mit); pit!=TransEnd(*mit); ++pit) {
+        if(!mSilent.Exists(pit->first)) continue;
+        Idx d=mScc[pit->second];
+        if(stamp[d]==c) continue;
+        for(Idx i=mClosureBegin[d]; i<mClosureBegin[d+1]; ++i) {
+          if(stamp[mClosure[i]]==c) continue;
+          stamp[mClosure[i]]=c;
+          mClosure.push_back(mClosure[i]);
+        }
+      }
+    }
+    std::sort(mClosure.begin()+beg,mClosure.end());
+    mClosureBegin.push_back(mClosure.size());
+  }
+}
+
+
 // YT: note flag: 1 := delayed bisim;   2 := weak bisim
+// tmoor: re-implemented to compute closures on condensed silent SCCs rather than by a fixpoint
+// iteration on the transition relation; the resulting transition relation is unchanged.
 void ExtendTransRel(Generator& rGen, const EventSet& rSilent, const Idx& rFlag) {
 
   if (rSilent.Empty()) return;
-  // HELPERS:
-  TransSet::Iterator tit1;
-  TransSet::Iterator tit1_end;
-  TransSet::Iterator tit2;
-  TransSet::Iterator tit2_end;
-  TransSet newtrans;
-
-  // initialize result with original transitionrelation
-  TransSet xTrans=rGen.TransRel();
-  newtrans = rGen.TransRel(); // initialize iteration
-  // loop for fixpoint
-  while(!newtrans.Empty()) {
-    // store new transitions for next iteration
-    TransSet nextnewtrans;
-    // loop over all transitions in newtrans
-    tit1=newtrans.Begin();
-    tit1_end=newtrans.End();
-    for(;tit1!=tit1_end; ++tit1) {
-      // if it is silent add transition to non silent successor directly
-      if(rSilent.Exists(tit1->Ev)) {
-         tit2=xTrans.Begin(tit1->X2);
-         tit2_end=xTrans.End(tit1->X2);
-         for(;tit2!=tit2_end; ++tit2) {
-//         if(!rSilentAlphabet.Exists(tit2->Ev)) // tmoor 18-09-2019
-           if (!xTrans.Exists(tit1->X1,tit2->Ev,tit2->X2))
-             nextnewtrans.Insert(tit1->X1,tit2->Ev,tit2->X2);
+  SilentClosure closure(rGen,rSilent);
+  // assemble saturated relation ordered by X1-Ev-X2, i.e., we can append
+  TransSet xTrans;
+  std::vector< std::pair<Idx,Idx> > evx2;
+  Idx n=closure.Size();
+  for(Idx q=1; q<=n; ++q) {
+    evx2.clear();
+    Idx c=closure.Scc(q);
+    // all transitions from silently reachable states
+    for(const Idx* cit=closure.ClosureBegin(c); cit!=closure.ClosureEnd(c); ++cit) {
+      for(const Idx* mit=closure.MembersBegin(*cit); mit!=closure.MembersEnd(*cit); ++mit) {
+        for(const std::pair<Idx,Idx>* pit=closure.TransBegin(*mit); pit!=closure.TransEnd(*mit); ++pit) {
+          // delayed transition
+          if((rFlag != 2) || closure.Silent(pit->first)) {
+            evx2.push_back(std::make_pair(pit->first,closure.Id(pit->second)));
+            continue;
+          }
+          // observed transition (flag == 2): extend by silent successors
+          Idx d=closure.Scc(pit->second);
+          for(const Idx* dit=closure.ClosureBegin(d); dit!=closure.ClosureEnd(d); ++dit)
+            for(const Idx* xit=closure.MembersBegin(*dit); xit!=closure.MembersEnd(*dit); ++xit)
+              evx2.push_back(std::make_pair(pit->first,closure.Id(*xit)));
         }
       }
-      else if (rFlag == 2){ // in case for observed transition (flag == 2), add non-silent transition to silent successor
-          tit2=xTrans.Begin(tit1->X2);
-          tit2_end=xTrans.End(tit1->X2);
-          for(;tit2!=tit2_end; ++tit2) {
-            if(rSilent.Exists(tit2->Ev)) // silent successor
-              if (!xTrans.Exists(tit1->X1,tit1->Ev,tit2->X2))
-                nextnewtrans.Insert(tit1->X1,tit1->Ev,tit2->X2);
-         }
-      }
     }
-    // insert new transitions
-    xTrans.InsertSet(nextnewtrans);
-    // update trans for next iteration.
-    newtrans = nextnewtrans;
+    std::sort(evx2.begin(),evx2.end());
+    evx2.erase(std::unique(evx2.begin(),evx2.end()),evx2.end());
+    Idx x1=closure.Id(q);
+    std::vector< std::pair<Idx,Idx> >::const_iterator eit=evx2.begin();
+    for(;eit!=evx2.end();++eit)
+      xTrans.Inject(Transition(x1,eit->first,eit->second));
   }
   rGen.InjectTransRel(xTrans);
 }
@@ -429,6 +675,19 @@ bool topoSort(const Generator& rGen, const EventSet &rEvs, std::list<Idx>& resul
 // *****************************************************
 // *****************************************************
 
+// backend configuration: 0 for change tracking, >0 for signature refinement
+static std::atomic<unsigned int> gBisimulationCTAThreads(0);
+
+// set number of threads
+void BisimulationCTAThreads(unsigned int count){
+    gBisimulationCTAThreads=count;
+}
+
+// get number of threads
+unsigned int BisimulationCTAThreads(void){
+    return gBisimulationCTAThreads;
+}
+
 void BisimulationCTA::EncodeData(){
     mStateSize = mGen->States().Size()+1;
     mAlphSize = mGen->Alphabet().Size()+1;
@@ -633,6 +892,11 @@ void BisimulationCTA::ComputeBisimulation(){
     EncodeData();
     BISIM_VERB1("Doing FirstStepApproximation")
     FirstStepApproximation();
+    if (mThreads>0){
+        BISIM_VERB1("Doing ComputeSignatureRefinement")
+        ComputeSignatureRefinement();
+        return;
+    }
     while (std::find(mChanged.begin(),mChanged.end(),1)!=mChanged.end()){
         BISIM_VERB1("Doing ComputeChangedAfters")
         ComputeChangedAfters();
@@ -641,6 +905,189 @@ void BisimulationCTA::ComputeBisimulation(){
     }
 }
 
+// signature refinement: compute signatures of a range of states
+void BisimulationCTA::ComputeSignatures(Idx begin, Idx end){
+    std::vector<Idx> cvals;
+    for(Idx stateit=begin;stateit<end;stateit++){
+        std::vector<Idx>& sig = mSignatures[stateit];
+        sig.clear();
+        sig.push_back(mStates[stateit].c);
+        Idx sucevit = 1;
+        for(;sucevit<mAlphSize;sucevit++){
+            const std::vector<Idx>& suc = mStates[stateit].suc[sucevit];
+            if(suc.empty()) continue;
+            cvals.clear();
+            std::vector<Idx>::const_iterator sucstateit = suc.begin();
+            for(;sucstateit!=suc.end();sucstateit++)
+                cvals.push_back(mStates[*sucstateit].c);
+            std::sort(cvals.begin(),cvals.end());
+            std::vector<Idx>::const_iterator cit = cvals.begin();
+            for(;cit!=cvals.end();cit++){
+                if(cit!=cvals.begin()) if(*cit==*(cit-1)) continue;
+                sig.push_back(sucevit);
+                sig.push_back(*cit);
+            }
+        }
+        // FNV-1a style hash
+        Idx hash = 2166136261u;
+        std::vector<Idx>::const_iterator sit = sig.begin();
+        for(;sit!=sig.end();sit++){
+            hash ^= *sit;
+            hash *= 16777619u;
+        }
+        mSigHash[stateit] = hash;
+    }
+}
+
+#ifdef FAUDES_THREADS
+// signature refinement: thread entry
+void* BisimulationCTA::SignatureWorker(void* arg){
+    SignatureTask* task = static_cast<SignatureTask*>(arg);
+    SignaturePool* pool = task->pPool;
+    Idx round = 0;
+    while(true){
+        // wait for the next round
+        faudes_mutex_lock(&pool->mMutex);
+        while(pool->mRound==round && !pool->mStop)
+            faudes_cond_wait(&pool->mStart,&pool->mMutex);
+        if(pool->mStop){
+            faudes_mutex_unlock(&pool->mMutex);
+            break;
+        }
+        round = pool->mRound;
+        faudes_mutex_unlock(&pool->mMutex);
+        // process own range
+        task->pBisim->ComputeSignatures(task->mBegin,task->mEnd);
+        // report completion
+        faudes_mutex_lock(&pool->mMutex);
+        if(--pool->mPending==0) faudes_cond_signal(&pool->mDone);
+        faudes_mutex_unlock(&pool->mMutex);
+    }
+    return 0;
+}
+#endif
+
+// signature refinement: overall iteration
+void BisimulationCTA::ComputeSignatureRefinement(){
+    Idx n = mStateSize-1;
+    mSignatures.resize(mStateSize);
+    mSigHash.resize(mStateSize);
+    // number of threads, avoid tiny ranges
+    Idx tcount = mThreads;
+    if(tcount<1) tcount=1;
+    if(tcount> n/1024+1) tcount= n/1024+1;
+    std::vector<Idx> begin(tcount), end(tcount);
+    for(Idx t=0;t<tcount;t++){
+        begin[t] = 1 + (n*t)/tcount;
+        end[t] = 1 + (n*(t+1))/tcount;
+    }
+#ifdef FAUDES_THREADS
+    // start worker threads once per refinement; ranges of workers that
+    // fail to start are processed by the calling thread
+    SignaturePool pool;
+    faudes_mutex_init(&pool.mMutex);
+    faudes_cond_init(&pool.mStart);
+    faudes_cond_init(&pool.mDone);
+    pool.mRound = 0;
+    pool.mPending = 0;
+    pool.mStop = false;
+    std::vector<SignatureTask> tasks(tcount);
+    std::vector<faudes_thread_t> threads(tcount);
+    std::vector<bool> running(tcount,false);
+    Idx rcount = 0;
+    for(Idx t=1;t<tcount;t++){
+        tasks[t].pBisim = this;
+        tasks[t].pPool = &pool;
+        tasks[t].mBegin = begin[t];
+        tasks[t].mEnd = end[t];
+        running[t] = (faudes_thread_create(&threads[t],SignatureWorker,&tasks[t]) == FAUDES_THREAD_SUCCESS);
+        if(running[t]) rcount++;
+    }
+#endif
+    // hash table of class representatives (open addressing, 0 for empty)
+    Idx tsize=1;
+    while(tsize<2*n) tsize*=2;
+    std::vector<Idx> table(tsize);
+    std::vector<Idx> newc(mStateSize,0);
+    // count initial classes
+    Idx count = 0;
+    Idx c = 0;
+    std::vector<Idx>::const_iterator partit = mPartition.begin();
+    for(;partit!=mPartition.end();partit++){
+        if(mStates[*partit].c == c) continue;
+        c = mStates[*partit].c;
+        count++;
+    }
+    // iterate
+    while(true){
+        BISIM_VERB1("Doing ComputeSignatures with " << count << " classes")
+#ifdef FAUDES_THREADS
+        // release workers for this round, process own range and the ranges of
+        // workers that failed to start, wait for all workers to complete
+        faudes_mutex_lock(&pool.mMutex);
+        pool.mRound++;
+        pool.mPending = rcount;
+        faudes_cond_broadcast(&pool.mStart);
+        faudes_mutex_unlock(&pool.mMutex);
+        ComputeSignatures(begin[0],end[0]);
+        for(Idx t=1;t<tcount;t++)
+            if(!running[t]) ComputeSignatures(begin[t],end[t]);
+        faudes_mutex_lock(&pool.mMutex);
+        while(pool.mPending>0)
+            faudes_cond_wait(&pool.mDone,&pool.mMutex);
+        faudes_mutex_unlock(&pool.mMutex);
+#else
+        for(Idx t=0;t<tcount;t++)
+            ComputeSignatures(begin[t],end[t]);
+#endif
+        // re-partition by signature
+        BISIM_VERB1("Doing re-partition by signatures")
+        std::fill(table.begin(),table.end(),0);
+        Idx ncount=0;
+        Idx stateit = 1;
+        for(;stateit<mStateSize;stateit++){
+            Idx pos = mSigHash[stateit] & (tsize-1);
+            while(true){
+                Idx rep = table[pos];
+                if(rep==0){
+                    table[pos] = stateit;
+                    newc[stateit] = ++ncount;
+                    break;
+                }
+                if(mSigHash[rep]==mSigHash[stateit])
+                    if(mSignatures[rep]==mSignatures[stateit]){
+                        newc[stateit] = newc[rep];
+                        break;
+                    }
+                pos = (pos+1) & (tsize-1);
+            }
+        }
+        for(stateit=1;stateit<mStateSize;stateit++)
+            mStates[stateit].c = newc[stateit];
+        // since the own c-value is part of the signature, classes are never merged
+        if(ncount==count) break;
+        count = ncount;
+    }
+#ifdef FAUDES_THREADS
+    // stop workers
+    faudes_mutex_lock(&pool.mMutex);
+    pool.mStop = true;
+    faudes_cond_broadcast(&pool.mStart);
+    faudes_mutex_unlock(&pool.mMutex);
+    for(Idx t=1;t<tcount;t++)
+        if(running[t]) faudes_thread_join(threads[t],0);
+    faudes_cond_destroy(&pool.mDone);
+    faudes_cond_destroy(&pool.mStart);
+    faudes_mutex_destroy(&pool.mMutex);
+#endif
+    mCmax = count;
+    std::fill(mChanged.begin(),mChanged.end(),0);
+    // sort by c
+    std::sort(mPartition.begin(),mPartition.end(), [this](const Idx& state1, const Idx& state2){
+        return this->mStates[state1].c<this->mStates[state2].c;
+    });
+}
+
 void BisimulationCTA::GenerateResult(std::list<StateSet>& rResult){
     rResult.clear();
     Idx c = 0;
@@ -920,6 +1367,158 @@ void AbstractBisimulationCTA::ComputePartition(std::list<StateSet>& rResult){
 
 
 
+// *****************************************************
+// *****************************************************
+// bisimulation on saturated transitions
+// *****************************************************
+// *****************************************************
+
+void SaturatedBisimulationCTA::EncodeData(){
+    SilentClosure closure(*mGen,mSilent);
+    Idx n=closure.Size();
+
+    // encode events as in BisimulationCTA, i.e., silent events are ordinary events here
+    mAlphSize = mGen->Alphabet().Size()+1;
+    mEvents.resize(mAlphSize);
+    Idx max=0;
+    EventSet::Iterator eit= mGen->AlphabetBegin();
+    for(; eit != mGen->AlphabetEnd(); ++eit)
+      mEvents[++max]=*eit;
+
+    // prepartition per encoded state (0 for not allocated)
+    std::vector<Idx> prepart(n+1,mPrePartition.empty() ? 1 : 0);
+    for(Idx prepit=0;prepit<mPrePartition.size();prepit++){
+        StateSet::Iterator sit=mPrePartition[prepit].Begin();
+        for(;sit!=mPrePartition[prepit].End();++sit){
+            Idx q=closure.Code(*sit);
+            if(q<=n) if(closure.Id(q)==*sit) prepart[q]=prepit+1;
+        }
+    }
+    for(Idx q=1;q<=n;++q)
+        if(prepart[q]==0)
+            throw Exception("EncodeData:: ", "invalide prepartition. State "+ ToStringInteger(closure.Id(q)) + "is not allocated.", 100);
+
+    // collapse silent SCCs, unless separated by the prepartition
+    mCollapse=true;
+    for(Idx q=1;q<=n && mCollapse;++q)
+        if(prepart[q]!=prepart[*closure.MembersBegin(closure.Scc(q))]) mCollapse=false;
+    Idx nodes = mCollapse ? closure.SccCount() : n;
+    std::vector<Idx> node(n+1,0);
+    mNodeBegin.assign(1,0);
+    mNodeStates.clear();
+    mNodeStates.reserve(n);
+    for(Idx k=1;k<=nodes;++k){
+        if(mCollapse){
+            const Idx* mit=closure.MembersBegin(k-1);
+            for(;mit!=closure.MembersEnd(k-1);++mit){
+                node[*mit]=k;
+                mNodeStates.push_back(closure.Id(*mit));
+            }
+        } else {
+            node[k]=k;
+            mNodeStates.push_back(closure.Id(k));
+        }
+        mNodeBegin.push_back(mNodeStates.size());
+    }
+
+    // set up nodes
+    mStateSize = nodes+1;
+    if (mPrePartition.empty())
+        mCmax = 1;
+    else
+        mCmax = mPrePartition.size();
+    mStates.clear();
+    mStates.resize(mStateSize);
+    mPartition.resize(mStateSize-1);
+    std::vector<Idx> lastpre(mStateSize,0);
+    std::vector< std::pair<Idx,Idx> > evnode; // (encoded event, target node)
+    for(Idx k=1;k<=nodes;++k){
+        Idx q = mCollapse ? *closure.MembersBegin(k-1) : k;
+        Idx c = closure.Scc(q);
+        mPartition[k-1] = k; // trivial partition
+        mStates[k].id = k;
+        mStates[k].suc.resize(mAlphSize);
+        mStates[k].cafter.resize(mAlphSize);
+        mStates[k].c = prepart[q];
+        // saturated transitions, incl. silent selfloops
+        evnode.clear();
+        EventSet::Iterator sit=mSilent.Begin();
+        for(;sit!=mSilent.End();++sit)
+            if(mGen->Alphabet().Exists(*sit))
+                evnode.push_back(std::make_pair(*sit,k));
+        const Idx* cit=closure.ClosureBegin(c);
+        for(;cit!=closure.ClosureEnd(c);++cit){
+            const Idx* mit=closure.MembersBegin(*cit);
+            for(;mit!=closure.MembersEnd(*cit);++mit){
+                const std::pair<Idx,Idx>* pit=closure.TransBegin(*mit);
+                for(;pit!=closure.TransEnd(*mit);++pit){
+                    // delayed transition
+                    if((mTaskFlag != 2) || closure.Silent(pit->first)){
+                        evnode.push_back(std::make_pair(pit->first,node[pit->second]));
+                        continue;
+                    }
+                    // observed transition: extend by silent successors
+                    Idx d=closure.Scc(pit->second);
+                    const Idx* dit=closure.ClosureBegin(d);
+                    for(;dit!=closure.ClosureEnd(d);++dit){
+                        if(mCollapse){
+                            evnode.push_back(std::make_pair(pit->first,*dit+1));
+                            continue;
+                        }
+                        const Idx* xit=closure.MembersBegin(*dit);
+                        for(;xit!=closure.MembersEnd(*dit);++xit)
+                            evnode.push_back(std::make_pair(pit->first,*xit));
+                    }
+                }
+            }
+        }
+        // encode events (order preserving) and install successors, active events and predecessors
+        std::vector< std::pair<Idx,Idx> >::iterator pit=evnode.begin();
+        for(;pit!=evnode.end();++pit)
+            pit->first=std::lower_bound(mEvents.begin()+1,mEvents.end(),pit->first)-mEvents.begin();
+        std::sort(evnode.begin(),evnode.end());
+        evnode.erase(std::unique(evnode.begin(),evnode.end()),evnode.end());
+        pit=evnode.begin();
+        for(;pit!=evnode.end();++pit){
+            if(mStates[k].evs.empty() || mStates[k].evs.back()!=pit->first)
+                mStates[k].evs.push_back(pit->first);
+            mStates[k].suc[pit->first].push_back(pit->second);
+            if(lastpre[pit->second]!=k){
+                mStates[pit->second].pre.push_back(k);
+                lastpre[pit->second]=k;
+            }
+        }
+    }
+
+    // initialize affected and changed vector
+    mAffected.assign(mStateSize,0);
+    mChanged.assign(mStateSize,1);
+    mChanged[0] = 0;
+}
+
+void SaturatedBisimulationCTA::GenerateResult(std::list<StateSet>& rResult){
+    rResult.clear();
+    Idx c = 0;
+    StateSet eqclass;
+    std::vector<Idx>::const_iterator partit = mPartition.begin();
+    for(;partit!=mPartition.end();partit++){
+        if (mStates[*partit].c != c){
+            if (eqclass.Size()>1) rResult.push_back(eqclass);
+            eqclass.Clear();
+            c = mStates[*partit].c;
+        }
+        for(Idx i=mNodeBegin[*partit-1];i<mNodeBegin[*partit];++i)
+            eqclass.Insert(mNodeStates[i]);
+    }
+    if (eqclass.Size()>1) rResult.push_back(eqclass); // insert the last partition
+}
+
+void SaturatedBisimulationCTA::ComputePartition(std::list<StateSet>& rResult){
+    ComputeBisimulation();
+    GenerateResult(rResult);
+}
+
+
 // wrappers
 void ComputeBisimulationCTA(const Generator& rGen, std::list<StateSet>& rResult){
     std::vector<StateSet> trivial;
@@ -986,10 +1585,8 @@ void ComputeAbstractBisimulationSatCTA(
         ComputeBisimulationCTA(rGen,rResult);
     }
     else if (rSilent.Size()==1){
-        Generator xg(rGen);
-        ExtendTransRel(xg,rSilent,rFlag);
-        InstallSelfloops(xg,rSilent);
-        BisimulationCTA bisim(xg, rPrePartition);
+        // saturate on the fly (equivalent to ExtendTransRel and InstallSelfloops on a copy of rGen)
+        SaturatedBisimulationCTA bisim(rGen,rSilent,rFlag,rPrePartition);
         bisim.ComputePartition(rResult);
     }
     else throw Exception("ComputeAbstractBisimulationSatCTA::","silent alphabet can contain at most one event", 100);
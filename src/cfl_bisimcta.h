@@ -49,6 +49,29 @@
 
 namespace faudes {
 
+/*!
+ * \brief BisimulationCTAThreads
+ * Select the backend used by ComputeBisimulationCTA and the saturation based variants
+ * ComputeDelayedBisimulationSatCTA and ComputeWeakBisimulationSatCTA. The default 0 selects
+ * the sequential change-tracking algorithm. A positive count selects signature-based
+ * partition refinement, where the signatures of all states are computed by the specified
+ * number of threads per round (requires FAUDES_THREADS, otherwise signatures are computed
+ * sequentially). Worker threads are started once per invocation and are reused for all
+ * refinement rounds. Both backends yield identical partitions. The selection may be changed
+ * at any time, each invocation uses the configuration present when it starts.
+ * \param count
+ *      number of threads, or 0 for change tracking
+ */
+extern FAUDES_API void BisimulationCTAThreads(unsigned int count);
+
+/*!
+ * \brief BisimulationCTAThreads
+ * get the number of threads used for signature-based partition refinement
+ * \return
+ *      number of threads, or 0 for change tracking
+ */
+extern FAUDES_API unsigned int BisimulationCTAThreads(void);
+
 
 /*!
  * \brief FactorTauLoops
@@ -206,7 +229,7 @@ extern FAUDES_API void ComputeWeakBisimulationSatCTA(const Generator& rGen, cons
 
 
 /*!
- * \brief ComputeDelayedBisimulationCTA
+ * \brief ComputeDelayedBisimulationSatCTA
  * delayed bisimulation partition under prepartition based on change-tracking algorithm and saturation
  * \param rGen
  *      input gen
@@ -217,7 +240,7 @@ extern FAUDES_API void ComputeWeakBisimulationSatCTA(const Generator& rGen, cons
  * \param rPrePartition
  *      prepartition (trivial classes MUST be included)
  */
-extern FAUDES_API void ComputeDelayedBisimulationCTA(const Generator& rGen, const EventSet& rSilent, std::list<StateSet>& rResult, const std::vector<StateSet>& rPrePartition);
+extern FAUDES_API void ComputeDelayedBisimulationSatCTA(const Generator& rGen, const EventSet& rSilent, std::list<StateSet>& rResult, const std::vector<StateSet>& rPrePartition);
 
 /*!
  * \brief ComputeComputeWeakBisimulationSatCTA
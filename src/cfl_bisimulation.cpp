@@ -37,6 +37,8 @@
 #include <string>
 #include <sstream>
 #include <stack>
+#include <limits>
+#include <atomic>
 
 using namespace std;
 
@@ -1258,6 +1260,393 @@ void Bisimulation::writeRo(void)
 
 
 
+/*
+********************************************* 
+PART 2b: Bisimulation with flat arrays
+
+The class faudes::BisimulationPT implements the partition refinement algorithm by
+R. Paige and R.E. Tarjan ("Three partition refinement algorithms", SIAM J. Comput.,
+vol. 16, pp. 973-989, 1987) for labelled transitions in O(m log n). The data structures 
+follow A. Valmari and P. Lehtinen ("Efficient minimization of DFAs with partial 
+transition functions", STACS 2008): the current partition is a permutation of
+states with block boundaries and marked counters, and all transition related data 
+is kept in plain arrays indexed by consecutive state and event numbers. The coarser
+partition of compound blocks is refined by the "smaller half" policy, and per 
+(state, event, compound block) counters distinguish states with transitions into 
+both parts of a split compound block.
+
+********************************************* 
+*/
+
+class BisimulationPT {
+
+public:
+
+  /**
+   * Contructor: 
+   * keep a reference to the generator and initialize the partition to
+   * represent the specified prepartition, or the universal equivalence relation if
+   * no prepartition is specified.
+   *
+   * @param g
+   *   Original generator
+   * @param rPrePartition
+   *   Prepartition (each state must be included exactly once; may be empty)
+   */
+  BisimulationPT(const Generator& g, const std::vector<StateSet>& rPrePartition);
+
+  /**
+   * Perform partition refinement to obtain the coarsest bisimulation relation
+   */
+  void refine(void);
+
+  /**
+   * Extract output generator that represents the resulting quotient automaton.
+   * (need to invoke refine() befor)
+   */
+  void partition(std::map<Idx,Idx>& rMapStateToPartition, Generator& rGenPart);
+
+  /**
+   * Extract the coarsest quasi-congruence as an STL map
+   * (need to invoke refine() befor)
+   */
+  void partition(std::map<Idx,Idx>& rMapStateToPartition);
+
+  /**
+   * Extract the coarsest quasi-congruence as a list of nontrivial equivalence classes.
+   * (need to invoke refine() befor)
+   */
+  void partition(std::list< StateSet >& rPartition); 
+
+private:
+
+  /** keep reference to automaton */
+  const Generator* gen;
+
+  /** original state indices by consecutive state number 0 ... n-1 */
+  vector<Idx> sidx;
+
+  /** incoming transitions by target state (offsets, source state, event number, counter record) */
+  vector<Idx> inbeg;
+  vector<Idx> insrc;
+  vector<Idx> inev;
+  vector<Idx> inrec;
+
+  /** counter records: number of transitions per (source, event, compound block) */
+  vector<Idx> cnt;
+
+  /** refinable partition: states permutation, location and block per state */
+  vector<Idx> elems;
+  vector<Idx> loc;
+  vector<Idx> blk;
+
+  /** refinable partition: block boundaries, marked states are [first, mid) */
+  vector<Idx> first;
+  vector<Idx> mid;
+  vector<Idx> end;
+
+  /** refinable partition: blocks with marked states */
+  vector<Idx> touched;
+
+  /** compound blocks: compound per block, position of block within compound, blocks per compound */
+  vector<Idx> cmp;
+  vector<Idx> cmppos;
+  vector< vector<Idx> > cmpblocks;
+
+  /** compound blocks with more than one block */
+  vector<Idx> cmpqueue;
+  vector<bool> cmpqueued;
+
+  /** add new block to compound, schedule compound if it becomes non-trivial */
+  void addblock(Idx b, Idx c);
+
+  /** mark state for the next split */
+  void mark(Idx s);
+
+  /** split touched blocks in marked and unmarked states */
+  void split(void);
+
+};
+
+
+// Constructor BisimulationPT(g)
+BisimulationPT::BisimulationPT(const Generator& g, const std::vector<StateSet>& rPrePartition) {
+  FD_DF("BisimulationPT::BisimulationPT(" << g.Name() << ")");
+  gen = &g;
+
+  // encode states and events by consecutive numbers
+  sidx.reserve(gen->States().Size());
+  StateSet::Iterator sit=gen->StatesBegin();
+  for(; sit != gen->StatesEnd(); ++sit) sidx.push_back(*sit);
+  vector<Idx> events;
+  events.reserve(gen->Alphabet().Size());
+  EventSet::Iterator eit=gen->AlphabetBegin();
+  for(; eit != gen->AlphabetEnd(); ++eit) events.push_back(*eit);
+  Idx n=sidx.size();
+
+  // encode transitions, one counter record per (source, event); TransRel is sorted by X1-Ev-X2
+  Idx m=gen->TransRelSize();
+  vector<Idx> tsrc, tev, ttrg;
+  tsrc.reserve(m);
+  tev.reserve(m);
+  ttrg.reserve(m);
+  vector<Idx> trec;
+  trec.reserve(m);
+  vector< vector<Idx> > active(events.size()); // states with outgoing transitions per event
+  TransSet::Iterator tit=gen->TransRelBegin();
+  TransSet::Iterator tit_end=gen->TransRelEnd();
+  for(; tit != tit_end; ++tit) {
+    Idx x1 = std::lower_bound(sidx.begin(),sidx.end(),tit->X1)-sidx.begin();
+    Idx ev = std::lower_bound(events.begin(),events.end(),tit->Ev)-events.begin();
+    Idx x2 = std::lower_bound(sidx.begin(),sidx.end(),tit->X2)-sidx.begin();
+    if(tsrc.empty() || tsrc.back()!=x1 || tev.back()!=ev) {
+      cnt.push_back(0);
+      active[ev].push_back(x1);
+    }
+    cnt.back()++;
+    tsrc.push_back(x1);
+    tev.push_back(ev);
+    ttrg.push_back(x2);
+    trec.push_back(cnt.size()-1);
+  }
+  inbeg.assign(n+1,0);
+  for(Idx t=0; t<m; ++t) inbeg[ttrg[t]+1]++;
+  for(Idx x=0; x<n; ++x) inbeg[x+1]+=inbeg[x];
+  insrc.resize(m);
+  inev.resize(m);
+  inrec.resize(m);
+  vector<Idx> pos(inbeg.begin(),inbeg.end()-1);
+  for(Idx t=0; t<m; ++t) {
+    Idx i = pos[ttrg[t]]++;
+    insrc[i]=tsrc[t];
+    inev[i]=tev[t];
+    inrec[i]=trec[t];
+  }
+
+  // initial partition: universe or prepartition
+  elems.resize(n);
+  loc.resize(n);
+  blk.assign(n,0);
+  if(rPrePartition.empty()) {
+    for(Idx x=0; x<n; ++x) { elems[x]=x; loc[x]=x;}
+    if(n>0) { first.push_back(0); mid.push_back(0); end.push_back(n);}
+  } else {
+    vector<bool> done(n,false);
+    Idx i=0;
+    for(Idx b=0; b<rPrePartition.size(); ++b) {
+      first.push_back(i);
+      mid.push_back(i);
+      StateSet::Iterator pit=rPrePartition[b].Begin();
+      for(; pit != rPrePartition[b].End(); ++pit) {
+        Idx x=std::lower_bound(sidx.begin(),sidx.end(),*pit)-sidx.begin();
+        if(x>=n) continue;
+        if(sidx[x]!=*pit || done[x]) continue;
+        done[x]=true;
+        elems[i]=x; loc[x]=i; blk[x]=first.size()-1;
+        ++i;
+      }
+      end.push_back(i);
+      if(first.back()==end.back()) { first.pop_back(); mid.pop_back(); end.pop_back();}
+    }
+    if(i!=n)
+      throw Exception("BisimulationPT::BisimulationPT", "invalid prepartition", 100);
+  }
+
+  // all blocks form one compound block
+  cmpblocks.push_back(vector<Idx>());
+  cmpqueued.push_back(false);
+  for(Idx b=0; b<first.size(); ++b) addblock(b,0);
+
+  // stabilise wrt the universe: separate states by active events
+  for(Idx ev=0; ev<events.size(); ++ev) {
+    vector<Idx>::iterator ait=active[ev].begin();
+    for(; ait!=active[ev].end(); ++ait) mark(*ait);
+    split();
+  }
+  FD_DF("BisimulationPT::BisimulationPT: leaving function");
+}
+
+// add block to compound
+void BisimulationPT::addblock(Idx b, Idx c) {
+  if(cmp.size()<=b) { cmp.resize(b+1); cmppos.resize(b+1);}
+  cmp[b]=c;
+  cmppos[b]=cmpblocks[c].size();
+  cmpblocks[c].push_back(b);
+  if(cmpblocks[c].size()>1 && !cmpqueued[c]) {
+    cmpqueued[c]=true;
+    cmpqueue.push_back(c);
+  }
+}
+
+// mark state
+void BisimulationPT::mark(Idx s) {
+  Idx b=blk[s];
+  Idx i=loc[s];
+  Idx j=mid[b];
+  if(i<j) return;
+  if(j==first[b]) touched.push_back(b);
+  Idx t=elems[j];
+  elems[j]=s; loc[s]=j;
+  elems[i]=t; loc[t]=i;
+  mid[b]=j+1;
+}
+
+// split touched blocks: marked states form a new block within the same compound
+void BisimulationPT::split(void) {
+  vector<Idx>::iterator bit=touched.begin();
+  for(; bit!=touched.end(); ++bit) {
+    Idx b=*bit;
+    if(mid[b]==end[b]) { mid[b]=first[b]; continue; }
+    Idx nb=first.size();
+    first.push_back(first[b]);
+    mid.push_back(first[b]);
+    end.push_back(mid[b]);
+    for(Idx i=first[nb]; i<end[nb]; ++i) blk[elems[i]]=nb;
+    first[b]=mid[b];
+    addblock(nb,cmp[b]);
+  }
+  touched.clear();
+}
+
+// BisimulationPT::refine()
+void BisimulationPT::refine(void) {
+  FD_DF("BisimulationPT::refine()");
+  Idx n=sidx.size();
+  const Idx none=std::numeric_limits<Idx>::max();
+  vector<Idx> newrec(n,none);
+  vector<Idx> oldrec(n,none);
+  vector< vector<Idx> > bucket(gen->Alphabet().Size());
+  vector<Idx> evtouched;
+  vector<Idx> bstates;
+  vector<Idx> xs;
+  while(!cmpqueue.empty()) {
+    // be interruptable
+    FD_WPC(first.size(), n, "BisimulationPT: blocks/states: " << first.size() << " / " << n);
+    // pick compound block S with at least two blocks
+    Idx S=cmpqueue.back();
+    cmpqueue.pop_back();
+    cmpqueued[S]=false;
+    vector<Idx>& sblocks=cmpblocks[S];
+    if(sblocks.size()<2) continue;
+    // pick smaller of the last two blocks and move it to a compound of its own
+    Idx B=sblocks[sblocks.size()-1];
+    Idx B2=sblocks[sblocks.size()-2];
+    if(end[B2]-first[B2] < end[B]-first[B]) B=B2;
+    Idx last=sblocks.back();
+    sblocks[cmppos[B]]=last;
+    cmppos[last]=cmppos[B];
+    sblocks.pop_back();
+    if(sblocks.size()>1) { cmpqueued[S]=true; cmpqueue.push_back(S);}
+    cmpblocks.push_back(vector<Idx>());
+    cmpqueued.push_back(false);
+    addblock(B,cmpblocks.size()-1);
+    // collect incoming transitions of B by event (B may be split while processing)
+    bstates.assign(elems.begin()+first[B],elems.begin()+end[B]);
+    vector<Idx>::iterator sit=bstates.begin();
+    for(; sit!=bstates.end(); ++sit) {
+      for(Idx t=inbeg[*sit]; t<inbeg[*sit+1]; ++t) {
+        if(bucket[inev[t]].empty()) evtouched.push_back(inev[t]);
+        bucket[inev[t]].push_back(t);
+      }
+    }
+    // refine wrt B and S minus B, one event at a time
+    vector<Idx>::iterator eit=evtouched.begin();
+    for(; eit!=evtouched.end(); ++eit) {
+      vector<Idx>& tb=bucket[*eit];
+      // move transitions to counter records for B
+      xs.clear();
+      vector<Idx>::iterator tit=tb.begin();
+      for(; tit!=tb.end(); ++tit) {
+        Idx x=insrc[*tit];
+        if(newrec[x]==none) {
+          newrec[x]=cnt.size();
+          cnt.push_back(0);
+          oldrec[x]=inrec[*tit];
+          xs.push_back(x);
+        }
+        cnt[newrec[x]]++;
+        cnt[inrec[*tit]]--;
+        inrec[*tit]=newrec[x];
+      }
+      // split by predecessors of B
+      vector<Idx>::iterator xit=xs.begin();
+      for(; xit!=xs.end(); ++xit) mark(*xit);
+      split();
+      // split by predecessors of B that are no predecessors of S minus B
+      for(xit=xs.begin(); xit!=xs.end(); ++xit)
+        if(cnt[oldrec[*xit]]==0) mark(*xit);
+      split();
+      // reset
+      for(xit=xs.begin(); xit!=xs.end(); ++xit) newrec[*xit]=none;
+      tb.clear();
+    }
+    evtouched.clear();
+  }
+  FD_DF("BisimulationPT::refine(): blocks #" << first.size());
+}
+
+// BisimulationPT::partition(rMapStateToPartition, rGenPart)
+void BisimulationPT::partition(std::map<Idx,Idx>& rMapStateToPartition, Generator& rGenPart) {
+  FD_DF("BisimulationPT::partition(rMapStateToPartition," << rGenPart.Name() << ")");
+  // prepare result  
+  rGenPart.Clear();
+  rMapStateToPartition.clear();
+  // one state per block
+  for(Idx b=0; b<first.size(); ++b) {
+    std::ostringstream ostr;
+    Idx newstate = rGenPart.InsState();        
+    for(Idx i=first[b]; i<end[b]; ++i) {
+      Idx st=sidx[elems[i]];
+      rMapStateToPartition[st] = newstate;       
+      if(rGenPart.StateNamesEnabled()) { 
+        if(gen->StateName(st)!="") ostr << gen->StateName(st) << ",";
+        else ostr << st << ",";
+      }
+      if(gen->ExistsInitState(st)) 
+  	rGenPart.SetInitState(newstate);
+      if(gen->ExistsMarkedState(st)) 
+ 	rGenPart.SetMarkedState(newstate);
+    }
+    if(rGenPart.StateNamesEnabled()) {
+      std::string statename = ostr.str();
+      if(statename.length()>=1) statename.erase(statename.length()-1);
+      statename = "{" + statename + "}";
+      rGenPart.StateName(newstate, statename); 
+    }
+  }
+  // transition relation
+  TransSet::Iterator tIt = gen->TransRelBegin();
+  TransSet::Iterator tItEnd = gen->TransRelEnd();
+  for(; tIt != tItEnd; ++tIt) {
+    rGenPart.InsEvent(tIt->Ev);
+    rGenPart.SetTransition(rMapStateToPartition[tIt->X1], tIt->Ev, rMapStateToPartition[tIt->X2]);
+  }
+  FD_DF("BisimulationPT::partition: leaving function");
+}
+
+// BisimulationPT::partition(rMapStateToPartition)
+void BisimulationPT::partition(std::map<Idx,Idx>& rMapStateToPartition) {
+  FD_DF("BisimulationPT::partition(rMapStateToPartition)");
+  rMapStateToPartition.clear();
+  for(Idx b=0; b<first.size(); ++b) 
+    for(Idx i=first[b]; i<end[b]; ++i) 
+      rMapStateToPartition[sidx[elems[i]]] = b+1;
+}
+
+// BisimulationPT::partition(rPartition)
+void BisimulationPT::partition(std::list< StateSet >& rPartition) {
+  FD_DF("BisimulationPT::partition(rPartition)");
+  rPartition.clear();
+  for(Idx b=0; b<first.size(); ++b) {
+    if(end[b]-first[b]<=1) continue;
+    StateSet tb;
+    for(Idx i=first[b]; i<end[b]; ++i) tb.Insert(sidx[elems[i]]);
+    rPartition.push_back(tb);
+  }
+}
+
+
+
 /*
 ********************************************* 
 ********************************************* 
@@ -1268,10 +1657,35 @@ Minimal application interface based on plain functions.
 ********************************************* 
 */
 
+// algorithm selection: 0 for "fernandez", 1 for "paigetarjan" (atomic for concurrent access)
+static std::atomic<int> gBisimulationAlgorithm(0);
+
+// BisimulationAlgorithm(rAlgorithm)
+void BisimulationAlgorithm(const std::string& rAlgorithm) {
+  if((rAlgorithm!="fernandez") && (rAlgorithm!="paigetarjan")) {
+    std::stringstream errstr;
+    errstr << "unknown algorithm \"" << rAlgorithm << "\"";
+    throw Exception("BisimulationAlgorithm", errstr.str(), 100);
+  }
+  gBisimulationAlgorithm = (rAlgorithm=="paigetarjan" ? 1 : 0);
+}
+
+// BisimulationAlgorithm()
+std::string BisimulationAlgorithm(void) {
+  return gBisimulationAlgorithm==1 ? "paigetarjan" : "fernandez";
+}
+
 // ComputeBisimulation(rGenOrig, rMapStateToPartition)
 void ComputeBisimulation(const Generator& rGenOrig, map<Idx,Idx>& rMapStateToPartition)
 {
   FD_DF("ComputeBisimulation(" << rGenOrig.Name() << ", rMapStateToPartition)");
+  // flat array variant
+  if(gBisimulationAlgorithm==1) {
+    BisimulationPT bisim(rGenOrig,std::vector<StateSet>());
+    bisim.refine();
+    bisim.partition(rMapStateToPartition);
+    return;
+  }
   // Construct an instance of the Bisimulation class from rGenOrig
   Bisimulation bisim = Bisimulation(rGenOrig);
   // method to compute the bisimulation on rGenOrig
@@ -1289,6 +1703,13 @@ void ComputeBisimulation(const Generator& rGenOrig, map<Idx,Idx>& rMapStateToPar
 void ComputeBisimulation(const Generator& rGenOrig, map<Idx,Idx>& rMapStateToPartition, Generator& rGenPart)
 {
   FD_DF("ComputeBisimulation(" << rGenOrig.Name() << ", rMapStateToPartition, " << rGenPart.Name() << ")");
+  // flat array variant
+  if(gBisimulationAlgorithm==1) {
+    BisimulationPT bisim(rGenOrig,std::vector<StateSet>());
+    bisim.refine();
+    bisim.partition(rMapStateToPartition, rGenPart);
+    return;
+  }
   // Construct an instance of the Bisimulation class from rGenOrig
   Bisimulation bisim = Bisimulation(rGenOrig);
   // method to compute the bisimulation on rGenOrig
@@ -1306,6 +1727,13 @@ void ComputeBisimulation(const Generator& rGenOrig, map<Idx,Idx>& rMapStateToPar
 void ComputeBisimulation(const Generator& rGenOrig, std::list< StateSet >& rPartition)
 {
   FD_DF("ComputeBisimulation(" << rGenOrig.Name() << ", rPartition)");
+  // flat array variant
+  if(gBisimulationAlgorithm==1) {
+    BisimulationPT bisim(rGenOrig,std::vector<StateSet>());
+    bisim.refine();
+    bisim.partition(rPartition);
+    return;
+  }
   // Construct an instance of the Bisimulation class from rGenOrig
   Bisimulation bisim = Bisimulation(rGenOrig);
   // method to compute the bisimulation on rGenOrig
@@ -41,11 +41,44 @@
 
 #include <vector>
 #include <map>
+#include <string>
 
 
 
 namespace faudes {
 
+/**
+* Select the algorithm to be used by ComputeBisimulation.
+*
+* The following choices are available:
+* - "fernandez": binary-tree of cosets with info-maps as described by J.-C. Fernandez (default)
+* - "paigetarjan": O(m log n) partition refinement by R. Paige and R.E. Tarjan with flat arrays
+*   and "smaller half" splitting as suggested by A. Valmari and P. Lehtinen
+*
+* Both algorithms compute the same partition. The choice applies globally to all 
+* subsequent invocations of ComputeBisimulation, incl. those by other threads. It may be 
+* changed at any time; each invocation uses the algorithm selected when it starts.
+*
+* @param rAlgorithm
+*   Name of the algorithm
+*
+* @exception Exception
+*   Unknown algorithm (id 100)
+*
+* @ingroup GeneratorFunctions
+*/
+extern FAUDES_API void BisimulationAlgorithm(const std::string& rAlgorithm);
+
+/**
+* Report the algorithm to be used by ComputeBisimulation.
+*
+* @return
+*   Name of the algorithm, see BisimulationAlgorithm(const std::string&) 
+*
+* @ingroup GeneratorFunctions
+*/
+extern FAUDES_API std::string BisimulationAlgorithm(void);
+
 /**
 * Computation of the coarsest bisimulation relation for a specified generator. 
 *
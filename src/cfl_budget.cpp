@@ -0,0 +1,143 @@
+/** @file cfl_budget.cpp @brief Execution budget for operations on generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_budget.h"
+#include "cfl_exception.h"
+#include <sstream>
+
+namespace faudes {
+
+// innermost active budget per thread
+static FAUDES_TLS ExecutionBudget* gpCurrentBudget=0;
+
+// construct and activate
+ExecutionBudget::ExecutionBudget(void) :
+  mMaxTime(0),
+  mMaxStates(0),
+  mMaxTransitions(0),
+  mMaxMemory(0),
+  mPartialResult(false),
+  mExceeded(false),
+  mElapsed(0),
+  mStates(0),
+  mTransitions(0),
+  mMemory(0),
+  mChecks(0),
+  mMemoryStart(faudes_memusage()),
+  mpPrevious(gpCurrentBudget)
+{
+#ifdef FAUDES_SYSTIME
+  faudes_gettimeofday(&mStart);
+#endif
+  gpCurrentBudget=this;
+}
+
+// deactivate
+ExecutionBudget::~ExecutionBudget(void) {
+  // budgets are strictly nested by scope
+  if(gpCurrentBudget==this) gpCurrentBudget=mpPrevious;
+}
+
+// innermost active budget
+ExecutionBudget* ExecutionBudget::Current(void) {
+  return gpCurrentBudget;
+}
+
+// probe time and memory
+void ExecutionBudget::DoProbe(bool memory) {
+#ifdef FAUDES_SYSTIME
+  faudes_systime_t now;
+  faudes_gettimeofday(&now);
+  faudes_mstime_t lap;
+  faudes_diffsystime(now,mStart,&lap);
+  mElapsed=lap;
+  if(mMaxTime>0 && mElapsed>mMaxTime && !mExceeded) {
+    mExceeded=true;
+    mReason="time";
+  }
+#endif
+  if(!memory || mMaxMemory==0) return;
+  std::size_t usage=faudes_memusage();
+  mMemory= usage>mMemoryStart ? usage-mMemoryStart : 0;
+  if(mMemory>mMaxMemory && !mExceeded) {
+    mExceeded=true;
+    mReason="memory";
+  }
+}
+
+// check this budget
+bool ExecutionBudget::DoCheck(Idx states, Idx transitions) {
+  ++mChecks;
+  if(states>mStates) mStates=states;
+  if(transitions>mTransitions) mTransitions=transitions;
+  if(mExceeded) return true;
+  if(mMaxStates>0 && states>mMaxStates) {
+    mExceeded=true;
+    mReason="states";
+    return true;
+  }
+  if(mMaxTransitions>0 && transitions>mMaxTransitions) {
+    mExceeded=true;
+    mReason="transitions";
+    return true;
+  }
+  if((mChecks & 0xf)==0) DoProbe((mChecks & 0x3ff)==0);
+  return mExceeded;
+}
+
+// check all active budgets
+bool ExecutionBudget::Check(Idx states, Idx transitions) {
+  ExecutionBudget* budget=gpCurrentBudget;
+  if(!budget) return false;
+  bool exceeded=false;
+  for(;budget;budget=budget->mpPrevious)
+    if(budget->DoCheck(states,transitions)) exceeded=true;
+  return exceeded;
+}
+
+// abort on exceeded budget
+void ExecutionBudget::Abort(const std::string& rFunction, Type& rResult) {
+  // find innermost exceeded budget
+  ExecutionBudget* budget=gpCurrentBudget;
+  for(;budget;budget=budget->mpPrevious)
+    if(budget->mExceeded) break;
+  if(!budget) return;
+  // final statistics
+  budget->DoProbe(true);
+  // partial or empty result
+  if(!budget->mPartialResult) rResult.Clear();
+  std::stringstream errstr;
+  errstr << "execution budget exceeded (" << budget->mReason << "): " << budget->Statistics();
+  throw Exception(rFunction, errstr.str(), 111);
+}
+
+// statistics report
+std::string ExecutionBudget::Statistics(void) const {
+  std::stringstream res;
+  res << "time " << mElapsed << "ms, states " << mStates << ", transitions " << mTransitions;
+  if(mMaxMemory>0) res << ", memory " << mMemory/1024 << "kB";
+  res << ", checks " << mChecks;
+  return res.str();
+}
+
+
+} // namespace faudes
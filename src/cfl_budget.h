@@ -0,0 +1,219 @@
+/** @file cfl_budget.h @brief Execution budget for operations on generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_BUDGET_H
+#define FAUDES_BUDGET_H
+
+#include "cfl_definitions.h"
+#include "cfl_platform.h"
+#include "cfl_types.h"
+#include <string>
+
+namespace faudes {
+
+/**
+ * Execution budget.
+ *
+ * An ExecutionBudget limits the resources an operation may consume, namely wall time,
+ * the number of states and transitions of the result under construction, and
+ * memory. The budget is active for the current thread from its construction to its
+ * destruction, so a per-call budget is conveniently set up as a local variable.
+ * Operations that support budgets, i.e., Parallel(), Product(), Deterministic(),
+ * SupCon() and PseudoDet(), check the budget in their main loop. When a limit is
+ * exceeded, the operation stops exploring, sets its result parameter and throws an
+ * exception (id 111). The result is the part explored so far if PartialResult() is
+ * set, and empty otherwise. Statistics remain available from the budget object.
+ *
+ * @code
+ * {
+ *   ExecutionBudget budget;
+ *   budget.MaxTime(500);
+ *   budget.MaxStates(100000);
+ *   budget.PartialResult(true);
+ *   try {
+ *     Parallel(g1,g2,res);
+ *   } catch(const Exception& ex) {
+ *     if(ex.Id()!=111) throw;
+ *     std::cout << budget.Statistics() << std::endl;
+ *   }
+ * }
+ * @endcode
+ *
+ * The state and transition limits apply to each individual operation, whereas time and
+ * memory are accounted from the construction of the budget. Thus, when a budget
+ * covers a sequence of operations, e.g. a composition of many components, the time
+ * limit refers to the sequence as a whole. Once exceeded, a budget stays exceeded, and any
+ * further operation within its scope stops immediately. For SupCon(), the partial
+ * result is the explored part of the product composition and in general not controllable.
+ *
+ * Technical notes: checks are cheap when no budget is active. With an active
+ * budget, the state and transition counts are compared on every check, while the
+ * clock and the memory usage are probed every 16 and every 1024 checks, respectively. Time
+ * limits require the systime option (FAUDES_SYSTIME). Memory usage refers to the resident set
+ * size of the process relative to the construction of the budget, and it is only
+ * available on Linux. Budgets may be nested, in which case all budgets in scope are checked.
+ * In contrast to LoopCallback(), which is only invoked for builds with progress
+ * reports (FAUDES_WRITE_PROGRESS), budgets are always supported.
+ *
+ * @ingroup GeneratorFunctions
+ */
+class FAUDES_API ExecutionBudget {
+public:
+
+  /** Construct unlimited budget and activate it for the current thread */
+  ExecutionBudget(void);
+
+  /** Deactivate budget */
+  ~ExecutionBudget(void);
+
+  /** Set time limit in milliseconds (0 for unlimited) */
+  void MaxTime(long int msecs) { mMaxTime=msecs; };
+
+  /** Get time limit in milliseconds */
+  long int MaxTime(void) const { return mMaxTime; };
+
+  /** Set limit on the number of states per operation (0 for unlimited) */
+  void MaxStates(Idx states) { mMaxStates=states; };
+
+  /** Get limit on the number of states */
+  Idx MaxStates(void) const { return mMaxStates; };
+
+  /** Set limit on the number of transitions per operation (0 for unlimited) */
+  void MaxTransitions(Idx transitions) { mMaxTransitions=transitions; };
+
+  /** Get limit on the number of transitions */
+  Idx MaxTransitions(void) const { return mMaxTransitions; };
+
+  /** Set limit on additional memory in bytes (0 for unlimited) */
+  void MaxMemory(std::size_t bytes) { mMaxMemory=bytes; };
+
+  /** Get limit on additional memory */
+  std::size_t MaxMemory(void) const { return mMaxMemory; };
+
+  /** Set whether to return the partial result when exceeded (defaults to false) */
+  void PartialResult(bool on) { mPartialResult=on; };
+
+  /** Get whether to return the partial result */
+  bool PartialResult(void) const { return mPartialResult; };
+
+  /** Test whether a limit has been exceeded */
+  bool Exceeded(void) const { return mExceeded; };
+
+  /** Limit that has been exceeded, i.e., "time", "states", "transitions" or "memory" */
+  const std::string& Reason(void) const { return mReason; };
+
+  /** Statistics: elapsed time in milliseconds at the most recent probe */
+  long int Elapsed(void) const { return mElapsed; };
+
+  /** Statistics: maximum number of states encountered */
+  Idx States(void) const { return mStates; };
+
+  /** Statistics: maximum number of transitions encountered */
+  Idx Transitions(void) const { return mTransitions; };
+
+  /** Statistics: additional memory in bytes at the most recent probe */
+  std::size_t Memory(void) const { return mMemory; };
+
+  /** Statistics: number of checks */
+  Idx Checks(void) const { return mChecks; };
+
+  /** Statistics: summary for reports */
+  std::string Statistics(void) const;
+
+  /**
+   * Check active budgets.
+   *
+   * To be called by operations in their main loop. If no budget is
+   * active, the check amounts to one look-up of a thread local pointer.
+   *
+   * @param states
+   *   Number of states of the result under construction
+   * @param transitions
+   *   Number of transitions of the result under construction
+   * @return
+   *   True if a budget is exceeded, i.e., the operation must stop exploring
+   */
+  static bool Check(Idx states, Idx transitions);
+
+  /**
+   * Abort operation on exceeded budget.
+   *
+   * To be called by operations that perform checks after the result has been set.
+   * If a budget is exceeded, the result is cleared unless a partial result was requested,
+   * and an exception is thrown. Otherwise, this function does nothing.
+   *
+   * @param rFunction
+   *   Name of operation for the exception
+   * @param rResult
+   *   Result parameter
+   * @exception Exception
+   *   - execution budget exceeded (id 111)
+   */
+  static void Abort(const std::string& rFunction, Type& rResult);
+
+  /** Innermost active budget of the current thread, or NULL */
+  static ExecutionBudget* Current(void);
+
+protected:
+
+  /** Check this budget */
+  bool DoCheck(Idx states, Idx transitions);
+
+  /** Probe time and memory */
+  void DoProbe(bool memory);
+
+  /** Limits */
+  long int mMaxTime;
+  Idx mMaxStates;
+  Idx mMaxTransitions;
+  std::size_t mMaxMemory;
+  bool mPartialResult;
+
+  /** Statistics */
+  bool mExceeded;
+  std::string mReason;
+  long int mElapsed;
+  Idx mStates;
+  Idx mTransitions;
+  std::size_t mMemory;
+  Idx mChecks;
+
+  /** Reference values at construction */
+#ifdef FAUDES_SYSTIME
+  faudes_systime_t mStart;
+#endif
+  std::size_t mMemoryStart;
+
+  /** Enclosing budget */
+  ExecutionBudget* mpPrevious;
+
+private:
+
+  /** Not copyable */
+  ExecutionBudget(const ExecutionBudget&);
+  ExecutionBudget& operator=(const ExecutionBudget&);
+};
+
+
+} // namespace faudes
+
+#endif
@@ -35,4 +35,52 @@ template class FAUDES_TAPI TcGenerator<AttributeVoid, AttributeVoid, AttributeCF
 */
 
 
+// EventFlagTable(void)
+EventFlagTable::EventFlagTable(void) {
+}
+
+// EventFlagTable(rEvents,flags)
+EventFlagTable::EventFlagTable(const EventSet& rEvents, fType flags) {
+  Assign(rEvents,flags);
+}
+
+// Assign(rEvents,flags)
+void EventFlagTable::Assign(const EventSet& rEvents, fType flags) {
+  Clear();
+  EventSet::Iterator eit;
+  for(eit=rEvents.Begin(); eit!=rEvents.End(); ++eit)
+    Insert(*eit,flags);
+}
+
+// Clear()
+void EventFlagTable::Clear(void) {
+  mFlags.clear();
+  mExists.clear();
+  mEvents.Clear();
+  mControllableEvents.Clear();
+  mObservableEvents.Clear();
+  mForcibleEvents.Clear();
+  mHighlevelEvents.Clear();
+}
+
+// Insert(ev,flags)
+void EventFlagTable::Insert(Idx ev, fType flags) {
+  if(ev>=mFlags.size()) {
+    mFlags.resize(ev+1,0);
+    mExists.resize(ev+1,0);
+  }
+  mFlags[ev]=flags;
+  mExists[ev]=1;
+  mEvents.Insert(ev);
+  if(flags & AttributeCFlags::mControllableFlag) mControllableEvents.Insert(ev);
+  else mControllableEvents.Erase(ev);
+  if(flags & AttributeCFlags::mObservableFlag) mObservableEvents.Insert(ev);
+  else mObservableEvents.Erase(ev);
+  if(flags & AttributeCFlags::mForcibleFlag) mForcibleEvents.Insert(ev);
+  else mForcibleEvents.Erase(ev);
+  if(flags & AttributeCFlags::mAbstractionFlag) mHighlevelEvents.Insert(ev);
+  else mHighlevelEvents.Erase(ev);
+}
+
+
 } // end namespace
@@ -52,6 +52,113 @@ typedef TBaseVector<cEventSet>     cEventSetVector;
 #endif
 
 
+/**
+ * Dense table of event controllability flags.
+ *
+ * The EventFlagTable holds the flag word of AttributeCFlags per event in an array
+ * indexed by the event index, together with the sets of controllable, observable,
+ * forcible and high-level events. It is meant for algorithms that query event
+ * properties per transition: a query is a single array access instead of a lookup in the
+ * attribute map of the alphabet, and the event sets are returned by reference.
+ *
+ * The table is a snapshot, i.e., it is not updated when the alphabet it was taken from is
+ * modified later on. For a TcGenerator, use TcGenerator::EventFlags() to take the snapshot.
+ *
+ * @ingroup ContainerClasses
+ */
+class FAUDES_API EventFlagTable {
+public:
+
+  /** Construct empty table */
+  EventFlagTable(void);
+
+  /** Construct from alphabet with AttributeCFlags-like attributes */
+  template<class EventAttr>
+  explicit EventFlagTable(const TaNameSet<EventAttr>& rAlphabet) { Assign(rAlphabet); }
+
+  /** Construct from plain event set, all events with the specified flags */
+  EventFlagTable(const EventSet& rEvents, fType flags);
+
+  /** Set up from alphabet with AttributeCFlags-like attributes */
+  template<class EventAttr>
+  void Assign(const TaNameSet<EventAttr>& rAlphabet);
+
+  /** Set up from plain event set, all events with the specified flags */
+  void Assign(const EventSet& rEvents, fType flags);
+
+  /** Clear table */
+  void Clear(void);
+
+  /** Insert event with flags (or overwrite flags of existing event) */
+  void Insert(Idx ev, fType flags);
+
+  /** Test for event */
+  bool Exists(Idx ev) const { return ev<mFlags.size() && mExists[ev]; };
+
+  /** Flag word of event, 0 for events not in the table */
+  fType Flags(Idx ev) const { return ev<mFlags.size() ? mFlags[ev] : 0; };
+
+  /** Event is controllable */
+  bool Controllable(Idx ev) const { return (Flags(ev) & AttributeCFlags::mControllableFlag)!=0; };
+
+  /** Event is observable */
+  bool Observable(Idx ev) const { return (Flags(ev) & AttributeCFlags::mObservableFlag)!=0; };
+
+  /** Event is forcible */
+  bool Forcible(Idx ev) const { return (Flags(ev) & AttributeCFlags::mForcibleFlag)!=0; };
+
+  /** Event is high-level */
+  bool Highlevel(Idx ev) const { return (Flags(ev) & AttributeCFlags::mAbstractionFlag)!=0; };
+
+  /** All events */
+  const EventSet& Events(void) const { return mEvents; };
+
+  /** Controllable events */
+  const EventSet& ControllableEvents(void) const { return mControllableEvents; };
+
+  /** Observable events */
+  const EventSet& ObservableEvents(void) const { return mObservableEvents; };
+
+  /** Forcible events */
+  const EventSet& ForcibleEvents(void) const { return mForcibleEvents; };
+
+  /** High-level events */
+  const EventSet& HighlevelEvents(void) const { return mHighlevelEvents; };
+
+protected:
+
+  /** Flag words by event index */
+  std::vector<fType> mFlags;
+
+  /** Membership by event index */
+  std::vector<char> mExists;
+
+  /** Event sets */
+  EventSet mEvents;
+  EventSet mControllableEvents;
+  EventSet mObservableEvents;
+  EventSet mForcibleEvents;
+  EventSet mHighlevelEvents;
+
+};
+
+// EventFlagTable::Assign(rAlphabet)
+template<class EventAttr>
+void EventFlagTable::Assign(const TaNameSet<EventAttr>& rAlphabet) {
+  Clear();
+  typename TaNameSet<EventAttr>::Iterator eit;
+  for(eit=rAlphabet.Begin(); eit!=rAlphabet.End(); ++eit) {
+    const EventAttr& attr=rAlphabet.Attribute(*eit);
+    fType flags=0;
+    if(attr.Controllable()) flags |= AttributeCFlags::mControllableFlag;
+    if(attr.Observable()) flags |= AttributeCFlags::mObservableFlag;
+    if(attr.Forcible()) flags |= AttributeCFlags::mForcibleFlag;
+    if(attr.Highlevel()) flags |= AttributeCFlags::mAbstractionFlag;
+    Insert(*eit,flags);
+  }
+}
+
+
 /**
  * Generator with controllability attributes. 
  * 
@@ -703,6 +810,18 @@ template <class GlobalAttr, class StateAttr, class EventAttr, class TransAttr>
      */
     EventSet LowlevelEvents(void) const;
 
+    /**
+     * Get dense table of event flags
+     *
+     * The table provides constant time queries of event properties and the
+     * sets of controllable, observable, forcible and high-level events. It is
+     * a snapshot of the current alphabet, see EventFlagTable.
+     *
+     * @return
+     *   EventFlagTable of the alphabet
+     */
+    EventFlagTable EventFlags(void) const;
+
 
   private:
 
@@ -836,14 +955,12 @@ TEMP THIS THIS::NewCGen(void) const {
 
   // Controllable(index)
   TEMP bool THIS::Controllable(Idx index) const {
-    EventAttr attr=BASE::EventAttribute(index);
-    return attr.Controllable();
+    return BASE::EventAttribute(index).Controllable();
   } 
 	
   // Controllable(rName)
   TEMP bool THIS::Controllable(const std::string& rName) const {
-    EventAttr attr=BASE::EventAttribute(rName);
-    return attr.Controllable();
+    return BASE::EventAttribute(rName).Controllable();
   } 
 	
   // InsControllableEvent(index)
@@ -951,14 +1068,12 @@ TEMP THIS THIS::NewCGen(void) const {
   
   // Observable(index)
   TEMP bool THIS::Observable(Idx index) const {
-    EventAttr attr=BASE::EventAttribute(index);
-    return attr.Observable();
+    return BASE::EventAttribute(index).Observable();
   } 
 	
   // Observable(rName)
   TEMP bool THIS::Observable(const std::string& rName) const {
-    EventAttr attr=BASE::EventAttribute(rName);
-    return attr.Observable();
+    return BASE::EventAttribute(rName).Observable();
   } 
 	
   // InsObservableEvent(index)
@@ -1067,14 +1182,12 @@ TEMP THIS THIS::NewCGen(void) const {
 
   //Forcible(index)
   TEMP bool THIS::Forcible(Idx index) const {
-    EventAttr attr=BASE::EventAttribute(index);
-    return attr.Forcible();
+    return BASE::EventAttribute(index).Forcible();
   } 
 	
   // Forcible(rName)
   TEMP bool THIS::Forcible(const std::string& rName) const {
-    EventAttr attr=BASE::EventAttribute(rName);
-    return attr.Forcible();
+    return BASE::EventAttribute(rName).Forcible();
   } 
 	
   // InsForcibleEvent(index)
@@ -1183,26 +1296,22 @@ TEMP THIS THIS::NewCGen(void) const {
 
   //Highlevel(index)
   TEMP bool THIS::Highlevel(Idx index) const {
-    EventAttr attr=BASE::EventAttribute(index);
-    return attr.Highlevel();
+    return BASE::EventAttribute(index).Highlevel();
   } 
 	
   // Highlevel(rName)
   TEMP bool THIS::Highlevel(const std::string& rName) const {
-    EventAttr attr=BASE::EventAttribute(rName);
-    return attr.Highlevel();
+    return BASE::EventAttribute(rName).Highlevel();
   } 
 	
   //Lowlevel(index)
   TEMP bool THIS::Lowlevel(Idx index) const {
-    EventAttr attr=BASE::EventAttribute(index);
-    return attr.Lowlevel();
+    return BASE::EventAttribute(index).Lowlevel();
   } 
 	
   // Lowlevel(rName)
   TEMP bool THIS::Lowlevel(const std::string& rName) const {
-    EventAttr attr=BASE::EventAttribute(rName);
-    return attr.Lowlevel();
+    return BASE::EventAttribute(rName).Lowlevel();
   } 
 	
   // InsHighlevelEvent(index)
@@ -1306,6 +1415,12 @@ TEMP THIS THIS::NewCGen(void) const {
     }
     return res;
   }
+
+  // EventFlags()
+  TEMP EventFlagTable THIS::EventFlags(void) const {
+    FD_DG("TcGenerator(" << this << ")::EventFlags()");
+    return EventFlagTable(BASE::Alphabet());
+  }
   
 
 
@@ -0,0 +1,199 @@
+/** @file cfl_compacttransset.cpp Compact columnar storage of transition relations */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_compacttransset.h"
+#include <algorithm>
+
+namespace faudes {
+
+// test whether an index fits the 32-bit columns (trivially true for 32-bit Idx)
+static inline bool CompactFits(Idx idx) {
+  return ((uint64_t) idx) <= 0xffffffffULL;
+}
+
+// construct
+CompactTransSet::CompactTransSet(void) : mOffsets(2,0) {}
+
+// construct
+CompactTransSet::CompactTransSet(const TransSet& rTransSet) : mOffsets(2,0) {
+  Assign(rTransSet);
+}
+
+// Clear()
+void CompactTransSet::Clear(void) {
+  mOffsets.assign(2,0);
+  mEv.clear();
+  mX2.clear();
+  mPending.clear();
+}
+
+// Assign(rTransSet)
+void CompactTransSet::Assign(const TransSet& rTransSet) {
+  Clear();
+  mEv.reserve(rTransSet.Size());
+  mX2.reserve(rTransSet.Size());
+  if(!rTransSet.Empty()) mOffsets.reserve((std::size_t) (--rTransSet.End())->X1+2);
+  TransSet::Iterator tit=rTransSet.Begin();
+  TransSet::Iterator tit_end=rTransSet.End();
+  for(;tit!=tit_end;++tit) Insert(*tit);
+}
+
+// ToTransSet(rTransSet)
+// (transitions come in X1-Ev-X2 order, so we can append at the end)
+void CompactTransSet::ToTransSet(TransSet& rTransSet) const {
+  Flush();
+  rTransSet.Clear();
+  std::size_t x1end=mOffsets.size()-1;
+  for(std::size_t x1=1; x1<x1end; ++x1)
+    for(Idx pos=mOffsets[x1]; pos<mOffsets[x1+1]; ++pos)
+      rTransSet.Inject(rTransSet.End(),Transition((Idx) x1,mEv[pos],mX2[pos]));
+}
+
+// Append(rTrans)
+// (caller guarantees X1-Ev-X2 order and valid indices)
+void CompactTransSet::Append(const Transition& rTrans) const {
+  if(mEv.size() >= FAUDES_IDX_MAX) {
+    std::stringstream errstr;
+    errstr << "number of transitions exceeds 32-bit positions";
+    throw Exception("CompactTransSet::Insert", errstr.str(), 61);
+  }
+  std::size_t osize=(std::size_t) rTrans.X1+2;
+  if(osize > mOffsets.size())
+    mOffsets.resize(osize,(uint32_t) mEv.size());
+  mEv.push_back(rTrans.Ev);
+  mX2.push_back(rTrans.X2);
+  ++mOffsets.back();
+}
+
+// Insert(rTrans)
+void CompactTransSet::Insert(const Transition& rTrans) {
+  if(rTrans.X1==0 || rTrans.Ev==0 || rTrans.X2==0) {
+    std::stringstream errstr;
+    errstr << "invalid transition " << rTrans.Str();
+    throw Exception("CompactTransSet::Insert", errstr.str(), 61);
+  }
+  if(!CompactFits(rTrans.X1) || !CompactFits(rTrans.Ev) || !CompactFits(rTrans.X2)) {
+    std::stringstream errstr;
+    errstr << "index exceeds 32 bits in transition " << rTrans.Str();
+    throw Exception("CompactTransSet::Insert", errstr.str(), 61);
+  }
+  // fast path: append in order
+  if(mPending.empty()) {
+    if(mEv.empty()) { Append(rTrans); return; }
+    Idx x1max=(Idx) mOffsets.size()-2;
+    Transition last(x1max,mEv.back(),mX2.back());
+    if(last < rTrans) { Append(rTrans); return; }
+    if(last == rTrans) return;
+  }
+  // out of order: buffer
+  mPending.push_back(rTrans);
+}
+
+// InsertSet(rTransSet)
+void CompactTransSet::InsertSet(const TransSet& rTransSet) {
+  TransSet::Iterator tit=rTransSet.Begin();
+  TransSet::Iterator tit_end=rTransSet.End();
+  for(;tit!=tit_end;++tit) Insert(*tit);
+}
+
+// DoFlush()
+// (merge sorted buffer with columns into fresh columns)
+void CompactTransSet::DoFlush(void) const {
+  std::sort(mPending.begin(),mPending.end());
+  mPending.erase(std::unique(mPending.begin(),mPending.end()),mPending.end());
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> ev;
+  std::vector<uint32_t> x2;
+  offsets.swap(mOffsets);
+  ev.swap(mEv);
+  x2.swap(mX2);
+  mOffsets.assign(2,0);
+  mEv.reserve(ev.size()+mPending.size());
+  mX2.reserve(x2.size()+mPending.size());
+  std::vector<Transition>::const_iterator pit=mPending.begin();
+  std::vector<Transition>::const_iterator pit_end=mPending.end();
+  std::size_t x1end=offsets.size()-1;
+  for(std::size_t x1=1; x1<x1end; ++x1) {
+    for(Idx pos=offsets[x1]; pos<offsets[x1+1]; ++pos) {
+      Transition trans((Idx) x1,ev[pos],x2[pos]);
+      for(;pit!=pit_end && *pit<trans; ++pit) Append(*pit);
+      if(pit!=pit_end && *pit==trans) ++pit;
+      Append(trans);
+    }
+  }
+  for(;pit!=pit_end; ++pit) Append(*pit);
+  mPending.clear();
+}
+
+// Compact()
+void CompactTransSet::Compact(void) {
+  Flush();
+  std::vector<Transition>().swap(mPending);
+  mOffsets.shrink_to_fit();
+  mEv.shrink_to_fit();
+  mX2.shrink_to_fit();
+}
+
+// Begin(x1,ev)
+Idx CompactTransSet::Begin(Idx x1, Idx ev) const {
+  Idx beg=Begin(x1);
+  Idx end=End(x1);
+  return (Idx) (std::lower_bound(mEv.begin()+beg,mEv.begin()+end,ev) - mEv.begin());
+}
+
+// End(x1,ev)
+Idx CompactTransSet::End(Idx x1, Idx ev) const {
+  Idx beg=Begin(x1);
+  Idx end=End(x1);
+  return (Idx) (std::upper_bound(mEv.begin()+beg,mEv.begin()+end,ev) - mEv.begin());
+}
+
+// X1(pos)
+Idx CompactTransSet::X1(Idx pos) const {
+  Flush();
+  return (Idx) (std::upper_bound(mOffsets.begin(),mOffsets.end(),pos) - mOffsets.begin()) - 1;
+}
+
+// Exists(rTrans)
+bool CompactTransSet::Exists(const Transition& rTrans) const {
+  Idx beg=Begin(rTrans.X1,rTrans.Ev);
+  Idx end=End(rTrans.X1,rTrans.Ev);
+  return std::binary_search(mX2.begin()+beg,mX2.begin()+end,rTrans.X2);
+}
+
+// operator ==
+bool CompactTransSet::operator==(const CompactTransSet& rOther) const {
+  Flush();
+  rOther.Flush();
+  if(mEv!=rOther.mEv) return false;
+  if(mX2!=rOther.mX2) return false;
+  return mOffsets==rOther.mOffsets;
+}
+
+// MemoryUsage()
+std::size_t CompactTransSet::MemoryUsage(void) const {
+  return sizeof(uint32_t) * (mOffsets.capacity() + mEv.capacity() + mX2.capacity())
+    + sizeof(Transition) * mPending.capacity();
+}
+
+
+} // namespace faudes
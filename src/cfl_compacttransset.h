@@ -0,0 +1,185 @@
+/** @file cfl_compacttransset.h Compact columnar storage of transition relations */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_COMPACTTRANSSET_H
+#define FAUDES_COMPACTTRANSSET_H
+
+#include "cfl_definitions.h"
+#include "cfl_transset.h"
+#include <vector>
+
+namespace faudes {
+
+/**
+ * Transition relation in compact columnar representation.
+ *
+ * A CompactTransSet holds a set of transitions sorted by X1-Ev-X2 in three
+ * plain arrays of 32-bit indices: per current state x1 an offset into the
+ * columns, and per transition the event and the successor state. Thus, a
+ * transition costs 8 bytes plus 4 bytes per state, compared to a tree node
+ * of some 48 bytes in the std::set based TransSet. The compact set is meant
+ * for very large generators that are built once and then queried many times,
+ * e.g. to hold a transition relation while the TransSet is cleared, or as a
+ * lookup table within an algorithm. A transition relation in binary file format
+ * can be loaded directly, see BinaryGenerator::TransRel(CompactTransSet&).
+ *
+ * Transitions are identified by their position 0 ... Size()-1 in the columns.
+ * The positions Begin(x1) ... End(x1)-1 hold all transitions with current state
+ * x1, sorted by event and successor state. Insertion in X1-Ev-X2 order appends
+ * to the columns in constant time. Insertion out of order is buffered and the
+ * buffer is merged on the next query, so bulk insertion in arbitrary order costs
+ * one sort. Positions are invalidated by insertion.
+ *
+ * Unlike TransSet, the CompactTransSet is not a faudes Type: it has no name, no
+ * attributes, no token IO and no iterator tracking. Use the conversions to/from
+ * TransSet at the interface; both run in linear time.
+ *
+ * @ingroup ContainerClasses
+ */
+class FAUDES_API CompactTransSet {
+
+public:
+
+  /** Construct empty set */
+  CompactTransSet(void);
+
+  /** Construct from TransSet */
+  explicit CompactTransSet(const TransSet& rTransSet);
+
+  /** Remove all transitions */
+  void Clear(void);
+
+  /** Set to the transitions of a TransSet */
+  void Assign(const TransSet& rTransSet);
+
+  /** Write transitions to TransSet (clears the set first) */
+  void ToTransSet(TransSet& rTransSet) const;
+
+  /**
+   * Insert transition.
+   *
+   * @param rTrans
+   *   Transition to insert
+   * @exception Exception
+   *   - invalid index 0 (id 61)
+   *   - index exceeds 32 bits (id 61)
+   *   - number of transitions exceeds 32-bit positions (id 61)
+   */
+  void Insert(const Transition& rTrans);
+
+  /** Insert transition, see Insert(const Transition&) */
+  void Insert(Idx x1, Idx ev, Idx x2) { Insert(Transition(x1,ev,x2)); };
+
+  /** Insert all transitions of a TransSet */
+  void InsertSet(const TransSet& rTransSet);
+
+  /** Reserve columns for the specified number of transitions */
+  void Reserve(Idx size) { mEv.reserve(size); mX2.reserve(size); };
+
+  /** Sort and merge buffered transitions, release unused capacity */
+  void Compact(void);
+
+  /** Number of transitions */
+  Idx Size(void) const { Flush(); return (Idx) mEv.size(); };
+
+  /** Test for empty set */
+  bool Empty(void) const { return Size()==0; };
+
+  /** Largest current state with outgoing transitions, 0 for empty set */
+  Idx MaxX1(void) const { Flush(); return (Idx) mOffsets.size()-2; };
+
+  /** Position of first transition with current state x1 */
+  Idx Begin(Idx x1) const {
+    Flush();
+    if(x1 >= mOffsets.size()) return (Idx) mEv.size();
+    return mOffsets[x1];
+  };
+
+  /** Position beyond last transition with current state x1 */
+  Idx End(Idx x1) const {
+    Flush();
+    if((std::size_t) x1+1 >= mOffsets.size()) return (Idx) mEv.size();
+    return mOffsets[(std::size_t) x1+1];
+  };
+
+  /** Position of first transition with current state x1 and event ev */
+  Idx Begin(Idx x1, Idx ev) const;
+
+  /** Position beyond last transition with current state x1 and event ev */
+  Idx End(Idx x1, Idx ev) const;
+
+  /** Event of transition at position pos */
+  Idx Ev(Idx pos) const { return mEv[pos]; };
+
+  /** Successor state of transition at position pos */
+  Idx X2(Idx pos) const { return mX2[pos]; };
+
+  /** Current state of transition at position pos (logarithmic time) */
+  Idx X1(Idx pos) const;
+
+  /** Transition at position pos (logarithmic time) */
+  Transition At(Idx pos) const { return Transition(X1(pos),mEv[pos],mX2[pos]); };
+
+  /** Test for transition */
+  bool Exists(const Transition& rTrans) const;
+
+  /** Test for transition */
+  bool Exists(Idx x1, Idx ev, Idx x2) const { return Exists(Transition(x1,ev,x2)); };
+
+  /** Test for equality */
+  bool operator==(const CompactTransSet& rOther) const;
+
+  /** Test for inequality */
+  bool operator!=(const CompactTransSet& rOther) const { return !operator==(rOther); };
+
+  /** Memory allocated by the columns and the insertion buffer in bytes */
+  std::size_t MemoryUsage(void) const;
+
+protected:
+
+  /** Append transition in X1-Ev-X2 order to the columns */
+  void Append(const Transition& rTrans) const;
+
+  /** Merge the insertion buffer into the columns */
+  void Flush(void) const { if(!mPending.empty()) DoFlush(); };
+
+  /** Merge the insertion buffer into the columns */
+  void DoFlush(void) const;
+
+  /** Offsets per current state, size MaxX1()+2 (computed in std::size_t), last entry equals Size() */
+  mutable std::vector<uint32_t> mOffsets;
+
+  /** Event column */
+  mutable std::vector<uint32_t> mEv;
+
+  /** Successor state column */
+  mutable std::vector<uint32_t> mX2;
+
+  /** Transitions inserted out of order */
+  mutable std::vector<Transition> mPending;
+
+};
+
+
+} // namespace faudes
+
+#endif
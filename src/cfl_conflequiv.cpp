@@ -22,6 +22,7 @@
 #include "cfl_bisimcta.h"
 #include "cfl_regular.h"
 #include "cfl_graphfncts.h"
+#include <atomic>
 
 
 /** Two debug levels for functions in this source file **/
@@ -125,7 +126,7 @@ void MergeEquivalenceClasses(
 // the quotient cannot be constructed from the original automaton (with tau events),
 // but from the saturated and tau-removed automaton. In various test cases, weak-ob-eq
 // shows worse performance then ob-eq and thus abandoned
-void ObservationEquivalentQuotient(Generator& g, const EventSet& silent){
+bool ObservationEquivalentQuotient(Generator& g, const EventSet& silent){
   FD_DF("ObservationEquivalentQuotient(): prepare for t#"<<g.TransRelSize());
 
   // have extendend/reverse-ordered transition relations
@@ -139,6 +140,7 @@ void ObservationEquivalentQuotient(Generator& g, const EventSet& silent){
   MergeEquivalenceClasses(g,rtrans,eqclasses);
 
   FD_DF("ObservationEquivalentQuotient(): done with t#"<<g.TransRelSize());
+  return !eqclasses.empty();
 }
 
 
@@ -257,7 +259,7 @@ std::map<SetX1Ev,StateSet> IncomingEquivalentClasses(const Generator& rGen, cons
 // to avoid computing incoming eq multiple times, see C. Pilbrow and R. Malik 2015. However,
 // since enabled continuation rule requires tau-loop-free automaton and active events rule
 // may generate tau, i have separated them
-void ActiveEventsRule(Generator& g, const EventSet& silent){
+bool ActiveEventsRule(Generator& g, const EventSet& silent){
 
   std::map<SetX1Ev,StateSet> incomingeqclasses = IncomingEquivalentClasses(g,silent);
   std::list<StateSet> eqclasses; // store result
@@ -295,11 +297,12 @@ void ActiveEventsRule(Generator& g, const EventSet& silent){
   }
   g.TransRel().ReSort(rtrans);
   MergeEquivalenceClasses(g,rtrans,eqclasses);
+  return !eqclasses.empty();
 }
 
 // YT: this is a generalized rule of silent continuation rule, see Pilbrow and Malik 2015.
 // Note this function requires tau-loop free automata.
-void EnabledContinuationRule(Generator &g, const EventSet &silent){
+bool EnabledContinuationRule(Generator &g, const EventSet &silent){
   std::map<SetX1Ev,StateSet> incomingeqclasses = IncomingEquivalentClasses(g,silent);
   std::list<StateSet> eqclasses; // store result
   TransSetX2EvX1 rtrans; // convenient declaration for MergeEqClasses
@@ -322,23 +325,26 @@ void EnabledContinuationRule(Generator &g, const EventSet &silent){
   }
   g.TransRel().ReSort(rtrans);
   MergeEquivalenceClasses(g,rtrans,eqclasses);
+  return !eqclasses.empty();
 }
 
 // simple function removing tau self loops
-void RemoveTauSelfloops(Generator &g, const EventSet &silent){
+bool RemoveTauSelfloops(Generator &g, const EventSet &silent){
+  bool changed=false;
   TransSet::Iterator tit = g.TransRelBegin();
   TransSet::Iterator tit_end = g.TransRelEnd();
   while(tit!=tit_end){
-    if (tit->X1 == tit->X2 && silent.Exists(tit->Ev)) g.ClrTransition(tit++);
+    if (tit->X1 == tit->X2 && silent.Exists(tit->Ev)) {g.ClrTransition(tit++); changed=true;}
     else tit++;
   }
+  return changed;
 }
 
 // as a special case of observation equivalence, states on a tau-loop are all equivalent
 // and can be merged to a single state. This step is preferred to be done before
 // (weak) observation equivalence, as they require transition saturation which is quite
 // expensive.
-void MergeSilentLoops(Generator &g, const EventSet &silent){
+bool MergeSilentLoops(Generator &g, const EventSet &silent){
 
   TransSetX2EvX1 rtrans;
   g.TransRel().ReSort(rtrans);
@@ -365,6 +371,7 @@ void MergeSilentLoops(Generator &g, const EventSet &silent){
   }
 
   MergeEquivalenceClasses(g,rtrans,eqclasses);
+  return !eqclasses.empty();
 }
 
 // Certain conflicts. see cited literature 3.2.3
@@ -383,7 +390,7 @@ void RemoveNonCoaccessibleOut(Generator& g){
 
 // Certain conflicts. see cited literature 3.2.3
 // -- remove outgoing transitions from states that block by a silent event
-void BlockingSilentEvent(Generator& g,const EventSet& silent){
+bool BlockingSilentEvent(Generator& g,const EventSet& silent){
   FD_DF("BlockingSilentEvent(): prepare for t#"<<g.TransRelSize());
   StateSet coacc=g.CoaccessibleSet();
   StateSet sblock;
@@ -399,7 +406,8 @@ void BlockingSilentEvent(Generator& g,const EventSet& silent){
       if(!coacc.Exists(tit->X2))
         sblock.Insert(tit->X1);
   }
-  // unmark blocking states and eliminate possible future
+  // unmark blocking states and eliminate possible future (note: each state in sblock
+  // has at least one outgoing transition to clear)
   sit=sblock.Begin();
   sit_end=sblock.End();
   for(;sit!=sit_end;++sit) {
@@ -410,14 +418,15 @@ void BlockingSilentEvent(Generator& g,const EventSet& silent){
       g.ClrTransition(tit++);
   }
   FD_DF("BlockingSilentEvent(): done with t#"<<g.TransRelSize());
+  return !sblock.Empty();
 }
 
 // Certain conflicts. see cited literature 3.2.3
 // -- merge all states that block to one representative
-void MergeNonCoaccessible(Generator& g){
+bool MergeNonCoaccessible(Generator& g){
   StateSet notcoacc=g.States()-g.CoaccessibleSet();
   // bail out on trovial case
-  if(notcoacc.Size()<2) return;
+  if(notcoacc.Size()<2) return false;
   // have a new state
   Idx qnc=g.InsState();
   // fix init status
@@ -432,13 +441,14 @@ void MergeNonCoaccessible(Generator& g){
   }
   // delete original not coacc
   g.DelStates(notcoacc);
+  return true;
 }
 
 
 // Only silent incomming rule; see cited literature 3.2.4
 // Note: input generator must be silent-SCC-free
 // Note: this is a complete re-re-write and needs testing for more than one candidates
-void OnlySilentIncoming(Generator& g, const EventSet& silent){
+bool OnlySilentIncoming(Generator& g, const EventSet& silent){
 
   // figure states with only silent incomming transitions
   // note: Michael Meyer proposed to only consider states with at least two incomming
@@ -451,8 +461,9 @@ void OnlySilentIncoming(Generator& g, const EventSet& silent){
 
   // bail out on trivial
   if(cand.Size()==0) {
-    return;
+    return false;
   }
+  bool changed=false;
 
   StateSet::Iterator sit = cand.Begin();
   StateSet::Iterator sit_end = cand.End();
@@ -483,17 +494,20 @@ void OnlySilentIncoming(Generator& g, const EventSet& silent){
       }
       StateSet::Iterator todelete = sit++;
       g.DelState(*todelete);
+      changed=true;
     }
     else sit++;
   }
   // remark: with this implementation, incoming events (incl. tau) will not be changed
   // through state removal. A candidate state in "cand" will always be a legit candidate
+  return changed;
 }
 
 
 // Only silent outgoing rule; see cited literature 3.2.5
 // Note: input generator must be silent-SCC-free
-void OnlySilentOutgoing(Generator& g,const EventSet& silent){
+bool OnlySilentOutgoing(Generator& g,const EventSet& silent){
+  bool changed=false;
   StateSet::Iterator sit = g.StatesBegin();
   StateSet::Iterator sit_end = g.StatesEnd();
   while(sit!=sit_end){
@@ -525,7 +539,9 @@ void OnlySilentOutgoing(Generator& g,const EventSet& silent){
     StateSet::Iterator todelete = sit;
     sit++;
     g.DelState(*todelete);
+    changed=true;
   }
+  return changed;
 }
 
 EventSet HidePriviateEvs(Generator& rGen, EventSet& silent){
@@ -560,59 +576,158 @@ EventSet HidePriviateEvs(Generator& rGen, EventSet& silent){
 // - EnabledContinuationRule
 // NOTE: currently, ObservationEquivalenceQuotient utilises saturation based algo which does
 // not require tau-loop-free. If
+static bool RemoveTauLoopsRule(Generator& rGen, const EventSet& silent){
+  bool changed=MergeSilentLoops(rGen,silent);
+  if(RemoveTauSelfloops(rGen,silent)) changed=true;
+  return changed;
+}
 void RemoveTauLoops(Generator& rGen, const EventSet& silent){
-  MergeSilentLoops(rGen,silent);
-  RemoveTauSelfloops(rGen,silent);
+  RemoveTauLoopsRule(rGen,silent);
 }
 
 
-// apply all of the above rules once 
-void ConflictEquivalentAbstractionOnce(Generator& rGen, EventSet& silent){
+// rule scheduler: rules in order of application
+// NOTE: the order matters, since OnlySilentIncoming, OnlySilentOutgoing and EnabledContinuationRule
+// require a tau-loop-free automaton, i.e., they must be preceded by RemoveTauLoops
+// NOTE: each rule reports whether it has changed the generator
+static bool MergeNonCoaccessibleRule(Generator& g, const EventSet& silent){
+  (void) silent;
+  return MergeNonCoaccessible(g);
+}
+struct ConflEqRule {
+  const char* mName;                            // name for statistics
+  bool (*mFnct)(Generator&, const EventSet&);   // the rule, returns true on change
+  bool mIdempotent;                             // re-application without intermediate change is void
+};
+static const ConflEqRule gConflEqRules[] = {
+  {"RemoveTauLoops",               &RemoveTauLoopsRule,            true},
+  {"OnlySilentIncoming",           &OnlySilentIncoming,            false},
+  {"OnlySilentOutgoing",           &OnlySilentOutgoing,            false},
+  {"RemoveTauLoops",               &RemoveTauLoopsRule,            true},
+  {"EnabledContinuationRule",      &EnabledContinuationRule,       false},
+  {"ActiveEventsRule",             &ActiveEventsRule,              false},
+  {"ObservationEquivalentQuotient",&ObservationEquivalentQuotient, true},
+  {"BlockingSilentEvent",          &BlockingSilentEvent,           false},
+  {"MergeNonCoaccessible",         &MergeNonCoaccessibleRule,      true}
+};
+static const Idx gConflEqRuleCount = sizeof(gConflEqRules)/sizeof(ConflEqRule);
+
+// rule scheduler: statistics per rule, accumulated until reset
+struct ConflEqRuleStatistics {
+  Idx mInvoked;        // number of applications
+  Idx mSkipped;        // number of skips since no relevant change
+  Idx mEffective;      // number of applications that changed the generator
+  long int mStates;    // states removed
+  long int mTrans;     // transitions removed
+  long int mTime;      // time spent in usecs
+};
+static FAUDES_TLS std::vector<ConflEqRuleStatistics> gConflEqStatistics;
+// fixpoint iteration (atomic for concurrent access)
+static std::atomic<bool> gConflEqFixpoint(false);
+
+// rule scheduler: apply rules in order, skip rules that are known to be void since the generator
+// did not change since their last application; optionally, iterate until a fixpoint is attained
+void ConflictEquivalentAbstractionSchedule(Generator& rGen, EventSet& silent, bool fixpoint){
   // hiding must be performed beforehand.
   EventSet tau = HidePriviateEvs(rGen, silent);
-
-  // ***************** abstraction rules *******************
-  FD_CV1("Applying only silent incoming rule")
-  RemoveTauLoops(rGen,tau);
-  OnlySilentIncoming(rGen,tau);
-  FD_CV1("Applying only silent outgoing rule")
-  // tau-loop-free is required. Nevertheless, after onlysilentincoming, no tau-loops will emerge
-  OnlySilentOutgoing(rGen,tau);
-  FD_CV1("Applying enabled continuation rule")
-  RemoveTauLoops(rGen,tau);
-  EnabledContinuationRule(rGen,tau);
-  FD_CV1("Applying active events rule")
-  ActiveEventsRule(rGen,tau);
-  FD_CV1("Applying observation eq quotient")
-  ObservationEquivalentQuotient(rGen,tau);
-  FD_CV1("Applying certain conflicts rule")
-  BlockingSilentEvent(rGen,tau);
-  MergeNonCoaccessible(rGen);
+  // initialize
+  if(gConflEqStatistics.size()!=gConflEqRuleCount) 
+    ConflictEquivalentAbstractionStatisticsReset();
+  std::vector<bool> dirty(gConflEqRuleCount,true);
+  Idx sz0=rGen.Size();
+  (void) sz0; // make compiler happy
+  // loop passes
+  while(true) {
+    bool progress=false;
+    FD_CV1("ConflictEquivalentAbstraction(): pass with states #"<<rGen.Size());
+    FD_WPC(sz0, rGen.Size(), "ConflictEquivalentAbstraction: fixpoint iteration states #" << rGen.Size());
+    for(Idx r=0; r<gConflEqRuleCount; ++r) {
+      ConflEqRuleStatistics& stats=gConflEqStatistics[r];
+      if(!dirty[r]) {
+        FD_CV1("Skipping "<< gConflEqRules[r].mName)
+        ++stats.mSkipped;
+        continue;
+      }
+      FD_CV1("Applying "<< gConflEqRules[r].mName)
+      Idx states=rGen.Size();
+      Idx trans=rGen.TransRelSize();
+#ifdef FAUDES_SYSTIME
+      faudes_systime_t start, stop, lap;
+      faudes_gettimeofday(&start);
+#endif
+      bool changed=gConflEqRules[r].mFnct(rGen,tau);
+#ifdef FAUDES_SYSTIME
+      faudes_gettimeofday(&stop);
+      faudes_diffsystime(stop,start,&lap);
+      stats.mTime+=lap.tv_sec*1000000L + lap.tv_nsec/1000L;
+#endif
+      ++stats.mInvoked;
+      dirty[r]=false;
+      // record effect and mark all rules for re-application
+      if(changed) {
+        ++stats.mEffective;
+        stats.mStates+= (long int) states - (long int) rGen.Size();
+        stats.mTrans+= (long int) trans - (long int) rGen.TransRelSize();
+        progress=true;
+        dirty.assign(gConflEqRuleCount,true);
+      }
+      // an idempotent rule has attained its fixpoint, incl. other occurrences in the sequence
+      if(gConflEqRules[r].mIdempotent) 
+        for(Idx q=0; q<gConflEqRuleCount; ++q) 
+          if(gConflEqRules[q].mFnct==gConflEqRules[r].mFnct) dirty[q]=false;
+    }
+    if(!fixpoint || !progress) break;
+  }
   FD_DF("ConflictEquivalentAbstraction(): done with t#"<<rGen.TransRelSize());
 }
 
+// apply all of the above rules once 
+void ConflictEquivalentAbstractionOnce(Generator& rGen, EventSet& silent){
+  ConflictEquivalentAbstractionSchedule(rGen,silent,false);
+}
+
 // apply all of the above repeatedly until a fixpoint is attained
 void ConflictEquivalentAbstractionLoop(vGenerator& rGen, EventSet& rSilentEvents){
-  Idx sz0=rGen.Size();
-  (void) sz0; // make compiler happy
-  while(true) {
-    Idx sz1=rGen.Size();      
-    FD_CV1("ConflictEquivalentAbstraction(): loop with states #"<<rGen.TransRelSize());
-    FD_WPC(sz0, sz1, "ConflictEquivalentAbstraction: fixpoint iteration states #" << sz1);
-    ConflictEquivalentAbstractionOnce(rGen,rSilentEvents);
-    // break on slow progress
-    //if(rGen.Size()> 1000 && rGen.Size()>0.95*sz1) break;
-    if(rGen.Size()==sz1) break;
-  }
-  FD_CV1("ConflictEquivalentAbstraction(): done with states #"<<rGen.TransRelSize());
+  ConflictEquivalentAbstractionSchedule(rGen,rSilentEvents,true);
 }
   
 // select variant
 void ConflictEquivalentAbstraction(vGenerator& rGen, EventSet& rSilentEvents){
-  ConflictEquivalentAbstractionOnce(rGen,rSilentEvents);
-  //ConflictEquivalentAbstractionLoop(rGen,rSilentEvents);
+  if(gConflEqFixpoint) ConflictEquivalentAbstractionLoop(rGen,rSilentEvents);
+  else ConflictEquivalentAbstractionOnce(rGen,rSilentEvents);
 }  
 
+// configure variant
+void ConflictEquivalentAbstractionFixpoint(bool on){
+  gConflEqFixpoint=on;
+}
+
+// report variant
+bool ConflictEquivalentAbstractionFixpoint(void){
+  return gConflEqFixpoint;
+}
+
+// reset statistics
+void ConflictEquivalentAbstractionStatisticsReset(void){
+  ConflEqRuleStatistics zero = {0,0,0,0,0,0};
+  gConflEqStatistics.assign(gConflEqRuleCount,zero);
+}
+
+// report statistics
+std::string ConflictEquivalentAbstractionStatistics(void){
+  if(gConflEqStatistics.size()!=gConflEqRuleCount) 
+    ConflictEquivalentAbstractionStatisticsReset();
+  std::stringstream res;
+  for(Idx r=0; r<gConflEqRuleCount; ++r) {
+    const ConflEqRuleStatistics& stats=gConflEqStatistics[r];
+    res << "rule #" << r+1 << " " << gConflEqRules[r].mName 
+        << ": invoked " << stats.mInvoked << ", skipped " << stats.mSkipped 
+        << ", effective " << stats.mEffective << ", states removed " << stats.mStates 
+        << ", transitions removed " << stats.mTrans << ", time " << stats.mTime << "us" << std::endl;
+  }
+  return res.str();
+}
+
 
 // API wrapper  
 bool IsNonconflicting(const GeneratorVector& rGvec) {
@@ -689,14 +804,10 @@ bool IsNonconflicting(const GeneratorVector& rGvec) {
     Generator gij;
     FD_CV0("Composing automata "<<gvec.At(imin).Name()<<" and "<<gvec.At(jmin).Name())
       Parallel(gvec.At(imin),gvec.At(jmin),gij);
-    GeneratorVector newgvec;
-    newgvec.Append(gij); // the composed generator is always the first element
-    git = 0;
-    for(;git!=gvec.Size();git++){
-      if (git == imin || git == jmin) continue;
-      newgvec.Append(gvec.At(git)); // all other candidates are just copied to the next iteraion
-    }
-    gvec = newgvec;
+    // drop the candidates, all other generators remain in place (no copies)
+    gvec.Erase(imin > jmin ? imin : jmin);
+    gvec.Erase(imin > jmin ? jmin : imin);
+    gvec.Insert(0,std::move(gij)); // the composed generator is always the first element
   }
   return IsNonblocking(gvec.At(0));
 }
@@ -77,6 +77,49 @@ extern FAUDES_API bool IsNonblocking(const GeneratorVector& rGvec);
  */
 extern FAUDES_API void ConflictEquivalentAbstraction(vGenerator& rGen, EventSet& rSilentEvents);
 
+/**
+ * Conflict equivalent abstraction, configure fixpoint iteration.
+ *
+ * By default, ConflictEquivalentAbstraction applies each of its rules once. 
+ * With fixpoint iteration enabled, the sequence of rules is repeated until no 
+ * further reduction is achieved. In both cases, a rule is skipped if the generator
+ * did not change since its last application and hence the rule is known to be void.
+ * The setting applies globally, incl. invocations by other threads; it is stored
+ * atomically and each invocation uses the setting in place when it starts.
+ *
+ * @param on
+ *   True to iterate until a fixpoint is attained
+ */
+extern FAUDES_API void ConflictEquivalentAbstractionFixpoint(bool on);
+
+/**
+ * Conflict equivalent abstraction, report fixpoint iteration.
+ *
+ * @return
+ *   True if fixpoint iteration is enabled
+ */
+extern FAUDES_API bool ConflictEquivalentAbstractionFixpoint(void);
+
+/**
+ * Conflict equivalent abstraction, report statistics.
+ *
+ * For each abstraction rule, the number of applications, of skips, and of
+ * applications with an effect are reported, together with the number of states and 
+ * transitions removed and the time spent in microseconds (requires system time support).
+ * Statistics accumulate over all invocations of ConflictEquivalentAbstraction,
+ * incl. those by IsNonconflicting, until reset. With threads enabled, statistics
+ * are recorded per thread.
+ *
+ * @return
+ *   Human readable statistics, one line per rule
+ */
+extern FAUDES_API std::string ConflictEquivalentAbstractionStatistics(void);
+
+/**
+ * Conflict equivalent abstraction, reset statistics.
+ */
+extern FAUDES_API void ConflictEquivalentAbstractionStatisticsReset(void);
+
 
 
 /**
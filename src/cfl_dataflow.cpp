@@ -0,0 +1,472 @@
+/** @file cfl_dataflow.cpp @brief Dataflow executor for run-time interface functions */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_dataflow.h"
+#include "cfl_registry.h"
+
+namespace faudes {
+
+// construct
+DataFlow::DataFlow(void) :
+  mThreads(0),
+  mNextGroup(0),
+  mRunning(0),
+  mDone(0),
+  mpError(NULL)
+{
+#ifdef FAUDES_THREADS
+  faudes_mutex_init(&mMutex);
+  faudes_cond_init(&mCond);
+#endif
+}
+
+// destruct
+DataFlow::~DataFlow(void) {
+  Clear();
+#ifdef FAUDES_THREADS
+  faudes_cond_destroy(&mCond);
+  faudes_mutex_destroy(&mMutex);
+#endif
+}
+
+// clear
+void DataFlow::Clear(void) {
+  for(std::size_t i=0; i<mValues.size(); ++i)
+    if(mValues[i].mOwned) delete mValues[i].mpValue;
+  mValues.clear();
+  mValueIndices.clear();
+  mNodes.clear();
+}
+
+// provide value
+void DataFlow::Value(const std::string& rName, Type* pValue) {
+  std::map<std::string,Idx>::iterator vit=mValueIndices.find(rName);
+  if(vit==mValueIndices.end()) {
+    ValueRecord vrec;
+    vrec.mName=rName;
+    vrec.mpValue=pValue;
+    vrec.mOwned=false;
+    vrec.mWriter=0;
+    mValueIndices[rName]=mValues.size();
+    mValues.push_back(vrec);
+    return;
+  }
+  ValueRecord& vrec=mValues[vit->second];
+  if(vrec.mWriter!=0 || !vrec.mReaders.empty()) {
+    std::stringstream errstr;
+    errstr << "value \"" << rName << "\" is referred to by a node";
+    throw Exception("DataFlow::Value()", errstr.str(), 45);
+  }
+  if(vrec.mOwned) delete vrec.mpValue;
+  vrec.mpValue=pValue;
+  vrec.mOwned=false;
+}
+
+// access value
+Type* DataFlow::Value(const std::string& rName) const {
+  std::map<std::string,Idx>::const_iterator vit=mValueIndices.find(rName);
+  if(vit==mValueIndices.end()) {
+    std::stringstream errstr;
+    errstr << "no such value \"" << rName << "\"";
+    throw Exception("DataFlow::Value()", errstr.str(), 46);
+  }
+  return mValues[vit->second].mpValue;
+}
+
+// test value
+bool DataFlow::ExistsValue(const std::string& rName) const {
+  return mValueIndices.find(rName)!=mValueIndices.end();
+}
+
+// find or allocate value
+Idx DataFlow::DoValue(const std::string& rName, const std::string& rFaudesType) {
+  std::map<std::string,Idx>::iterator vit=mValueIndices.find(rName);
+  if(vit!=mValueIndices.end()) return vit->second;
+  if(!TypeRegistry::G()->Exists(rFaudesType)) {
+    std::stringstream errstr;
+    errstr << "unknown type \"" << rFaudesType << "\" for value \"" << rName << "\"";
+    throw Exception("DataFlow::DoValue()", errstr.str(), 46);
+  }
+  ValueRecord vrec;
+  vrec.mName=rName;
+  vrec.mpValue=TypeRegistry::G()->NewObject(rFaudesType);
+  vrec.mOwned=true;
+  vrec.mWriter=0;
+  mValueIndices[rName]=mValues.size();
+  mValues.push_back(vrec);
+  return mValues.size()-1;
+}
+
+// test whether a value casts to a faudes type
+static bool DataFlowTypeCheck(const Type* pValue, const std::string& rFaudesType) {
+  if(!TypeRegistry::G()->Exists(rFaudesType)) return false;
+  const Type* proto=TypeRegistry::G()->Prototype(rFaudesType);
+  if(!proto) return false;
+  return proto->Cast(pValue)!=NULL;
+}
+
+// add dependency
+void DataFlow::DoEdge(Idx from, Idx to) {
+  if(from==to) return;
+  std::vector<Idx>& succ=mNodes[from].mSuccessors;
+  if(!succ.empty()) if(succ.back()==to) return;
+  succ.push_back(to);
+  mNodes[to].mPredecessors++;
+}
+
+// record dependencies of last node
+void DataFlow::DoDepend(Idx val, bool write) {
+  Idx node=mNodes.size()-1;
+  ValueRecord& vrec=mValues[val];
+  if(vrec.mWriter!=0) DoEdge(vrec.mWriter-1,node);
+  if(write) {
+    for(std::size_t i=0; i<vrec.mReaders.size(); ++i)
+      DoEdge(vrec.mReaders[i]-1,node);
+    vrec.mReaders.clear();
+    vrec.mWriter=node+1;
+  } else {
+    vrec.mReaders.push_back(node+1);
+  }
+}
+
+// read node
+Idx DataFlow::Read(const std::string& rName, const std::string& rFaudesType, const std::string& rFileName) {
+  Idx val=DoValue(rName,rFaudesType);
+  if(!DataFlowTypeCheck(mValues[val].mpValue,rFaudesType)) {
+    std::stringstream errstr;
+    errstr << "value \"" << rName << "\" does not match type \"" << rFaudesType << "\"";
+    throw Exception("DataFlow::Read()", errstr.str(), 48);
+  }
+  Node node;
+  node.mKind=ReadNode;
+  node.mVariant=-1;
+  node.mFileName=rFileName;
+  node.mValues.push_back(val);
+  node.mPredecessors=0;
+  mNodes.push_back(node);
+  DoDepend(val,true);
+  return mNodes.size()-1;
+}
+
+// write node
+Idx DataFlow::Write(const std::string& rName, const std::string& rFileName) {
+  std::map<std::string,Idx>::iterator vit=mValueIndices.find(rName);
+  if(vit==mValueIndices.end()) {
+    std::stringstream errstr;
+    errstr << "no such value \"" << rName << "\"";
+    throw Exception("DataFlow::Write()", errstr.str(), 46);
+  }
+  Node node;
+  node.mKind=WriteNode;
+  node.mVariant=-1;
+  node.mFileName=rFileName;
+  node.mValues.push_back(vit->second);
+  node.mPredecessors=0;
+  mNodes.push_back(node);
+  DoDepend(vit->second,false);
+  return mNodes.size()-1;
+}
+
+// function node
+Idx DataFlow::Call(const std::string& rFunction, const std::vector<std::string>& rParams,
+  const std::string& rVariant)
+{
+  // find function
+  if(!FunctionRegistry::G()->Exists(rFunction)) {
+    std::stringstream errstr;
+    errstr << "unknown function \"" << rFunction << "\"";
+    throw Exception("DataFlow::Call()", errstr.str(), 46);
+  }
+  const FunctionDefinition& fdef=FunctionRegistry::G()->Definition(rFunction);
+  // figure variant: explicit
+  int variant=-1;
+  if(rVariant!="") {
+    variant=fdef.VariantIndex(rVariant);
+    if(variant<0) {
+      std::stringstream errstr;
+      errstr << "unknown variant \"" << rVariant << "\" of function \"" << rFunction << "\"";
+      throw Exception("DataFlow::Call()", errstr.str(), 46);
+    }
+    if(fdef.Variant(variant).Size()!=(int) rParams.size()) {
+      std::stringstream errstr;
+      errstr << "parameter count mismatch for variant \"" << rVariant << "\" of function \"" << rFunction << "\"";
+      throw Exception("DataFlow::Call()", errstr.str(), 48);
+    }
+  }
+  // figure variant: first match by parameter count and types of existing values
+  for(int v=0; variant<0 && v<fdef.VariantsSize(); ++v) {
+    const Signature& sig=fdef.Variant(v);
+    if(sig.Size()!=(int) rParams.size()) continue;
+    bool match=true;
+    for(int i=0; match && i<sig.Size(); ++i) {
+      std::map<std::string,Idx>::iterator vit=mValueIndices.find(rParams[i]);
+      if(vit==mValueIndices.end()) continue;
+      match=DataFlowTypeCheck(mValues[vit->second].mpValue,sig.At(i).Type());
+    }
+    if(match) variant=v;
+  }
+  if(variant<0) {
+    std::stringstream errstr;
+    errstr << "no variant of function \"" << rFunction << "\" matches parameters";
+    throw Exception("DataFlow::Call()", errstr.str(), 48);
+  }
+  // resolve values
+  const Signature& sig=fdef.Variant(variant);
+  std::vector<Idx> vals;
+  for(int i=0; i<sig.Size(); ++i) {
+    const Parameter& par=sig.At(i);
+    if(par.Attribute()!=Parameter::Out && !ExistsValue(rParams[i])) {
+      std::stringstream errstr;
+      errstr << "no such value \"" << rParams[i] << "\" for input parameter " << i << " of function \"" << rFunction << "\"";
+      throw Exception("DataFlow::Call()", errstr.str(), 46);
+    }
+    Idx val=DoValue(rParams[i],par.Type());
+    if(!DataFlowTypeCheck(mValues[val].mpValue,par.Type())) {
+      std::stringstream errstr;
+      errstr << "value \"" << rParams[i] << "\" does not match type \"" << par.Type() << "\"";
+      throw Exception("DataFlow::Call()", errstr.str(), 48);
+    }
+    vals.push_back(val);
+  }
+  // insert node
+  Node node;
+  node.mKind=CallNode;
+  node.mFunction=rFunction;
+  node.mVariant=variant;
+  node.mValues=vals;
+  node.mPredecessors=0;
+  mNodes.push_back(node);
+  for(int i=0; i<sig.Size(); ++i)
+    DoDepend(vals[i],sig.At(i).Attribute()!=Parameter::In);
+  return mNodes.size()-1;
+}
+
+// number of nodes
+Idx DataFlow::Size(void) const {
+  return mNodes.size();
+}
+
+// threads
+void DataFlow::Threads(Idx count) {
+  mThreads=count;
+}
+
+// threads
+Idx DataFlow::Threads(void) const {
+  return mThreads;
+}
+
+// execute one node
+void DataFlow::DoExecute(Idx node) {
+  const Node& rnode=mNodes[node];
+  switch(rnode.mKind) {
+  case ReadNode:
+    mValues[rnode.mValues[0]].mpValue->Read(rnode.mFileName);
+    break;
+  case WriteNode:
+    mValues[rnode.mValues[0]].mpValue->Write(rnode.mFileName);
+    break;
+  case CallNode: {
+    Function* funct=FunctionRegistry::G()->NewFunction(rnode.mFunction);
+    try {
+      funct->Variant(rnode.mVariant);
+      for(std::size_t i=0; i<rnode.mValues.size(); ++i)
+        funct->ParamValue(i,mValues[rnode.mValues[i]].mpValue);
+      funct->Execute();
+    } catch(...) {
+      delete funct;
+      throw;
+    }
+    delete funct;
+    break;
+  }
+  }
+}
+
+// execute sequentially
+void DataFlow::DoExecuteSequential(void) {
+  for(Idx n=0; n<mNodes.size(); ++n) {
+    FD_WPC(n,mNodes.size(),"DataFlow::Execute(): node #" << n);
+    DoExecute(n);
+  }
+}
+
+// execute
+void DataFlow::Execute(void) {
+  FD_DF("DataFlow::Execute(): #" << mNodes.size() << " nodes");
+#ifdef FAUDES_THREADS
+  if(mThreads>0) {
+    DoExecuteThreaded();
+    return;
+  }
+#endif
+  DoExecuteSequential();
+}
+
+
+#ifdef FAUDES_THREADS
+
+// thread entry
+void* DataFlow::DoWorker(void* arg) {
+  static_cast<DataFlow*>(arg)->DoWorkerLoop();
+  return NULL;
+}
+
+// thread main loop
+void DataFlow::DoWorkerLoop(void) {
+  faudes_mutex_lock(&mMutex);
+  while(true) {
+    // done, or stop on error
+    if(mDone==mNodes.size()) break;
+    if(mpError && mRunning==0) break;
+    // find ready node with no share group in use (prefer order of insertion)
+    std::size_t pos=mReady.size();
+    if(!mpError) {
+      for(std::size_t i=0; i<mReady.size(); ++i) {
+        const std::vector<Idx>& vals=mNodes[mReady[i]].mValues;
+        bool free=true;
+        for(std::size_t j=0; free && j<vals.size(); ++j) free= !mInUse[mGroups[vals[j]]];
+        if(!free) continue;
+        if(pos==mReady.size() || mReady[i]<mReady[pos]) pos=i;
+      }
+    }
+    if(pos==mReady.size()) {
+      faudes_cond_wait(&mCond,&mMutex);
+      continue;
+    }
+    // take node
+    Idx node=mReady[pos];
+    mReady[pos]=mReady.back();
+    mReady.pop_back();
+    const std::vector<Idx>& vals=mNodes[node].mValues;
+    for(std::size_t j=0; j<vals.size(); ++j) mInUse[mGroups[vals[j]]]=true;
+    ++mRunning;
+    faudes_mutex_unlock(&mMutex);
+    // run node
+    Exception* error=NULL;
+    try {
+      DoExecute(node);
+    } catch(Exception& exception) {
+      error=new Exception(exception);
+    } catch(std::exception& exception) {
+      error=new Exception("DataFlow::Execute()", exception.what(), 49);
+    } catch(...) {
+      std::stringstream errstr;
+      errstr << "unknown exception in node #" << node;
+      error=new Exception("DataFlow::Execute()", errstr.str(), 49);
+    }
+    // record completion
+    faudes_mutex_lock(&mMutex);
+    for(std::size_t j=0; j<vals.size(); ++j) mInUse[mGroups[vals[j]]]=false;
+    // update share groups: a value read from file has data of its own, the
+    // result of a function may share data with any of its arguments
+    if(mNodes[node].mKind==ReadNode) {
+      mGroups[vals[0]]=mNextGroup++;
+    } else if(mNodes[node].mKind==CallNode && !vals.empty()) {
+      std::vector<bool> merge(mInUse.size(),false);
+      for(std::size_t j=0; j<vals.size(); ++j) merge[mGroups[vals[j]]]=true;
+      Idx group=mGroups[vals[0]];
+      for(std::size_t v=0; v<mGroups.size(); ++v) 
+        if(merge[mGroups[v]]) mGroups[v]=group;
+    }
+    --mRunning;
+    ++mDone;
+    if(error) {
+      if(!mpError) mpError=error;
+      else delete error;
+    }
+    const std::vector<Idx>& succ=mNodes[node].mSuccessors;
+    for(std::size_t i=0; i<succ.size(); ++i)
+      if(--mPending[succ[i]]==0) mReady.push_back(succ[i]);
+    faudes_cond_broadcast(&mCond);
+  }
+  faudes_mutex_unlock(&mMutex);
+}
+
+// execute by thread pool, incl. the calling thread
+void DataFlow::DoExecuteThreaded(void) {
+  // initialise scheduling state
+  mPending.resize(mNodes.size());
+  mReady.clear();
+  for(Idx n=0; n<mNodes.size(); ++n) {
+    mPending[n]=mNodes[n].mPredecessors;
+    if(mPending[n]==0) mReady.push_back(n);
+  }
+  // initialise share groups: values provided by the application may share 
+  // data with each other, values allocated by the flow are independent
+  mGroups.resize(mValues.size());
+  for(Idx v=0; v<mValues.size(); ++v)
+    mGroups[v]= mValues[v].mOwned ? v+1 : 0;
+  mNextGroup=mValues.size()+1;
+  mInUse.assign(mValues.size()+mNodes.size()+1,false);
+  mRunning=0;
+  mDone=0;
+  mpError=NULL;
+  // start threads
+  Idx count=mThreads;
+  if(count>mNodes.size()) count=mNodes.size();
+  std::vector<faudes_thread_t> threads;
+  for(Idx t=1; t<count; ++t) {
+    faudes_thread_t thread;
+    if(faudes_thread_create(&thread,DoWorker,this)!=FAUDES_THREAD_SUCCESS) break;
+    threads.push_back(thread);
+  }
+  // participate
+  DoWorkerLoop();
+  // join
+  for(std::size_t t=0; t<threads.size(); ++t)
+    faudes_thread_join(threads[t],NULL);
+  // pass on error
+  if(mpError) {
+    Exception error(*mpError);
+    delete mpError;
+    mpError=NULL;
+    throw error;
+  }
+}
+
+#endif
+
+
+// debugging report
+void DataFlow::DWrite(void) const {
+  std::stringstream sstr;
+  for(Idx n=0; n<mNodes.size(); ++n) {
+    const Node& rnode=mNodes[n];
+    sstr << "node #" << n << ": ";
+    if(rnode.mKind==ReadNode) sstr << "read " << mValues[rnode.mValues[0]].mName << " from \"" << rnode.mFileName << "\"";
+    if(rnode.mKind==WriteNode) sstr << "write " << mValues[rnode.mValues[0]].mName << " to \"" << rnode.mFileName << "\"";
+    if(rnode.mKind==CallNode) {
+      sstr << rnode.mFunction << "(";
+      for(std::size_t i=0; i<rnode.mValues.size(); ++i)
+        sstr << (i>0 ? "," : "") << mValues[rnode.mValues[i]].mName;
+      sstr << ")";
+    }
+    sstr << " successors:";
+    for(std::size_t i=0; i<rnode.mSuccessors.size(); ++i) sstr << " #" << rnode.mSuccessors[i];
+    sstr << std::endl;
+  }
+  FAUDES_WRITE_CONSOLE(sstr.str());
+}
+
+
+} // namespace faudes
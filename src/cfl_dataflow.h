@@ -0,0 +1,318 @@
+/** @file cfl_dataflow.h @brief Dataflow executor for run-time interface functions */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_DATAFLOW_H
+#define FAUDES_DATAFLOW_H
+
+#include "cfl_definitions.h"
+#include "cfl_platform.h"
+#include "cfl_exception.h"
+#include "cfl_types.h"
+#include "cfl_functions.h"
+#include <vector>
+#include <map>
+#include <string>
+
+namespace faudes {
+
+/**
+ * Dataflow executor for run-time interface functions.
+ *
+ * A DataFlow holds a sequence of nodes, each of which either reads a value from file,
+ * writes a value to file, or calls a function from the FunctionRegistry. Values are
+ * referred to by name; they are either provided by the application or allocated
+ * by the DataFlow when first referred to as output of a node. The result of
+ * Execute() is the same as if the nodes were executed one after the other in the order
+ * of insertion. However, with Threads() set to a positive number, nodes are scheduled
+ * concurrently on a pool of threads as soon as the nodes they depend on have completed.
+ * Intermediate values are computed once and are then available to all subsequent nodes.
+ *
+ * Example:
+ * @code
+ * DataFlow flow;
+ * flow.Read("G1","Generator","plant1.gen");
+ * flow.Read("G2","Generator","plant2.gen");
+ * flow.Read("K","Generator","spec.gen");
+ * flow.Call("Parallel",{"G1","G2","G"});
+ * flow.Call("SupCon",{"G","K","S"});
+ * flow.Call("StateMin",{"S","SMin"});
+ * flow.Write("SMin","sup.gen");
+ * flow.Threads(4);
+ * flow.Execute();
+ * @endcode
+ *
+ * Technical note: libFAUDES objects that share data by copy-on-write must not be accessed
+ * concurrently, and this also applies to read-only access. Thus, nodes that refer to a
+ * common value are never executed at the same time. Moreover, values that may share data
+ * are never accessed at the same time: this applies to all values provided by the
+ * application, and to the values of a function node once it has been executed, since
+ * the result of a function may share data with its arguments. A value read from file has
+ * data of its own. In order to process one input in concurrent branches, read it once per
+ * branch.
+ *
+ * @ingroup RunTimeInterface
+ */
+class FAUDES_API DataFlow {
+public:
+
+  /** Construct empty flow */
+  DataFlow(void);
+
+  /** Destruct, incl. values allocated by the flow */
+  virtual ~DataFlow(void);
+
+  /** Clear nodes and values */
+  void Clear(void);
+
+  /**
+   * Provide a value.
+   *
+   * The value is referred to by the specified name. Ownership remains with the
+   * caller. An existing value of the same name is replaced; this must be done before
+   * any node refers to the name.
+   *
+   * @param rName
+   *   Name of value
+   * @param pValue
+   *   Faudes object
+   * @exception Exception
+   *   - value already referred to by a node (id 45)
+   */
+  void Value(const std::string& rName, Type* pValue);
+
+  /**
+   * Access a value.
+   *
+   * @param rName
+   *   Name of value
+   * @return
+   *   Faudes object
+   * @exception Exception
+   *   - no such value (id 46)
+   */
+  Type* Value(const std::string& rName) const;
+
+  /**
+   * Test existence of value.
+   *
+   * @param rName
+   *   Name of value
+   * @return
+   *   True if value exists
+   */
+  bool ExistsValue(const std::string& rName) const;
+
+  /**
+   * Insert node to read a value from file.
+   *
+   * If the value does not exist, an object of the specified faudes type is allocated.
+   *
+   * @param rName
+   *   Name of value
+   * @param rFaudesType
+   *   Faudes type name, e.g. "Generator"
+   * @param rFileName
+   *   File to read from
+   * @return
+   *   Node index
+   * @exception Exception
+   *   - unknown type (id 46)
+   *   - type mismatch with existing value (id 48)
+   */
+  Idx Read(const std::string& rName, const std::string& rFaudesType, const std::string& rFileName);
+
+  /**
+   * Insert node to write a value to file.
+   *
+   * @param rName
+   *   Name of value
+   * @param rFileName
+   *   File to write to
+   * @return
+   *   Node index
+   * @exception Exception
+   *   - no such value (id 46)
+   */
+  Idx Write(const std::string& rName, const std::string& rFileName);
+
+  /**
+   * Insert node to call a registered function.
+   *
+   * Parameters are specified positionally by value names. Values for output
+   * parameters are allocated as needed. If no variant is specified, the first variant
+   * of the function that matches the number of parameters and the types of existing
+   * values is used.
+   *
+   * @param rFunction
+   *   Name of function as registered in the FunctionRegistry
+   * @param rParams
+   *   Value names of parameters
+   * @param rVariant
+   *   Name of variant (optional)
+   * @return
+   *   Node index
+   * @exception Exception
+   *   - unknown function, variant or input value (id 46)
+   *   - no matching variant, or type mismatch (id 48)
+   */
+  Idx Call(const std::string& rFunction, const std::vector<std::string>& rParams,
+    const std::string& rVariant="");
+
+  /** Number of nodes */
+  Idx Size(void) const;
+
+  /**
+   * Set number of threads.
+   *
+   * With 0 threads (default), nodes are executed by the calling thread in the order
+   * of insertion. With threads disabled at compile time, this setting has no effect.
+   *
+   * @param count
+   *   Number of threads
+   */
+  void Threads(Idx count);
+
+  /** Get number of threads */
+  Idx Threads(void) const;
+
+  /**
+   * Execute all nodes.
+   *
+   * Nodes that have been executed before are executed again. When a node throws an
+   * exception, no further nodes are started and the first exception is passed on
+   * to the caller once all running nodes have completed.
+   *
+   * @exception Exception
+   *   - any exception thrown by a node
+   *   - other errors while executing a node, incl. unknown exceptions (id 49)
+   */
+  void Execute(void);
+
+  /**
+   * Report flow and dependencies to console, for debugging.
+   */
+  void DWrite(void) const;
+
+protected:
+
+  /** Node kinds */
+  typedef enum { ReadNode, WriteNode, CallNode } NodeKind;
+
+  /** Node record */
+  struct Node {
+    NodeKind mKind;
+    std::string mFunction;
+    int mVariant;
+    std::string mFileName;
+    std::vector<Idx> mValues;
+    std::vector<Idx> mSuccessors;
+    Idx mPredecessors;
+  };
+
+  /** Value record */
+  struct ValueRecord {
+    std::string mName;
+    Type* mpValue;
+    bool mOwned;
+    // last node to write the value, or 0 if none (offset by 1)
+    Idx mWriter;
+    // nodes that read the value since the last write (offset by 1)
+    std::vector<Idx> mReaders;
+  };
+
+  /** Find or allocate value (returns index) */
+  Idx DoValue(const std::string& rName, const std::string& rFaudesType);
+
+  /** Record dependencies of the current last node on a value */
+  void DoDepend(Idx val, bool write);
+
+  /** Add a dependency, avoiding duplicates */
+  void DoEdge(Idx from, Idx to);
+
+  /** Execute a single node */
+  void DoExecute(Idx node);
+
+  /** Execute sequentially */
+  void DoExecuteSequential(void);
+
+#ifdef FAUDES_THREADS
+  /** Execute by thread pool */
+  void DoExecuteThreaded(void);
+
+  /** Thread entry */
+  static void* DoWorker(void* arg);
+
+  /** Thread main loop */
+  void DoWorkerLoop(void);
+#endif
+
+  /** Nodes */
+  std::vector<Node> mNodes;
+
+  /** Values */
+  std::vector<ValueRecord> mValues;
+
+  /** Value names */
+  std::map<std::string,Idx> mValueIndices;
+
+  /** Number of threads */
+  Idx mThreads;
+
+  /** Scheduling state: remaining predecessors per node */
+  std::vector<Idx> mPending;
+
+  /** Scheduling state: ready nodes */
+  std::vector<Idx> mReady;
+
+  /** Scheduling state: share group per value, i.e., values that may share data */
+  std::vector<Idx> mGroups;
+
+  /** Scheduling state: share groups currently in use */
+  std::vector<bool> mInUse;
+
+  /** Scheduling state: next unused share group */
+  Idx mNextGroup;
+
+  /** Scheduling state: number of nodes running and done */
+  Idx mRunning;
+  Idx mDone;
+
+  /** Scheduling state: first error */
+  Exception* mpError;
+
+#ifdef FAUDES_THREADS
+  /** Scheduling state: mutex and condition */
+  faudes_mutex_t mMutex;
+  faudes_cond_t mCond;
+#endif
+
+private:
+
+  /** Not copyable */
+  DataFlow(const DataFlow&);
+  DataFlow& operator=(const DataFlow&);
+};
+
+
+} // namespace faudes
+
+#endif
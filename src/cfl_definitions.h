@@ -110,11 +110,11 @@ typedef double Float;
 
 /** Alternative progessreport for development */
 #define FD_WPD(cntnow, cntdone, message)  { \
-  static faudes_systime_t start; \
-  static faudes_systime_t now; \
-  static faudes_mstime_t lap;  \
-  static Int prog;  \
-  static bool init(false);  \
+  static FAUDES_TLS faudes_systime_t start; \
+  static FAUDES_TLS faudes_systime_t now; \
+  static FAUDES_TLS faudes_mstime_t lap;  \
+  static FAUDES_TLS Int prog;  \
+  static FAUDES_TLS bool init(false);  \
   if(!init) { faudes_gettimeofday(&start); prog=cntnow;}  \
   faudes_gettimeofday(&now);  \
   faudes_diffsystime(now,start,&lap); \
@@ -0,0 +1,208 @@
+/** @file cfl_densestateset.cpp Bit-vector representation of sets of states */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_densestateset.h"
+#include <algorithm>
+
+namespace faudes {
+
+// word level helpers: popcount and count-trailing-zeros
+static inline Idx DenseSetPopCount(uint64_t w) {
+#ifdef __GNUC__
+  return (Idx) __builtin_popcountll(w);
+#else
+  Idx cnt=0;
+  for(;w;w&=w-1) ++cnt;
+  return cnt;
+#endif
+}
+static inline Idx DenseSetCtz(uint64_t w) {
+#ifdef __GNUC__
+  return (Idx) __builtin_ctzll(w);
+#else
+  Idx cnt=0;
+  for(;!(w&1);w>>=1) ++cnt;
+  return cnt;
+#endif
+}
+
+// construct
+DenseStateSet::DenseStateSet(void) : mWords(1,0), mMaxIndex(0) {}
+
+// construct
+DenseStateSet::DenseStateSet(Idx maxidx) : mWords((maxidx >> 6)+1,0), mMaxIndex(maxidx) {}
+
+// construct
+DenseStateSet::DenseStateSet(const StateSet& rStates, Idx maxidx) :
+  mWords((maxidx >> 6)+1,0), mMaxIndex(maxidx)
+{
+  InsertSet(rStates);
+}
+
+// Suitable(maxidx,size)
+// (a std::set node is about 40 bytes, i.e. 320 bits; we accept the dense
+// representation if it spends at most 64 bits per state in use, plus some
+// slack for small generators, i.e. it is well below a node per state)
+bool DenseStateSet::Suitable(Idx maxidx, Idx size) {
+  return maxidx <= 64*size + 1024;
+}
+
+// Reset(maxidx)
+void DenseStateSet::Reset(Idx maxidx) {
+  mMaxIndex=maxidx;
+  mWords.assign((maxidx >> 6)+1,0);
+}
+
+// Clear()
+void DenseStateSet::Clear(void) {
+  std::fill(mWords.begin(),mWords.end(),0);
+}
+
+// Fill()
+void DenseStateSet::Fill(void) {
+  std::fill(mWords.begin(),mWords.end(),~uint64_t(0));
+  mWords[0] &= ~uint64_t(1);
+  Idx tail = (mMaxIndex & 63) + 1;
+  if(tail<64) mWords.back() &= (uint64_t(1) << tail) - 1;
+}
+
+// Size()
+Idx DenseStateSet::Size(void) const {
+  Idx res=0;
+  const uint64_t* w=&mWords[0];
+  std::size_t n=mWords.size();
+  for(std::size_t i=0; i<n; ++i) res+=DenseSetPopCount(w[i]);
+  return res;
+}
+
+// Empty()
+bool DenseStateSet::Empty(void) const {
+  const uint64_t* w=&mWords[0];
+  std::size_t n=mWords.size();
+  for(std::size_t i=0; i<n; ++i) if(w[i]) return false;
+  return true;
+}
+
+// Next(idx)
+Idx DenseStateSet::Next(Idx idx) const {
+  if(idx>=mMaxIndex) return 0;
+  ++idx;
+  std::size_t i = idx >> 6;
+  uint64_t w = mWords[i] & (~uint64_t(0) << (idx & 63));
+  std::size_t n=mWords.size();
+  while(true) {
+    if(w) return (Idx) (i << 6) + DenseSetCtz(w);
+    if(++i>=n) return 0;
+    w=mWords[i];
+  }
+}
+
+// operator &=
+DenseStateSet& DenseStateSet::operator&=(const DenseStateSet& rOther) {
+  std::size_t n = std::min(mWords.size(),rOther.mWords.size());
+  uint64_t* w=&mWords[0];
+  const uint64_t* o=&rOther.mWords[0];
+  for(std::size_t i=0; i<n; ++i) w[i] &= o[i];
+  for(std::size_t i=n; i<mWords.size(); ++i) w[i]=0;
+  return *this;
+}
+
+// operator |=
+DenseStateSet& DenseStateSet::operator|=(const DenseStateSet& rOther) {
+  std::size_t n = std::min(mWords.size(),rOther.mWords.size());
+  uint64_t* w=&mWords[0];
+  const uint64_t* o=&rOther.mWords[0];
+  for(std::size_t i=0; i<n; ++i) w[i] |= o[i];
+  return *this;
+}
+
+// AndNot
+DenseStateSet& DenseStateSet::AndNot(const DenseStateSet& rOther) {
+  std::size_t n = std::min(mWords.size(),rOther.mWords.size());
+  uint64_t* w=&mWords[0];
+  const uint64_t* o=&rOther.mWords[0];
+  for(std::size_t i=0; i<n; ++i) w[i] &= ~o[i];
+  return *this;
+}
+
+// operator ==
+bool DenseStateSet::operator==(const DenseStateSet& rOther) const {
+  std::size_t n = std::min(mWords.size(),rOther.mWords.size());
+  for(std::size_t i=0; i<n; ++i)
+    if(mWords[i]!=rOther.mWords[i]) return false;
+  for(std::size_t i=n; i<mWords.size(); ++i)
+    if(mWords[i]) return false;
+  for(std::size_t i=n; i<rOther.mWords.size(); ++i)
+    if(rOther.mWords[i]) return false;
+  return true;
+}
+
+// SubsetOf
+bool DenseStateSet::SubsetOf(const DenseStateSet& rOther) const {
+  std::size_t n = std::min(mWords.size(),rOther.mWords.size());
+  for(std::size_t i=0; i<n; ++i)
+    if(mWords[i] & ~rOther.mWords[i]) return false;
+  for(std::size_t i=n; i<mWords.size(); ++i)
+    if(mWords[i]) return false;
+  return true;
+}
+
+// InsertSet(StateSet)
+void DenseStateSet::InsertSet(const StateSet& rStates) {
+  StateSet::Iterator sit=rStates.Begin();
+  StateSet::Iterator sit_end=rStates.End();
+  for(;sit!=sit_end;++sit) Insert(*sit);
+}
+
+// RestrictSet(StateSet)
+void DenseStateSet::RestrictSet(const StateSet& rStates) {
+  DenseStateSet other(rStates,mMaxIndex);
+  operator&=(other);
+}
+
+// EraseSet(StateSet)
+void DenseStateSet::EraseSet(const StateSet& rStates) {
+  StateSet::Iterator sit=rStates.Begin();
+  StateSet::Iterator sit_end=rStates.End();
+  for(;sit!=sit_end;++sit) Erase(*sit);
+}
+
+// ToStateSet(StateSet)
+// (elements come in ascending order, so we can append at the end)
+void DenseStateSet::ToStateSet(StateSet& rStates) const {
+  rStates.Clear();
+  for(Idx q=First(); q!=0; q=Next(q))
+    rStates.Inject(rStates.End(),q);
+}
+
+// Signature()
+Idx DenseStateSet::Signature(void) const {
+  Idx sig=0;
+  std::size_t n=mWords.size();
+  while(n>1 && mWords[n-1]==0) --n;
+  for(std::size_t i=0; i<n; ++i)
+    sig = (sig ^ (Idx) (mWords[i] ^ (mWords[i] >> 32))) * 16777619u;
+  return sig;
+}
+
+
+} // namespace faudes
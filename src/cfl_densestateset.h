@@ -0,0 +1,192 @@
+/** @file cfl_densestateset.h Bit-vector representation of sets of states */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_DENSESTATESET_H
+#define FAUDES_DENSESTATESET_H
+
+#include "cfl_definitions.h"
+#include "cfl_indexset.h"
+#include <vector>
+
+namespace faudes {
+
+/**
+ * Set of states represented as a bit vector.
+ *
+ * A DenseStateSet holds one bit per state index in the range 1 ... MaxIndex().
+ * It is meant as an algorithm-internal workspace for fixpoint iterations and
+ * graph traversals where the state indices of a generator are (almost)
+ * contiguous, e.g. after Generator::MinStateIndex(). Membership tests and
+ * updates are constant time, and the boolean operations are word-wise loops
+ * that the compiler may vectorise. Unlike StateSet, the DenseStateSet is not
+ * a faudes Type: it has no name, no attributes, no token IO and no iterator
+ * tracking. Use the conversions to/from StateSet at the interface.
+ *
+ * Insert/Erase/Exists on indices beyond MaxIndex() are silently ignored
+ * resp. report false; binary operations require operands of equal MaxIndex().
+ *
+ * @ingroup ContainerClasses
+ */
+class FAUDES_API DenseStateSet {
+
+public:
+
+  /** Construct empty set with capacity 0 */
+  DenseStateSet(void);
+
+  /** Construct empty set for indices 1 ... maxidx */
+  explicit DenseStateSet(Idx maxidx);
+
+  /** Construct from StateSet, with capacity for indices 1 ... maxidx */
+  DenseStateSet(const StateSet& rStates, Idx maxidx);
+
+  /**
+   * Heuristic test whether a dense representation pays off.
+   *
+   * @param maxidx
+   *   Largest state index to be represented
+   * @param size
+   *   Number of states actually in use
+   * @return
+   *   True if the bit vector is not significantly larger than the
+   *   node-based representation of a set with size elements.
+   */
+  static bool Suitable(Idx maxidx, Idx size);
+
+  /** Largest representable index */
+  Idx MaxIndex(void) const { return mMaxIndex; };
+
+  /** Clear and reset capacity to indices 1 ... maxidx */
+  void Reset(Idx maxidx);
+
+  /** Remove all elements, keep capacity */
+  void Clear(void);
+
+  /** Insert all indices 1 ... MaxIndex() */
+  void Fill(void);
+
+  /** Insert index; ignored if out of range */
+  void Insert(Idx idx) {
+    if(idx==0 || idx>mMaxIndex) return;
+    mWords[idx >> 6] |= (uint64_t(1) << (idx & 63));
+  };
+
+  /** Remove index */
+  void Erase(Idx idx) {
+    if(idx==0 || idx>mMaxIndex) return;
+    mWords[idx >> 6] &= ~(uint64_t(1) << (idx & 63));
+  };
+
+  /** Test membership */
+  bool Exists(Idx idx) const {
+    if(idx==0 || idx>mMaxIndex) return false;
+    return (mWords[idx >> 6] >> (idx & 63)) & 1;
+  };
+
+  /** Number of elements (popcount) */
+  Idx Size(void) const;
+
+  /** Test for empty set */
+  bool Empty(void) const;
+
+  /** Smallest element, 0 for empty set */
+  Idx First(void) const { return Next(0); };
+
+  /** Smallest element larger than idx, 0 if there is none */
+  Idx Next(Idx idx) const;
+
+  /** Set intersection */
+  DenseStateSet& operator&=(const DenseStateSet& rOther);
+
+  /** Set union */
+  DenseStateSet& operator|=(const DenseStateSet& rOther);
+
+  /** Set difference, i.e., remove all elements of rOther */
+  DenseStateSet& AndNot(const DenseStateSet& rOther);
+
+  /** Test for equality */
+  bool operator==(const DenseStateSet& rOther) const;
+
+  /** Test for inequality */
+  bool operator!=(const DenseStateSet& rOther) const { return !operator==(rOther); };
+
+  /** Test whether this set is included in rOther */
+  bool SubsetOf(const DenseStateSet& rOther) const;
+
+  /** Insert all elements of a StateSet that are in range */
+  void InsertSet(const StateSet& rStates);
+
+  /** Restrict to the elements of a StateSet */
+  void RestrictSet(const StateSet& rStates);
+
+  /** Remove all elements of a StateSet */
+  void EraseSet(const StateSet& rStates);
+
+  /** Write elements to StateSet (clears the set first) */
+  void ToStateSet(StateSet& rStates) const;
+
+  /** Hash value over elements, compatible with operator== */
+  Idx Signature(void) const;
+
+protected:
+
+  /** Bit vector, bit i represents index i */
+  std::vector<uint64_t> mWords;
+
+  /** Largest representable index */
+  Idx mMaxIndex;
+
+};
+
+
+/**
+ * Fixpoint iteration on a DenseStateSet.
+ *
+ * Repeatedly invokes step() until the number of elements in rSet stabilises
+ * or reaches bound. The step is meant to update rSet monotonically, i.e., to
+ * only insert elements for a mu-iteration (bound is the number of states) or
+ * to only remove elements for a nu-iteration (bound is 0).
+ *
+ * @param rSet
+ *   Iterate, updated by step()
+ * @param bound
+ *   Size at which the iteration terminates early
+ * @param step
+ *   Function object to compute the next iterate
+ *
+ * @ingroup ContainerClasses
+ */
+template<class Step>
+void DenseFixpoint(DenseStateSet& rSet, Idx bound, Step step) {
+  while(true) {
+    Idx sz=rSet.Size();
+    step();
+    Idx nsz=rSet.Size();
+    if(nsz==sz) break;
+    if(nsz==bound) break;
+  }
+}
+
+
+} // namespace faudes
+
+#endif
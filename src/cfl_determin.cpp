@@ -21,6 +21,8 @@
 
 
 #include "cfl_determin.h"
+#include "cfl_genbuilder.h"
+#include "cfl_budget.h"
 
 namespace faudes {
 
@@ -157,15 +159,19 @@ void Deterministic(const Generator& rGen, std::vector<StateSet>& rPowerStates,
 
   // lock transrel to prevent iterator tracking (tmoor 201403)
   rGen.TransRel().Lock();
+
+  // record result in append-only buffers
+  GeneratorBuilder builder;
+  builder.InsEvents(rGen.Alphabet());
   
   // initialize rPowerStates with subset of initial states
-  Idx newstate = pResGen->InsInitState();
+  Idx newstate = builder.InsInitState();
   for (lit = rGen.InitStatesBegin(); lit != rGen.InitStatesEnd(); ++lit) {
     // clear set and insert single state
     newset.Insert(*lit);
     // if marked state set in res generator
     if (rGen.ExistsMarkedState(*lit)) {
-      pResGen->SetMarkedState(newstate);
+      builder.SetMarkedState(newstate);
       FD_DF("Deterministic: setting as mstate: " << rGen.SStr(newstate));
     }
   }
@@ -181,6 +187,8 @@ void Deterministic(const Generator& rGen, std::vector<StateSet>& rPowerStates,
   for (current_vecindex = 0; current_vecindex < rPowerStates.size(); 
        ++current_vecindex) {
     FD_WPC(current_vecindex,rPowerStates.size(), "Deterministic(): current/size: "<<  current_vecindex << " / " << rPowerStates.size());
+    // stop on exceeded execution budget
+    if(ExecutionBudget::Check(rPowerStates.size(),builder.TransRelSize())) break;
     FD_DF("Deterministic: current power set: {" 
 	  << rPowerStates[current_vecindex].ToString() << "} -> " 
 	  << rDetStates[current_vecindex]);
@@ -312,7 +320,7 @@ void Deterministic(const Generator& rGen, std::vector<StateSet>& rPowerStates,
       // if new set is unique within the existing power sets
       if (tmp_x2 == 0) {
 	// create new state in res generator
-	tmp_x2 = pResGen->InsState();
+	tmp_x2 = builder.InsState();
 	// insert newset in rPowerStates and get iterator,bool pair
 	rPowerStates.push_back(currentset);
 	rDetStates.push_back(tmp_x2);
@@ -323,17 +331,21 @@ void Deterministic(const Generator& rGen, std::vector<StateSet>& rPowerStates,
 	// set marked if one of the states in current set is marked
 	for (lit = currentset.Begin(); lit != currentset.End(); ++lit) {
 	  if (rGen.ExistsMarkedState(*lit)) {
-	    pResGen->SetMarkedState(tmp_x2);
+	    builder.SetMarkedState(tmp_x2);
 	    break;
 	  }
 	}
       }
       // introduce transition
-      pResGen->SetTransition(rDetStates[current_vecindex], currentevent, tmp_x2);
+      builder.SetTransition(rDetStates[current_vecindex], currentevent, tmp_x2);
     }
   }
 
 
+  // build result, restore alphabet incl. attributes
+  builder.Finalize(*pResGen);
+  pResGen->InjectAlphabet(rGen.Alphabet());
+
   // fix names
   if (rGen.StateNamesEnabled() && pResGen->StateNamesEnabled()) {
     FD_DF("Deterministic: fixing names...");
@@ -362,6 +374,9 @@ void Deterministic(const Generator& rGen, std::vector<StateSet>& rPowerStates,
     delete pResGen;
   }
 
+  // throw on exceeded execution budget
+  ExecutionBudget::Abort("Deterministic()",rResGen);
+
   FD_DF("Deterministic(): core function: done");
     
 }
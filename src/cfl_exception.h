@@ -107,6 +107,7 @@ namespace faudes {
  *   - 100: Alphabet mismatch
  *   - 101: Nondeterministic argument
  *   - 110: Break on application request
+ *   - 111: Execution budget exceeded
  *   - 1xx  See respective functions
  *   - 2xx  See respective functions
  *
@@ -772,11 +772,34 @@ void Function::Execute(void){
       throw Exception("Function::Execute()", err.str(), 48);
     }
   }
+  // consult result cache
+  FunctionCache* cache=mspCache;
+  std::string ckey;
+  if(cache) ckey=cache->Key(*this);
+  if(ckey!="")
+    if(cache->Lookup(ckey,*this)) {
+      FD_DRTI("Function::Execute() done (cached)");
+      return;
+    }
   DoExecute();
+  if(ckey!="") cache->Insert(ckey,*this);
   FD_DRTI("Function::Execute() done");
 }
 
 
+// result cache (static)
+FunctionCache* Function::mspCache=NULL;
+
+// install result cache
+void Function::Cache(FunctionCache* pCache) {
+  mspCache=pCache;
+}
+
+// get result cache
+FunctionCache* Function::Cache(void) {
+  return mspCache;
+}
+
 // token io (informative/debug)
 void Function::DoWrite(TokenWriter& rTw, const std::string& rLabel, const Type* pContext) const{
   (void) pContext;
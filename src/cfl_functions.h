@@ -684,6 +684,34 @@ protected:
 
 
 
+/**
+ * Interface of a result cache for faudes-functions.
+ *
+ * When a cache is installed by Function::Cache(), Function::Execute() consults
+ * the cache before the actual execution and records the results thereafter. The
+ * interface decouples the minimal run-time interface from the implementation,
+ * see ResultCache.
+ *
+ * @ingroup RunTimeInterface
+ */
+class FAUDES_API FunctionCache {
+ public:
+  /** Destructor */
+  virtual ~FunctionCache(void) {};
+
+  /** Key of function call, or empty string if not to be cached */
+  virtual std::string Key(const Function& rFunction) const = 0;
+
+  /** Look up results and set Out/InOut parameter values, return true on success */
+  virtual bool Lookup(const std::string& rKey, Function& rFunction) = 0;
+
+  /** Record values of Out/InOut parameters */
+  virtual void Insert(const std::string& rKey, const Function& rFunction) = 0;
+
+}; // FunctionCache
+
+
+
 /**
  * A faudes-function hosts parameter values of some faudes type and provides 
  * a method to perform an operation on the specified paramters, e.g. the 
@@ -919,6 +947,8 @@ class FAUDES_API Function : public Type {
    * Perform operation.
    *
    * Runs a type check and then the actual function.
+   * If a cache is installed, results are taken from the cache when
+   * available, see Cache().
    *
    * @exception Exception
    *  - No variant specified (id 48)
@@ -928,6 +958,25 @@ class FAUDES_API Function : public Type {
    */
   void Execute(void);
 
+  /**
+   * Install result cache.
+   *
+   * The cache applies to all functions. It should be installed before any
+   * threads are started. Use NULL to uninstall.
+   *
+   * @param pCache
+   *   Cache to install, ownership remains with the caller
+   */
+  static void Cache(FunctionCache* pCache);
+
+  /**
+   * Get installed result cache.
+   *
+   * @return
+   *   Installed cache, or NULL
+   */
+  static FunctionCache* Cache(void);
+
 
  protected:
 
@@ -1026,6 +1075,9 @@ class FAUDES_API Function : public Type {
   /** Vector of arguments. */
   std::vector<Type*> mParameterValues;
 
+  /** Installed result cache */
+  static FunctionCache* mspCache;
+
 }; // Function
 
 
@@ -0,0 +1,598 @@
+/** @file cfl_genbinary.cpp Binary generator file format with memory-mapped access */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_genbinary.h"
+#include <algorithm>
+
+#ifdef FAUDES_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace faudes {
+
+// file layout
+// - header: magic (8 bytes), byte order mark, version, section count, reserved (4 bytes each)
+// - directory: per section tag, reserved (4 bytes each), offset, size (8 bytes each)
+// - payload: sections, each starting at an 8 byte boundary
+static const char BinGenMagic[8] = {'F','A','U','D','E','S','G','B'};
+static const uint32_t BinGenBom = 0x01020304;
+static const uint32_t BinGenVersion = 1;
+static const std::size_t BinGenHeaderSize = 24;
+static const std::size_t BinGenDirEntrySize = 24;
+
+// helper: pad to 8 byte boundary
+static uint64_t BinGenAlign(uint64_t pos) {
+  return (pos + 7) & ~uint64_t(7);
+}
+
+// helper: section to write
+struct BinGenSection {
+  uint32_t mTag;
+  const char* mpData;
+  uint64_t mSize;
+};
+
+// helper: record section from vector
+template<class T>
+static void BinGenAdd(std::vector<BinGenSection>& rSections, const char* pTag, const std::vector<T>& rVec) {
+  BinGenSection sec;
+  sec.mTag=BinaryGenerator::Tag(pTag);
+  sec.mpData= rVec.empty() ? 0 : (const char*) &rVec[0];
+  sec.mSize=rVec.size()*sizeof(T);
+  rSections.push_back(sec);
+}
+
+// helper: record section from string
+static void BinGenAdd(std::vector<BinGenSection>& rSections, uint32_t tag, const std::string& rStr) {
+  BinGenSection sec;
+  sec.mTag=tag;
+  sec.mpData=rStr.data();
+  sec.mSize=rStr.size();
+  rSections.push_back(sec);
+}
+
+// helper: bit vector over state positions
+static void BinGenBits(const StateSet& rStates, const std::vector<uint32_t>& rStat, std::vector<uint64_t>& rBits) {
+  rBits.assign((rStat.size() >> 6)+1,0);
+  std::vector<uint32_t>::const_iterator pit=rStat.begin();
+  StateSet::Iterator sit=rStates.Begin();
+  StateSet::Iterator sit_end=rStates.End();
+  for(;sit!=sit_end;++sit) {
+    pit=std::lower_bound(pit,rStat.end(),*sit);
+    if(pit==rStat.end()) break;
+    if(*pit!=*sit) continue;
+    std::size_t pos=pit-rStat.begin();
+    rBits[pos >> 6] |= uint64_t(1) << (pos & 63);
+  }
+}
+
+// BinaryWrite(rGen,rFileName,rExtra)
+void BinaryWrite(const vGenerator& rGen, const std::string& rFileName,
+  const std::map<uint32_t,std::string>& rExtra)
+{
+  FD_DG("BinaryWrite(" << &rGen << "," << rFileName << ")");
+  std::vector<BinGenSection> sections;
+  // name
+  std::string name=rGen.Name();
+  BinGenAdd(sections,BinaryGenerator::Tag("NAME"),name);
+  // alphabet
+  std::vector<uint32_t> alph;
+  std::vector<uint64_t> enof;
+  std::string enam;
+  alph.reserve(rGen.AlphabetSize());
+  enof.reserve(rGen.AlphabetSize()+1);
+  EventSet::Iterator eit=rGen.AlphabetBegin();
+  for(;eit!=rGen.AlphabetEnd();++eit) {
+    alph.push_back(*eit);
+    enof.push_back(enam.size());
+    enam+=rGen.EventName(*eit);
+  }
+  enof.push_back(enam.size());
+  BinGenAdd(sections,"ALPH",alph);
+  BinGenAdd(sections,"ENOF",enof);
+  BinGenAdd(sections,BinaryGenerator::Tag("ENAM"),enam);
+  // states
+  std::vector<uint32_t> stat;
+  stat.reserve(rGen.Size());
+  StateSet::Iterator sit=rGen.StatesBegin();
+  for(;sit!=rGen.StatesEnd();++sit) stat.push_back(*sit);
+  BinGenAdd(sections,"STAT",stat);
+  // state names, if any
+  std::vector<uint64_t> snof;
+  std::string snam;
+  if(rGen.StateSymbolTable().Size()>0) {
+    snof.reserve(stat.size()+1);
+    for(std::size_t pos=0; pos<stat.size(); ++pos) {
+      snof.push_back(snam.size());
+      snam+=rGen.StateName(stat[pos]);
+    }
+    snof.push_back(snam.size());
+    BinGenAdd(sections,"SNOF",snof);
+    BinGenAdd(sections,BinaryGenerator::Tag("SNAM"),snam);
+  }
+  // initial and marked states
+  std::vector<uint64_t> init;
+  std::vector<uint64_t> mark;
+  BinGenBits(rGen.InitStates(),stat,init);
+  BinGenBits(rGen.MarkedStates(),stat,mark);
+  BinGenAdd(sections,"INIT",init);
+  BinGenAdd(sections,"MARK",mark);
+  // transition relation in CSR layout (transitions come in X1-Ev-X2 order)
+  std::vector<uint32_t> toff(stat.size()+1,0);
+  std::vector<uint32_t> trev;
+  std::vector<uint32_t> trx2;
+  trev.reserve(rGen.TransRelSize());
+  trx2.reserve(rGen.TransRelSize());
+  TransSet::ConstView trel(rGen.TransRel());
+  TransSet::ConstView::Iterator tit=trel.Begin();
+  TransSet::ConstView::Iterator tit_end=trel.End();
+  for(std::size_t pos=0; pos<stat.size(); ++pos) {
+    toff[pos]=trev.size();
+    for(;tit!=tit_end && tit->X1<stat[pos]; ++tit) {};
+    for(;tit!=tit_end && tit->X1==stat[pos]; ++tit) {
+      trev.push_back(tit->Ev);
+      trx2.push_back(tit->X2);
+    }
+  }
+  toff[stat.size()]=trev.size();
+  BinGenAdd(sections,"TOFF",toff);
+  BinGenAdd(sections,"TREV",trev);
+  BinGenAdd(sections,"TRX2",trx2);
+  // event flags
+  std::vector<uint64_t> eflg;
+  if(dynamic_cast<const AttributeFlags*>(rGen.Alphabet().AttributeType())) {
+    eflg.reserve(alph.size());
+    for(std::size_t pos=0; pos<alph.size(); ++pos) {
+      const AttributeFlags* attr=dynamic_cast<const AttributeFlags*>(&rGen.EventAttribute(alph[pos]));
+      eflg.push_back(attr ? attr->mFlags : 0);
+    }
+    BinGenAdd(sections,"EFLG",eflg);
+  }
+  // state flags
+  std::vector<uint64_t> sflg;
+  if(dynamic_cast<const AttributeFlags*>(rGen.States().AttributeType())) {
+    sflg.reserve(stat.size());
+    for(std::size_t pos=0; pos<stat.size(); ++pos) {
+      const AttributeFlags* attr=dynamic_cast<const AttributeFlags*>(&rGen.StateAttribute(stat[pos]));
+      sflg.push_back(attr ? attr->mFlags : 0);
+    }
+    BinGenAdd(sections,"SFLG",sflg);
+  }
+  // extra sections
+  std::map<uint32_t,std::string>::const_iterator xit=rExtra.begin();
+  for(;xit!=rExtra.end();++xit)
+    BinGenAdd(sections,xit->first,xit->second);
+  // layout
+  uint64_t offset=BinGenHeaderSize + BinGenDirEntrySize*sections.size();
+  std::vector<uint64_t> offsets;
+  for(std::size_t i=0; i<sections.size(); ++i) {
+    offset=BinGenAlign(offset);
+    offsets.push_back(offset);
+    offset+=sections[i].mSize;
+  }
+  // write
+  std::ofstream fout;
+  fout.exceptions(std::ios::badbit|std::ios::failbit);
+  try {
+    fout.open(rFileName.c_str(), std::ios::out|std::ios::binary|std::ios::trunc);
+    uint32_t head[4]={BinGenBom,BinGenVersion,(uint32_t) sections.size(),0};
+    fout.write(BinGenMagic,8);
+    fout.write((const char*) head,sizeof(head));
+    for(std::size_t i=0; i<sections.size(); ++i) {
+      uint32_t tag[2]={sections[i].mTag,0};
+      uint64_t pos[2]={offsets[i],sections[i].mSize};
+      fout.write((const char*) tag,sizeof(tag));
+      fout.write((const char*) pos,sizeof(pos));
+    }
+    uint64_t cur=BinGenHeaderSize + BinGenDirEntrySize*sections.size();
+    static const char zeros[8]={0,0,0,0,0,0,0,0};
+    for(std::size_t i=0; i<sections.size(); ++i) {
+      fout.write(zeros,offsets[i]-cur);
+      if(sections[i].mSize>0) fout.write(sections[i].mpData,sections[i].mSize);
+      cur=offsets[i]+sections[i].mSize;
+    }
+    fout.close();
+  } catch (std::ios::failure&) {
+    std::stringstream errstr;
+    errstr << "Exception opening/writing binary file \"" << rFileName << "\"";
+    throw Exception("BinaryWrite", errstr.str(), 2);
+  }
+  FD_DG("BinaryWrite(" << &rGen << "," << rFileName << "): done");
+}
+
+// BinaryWrite(rGen,rFileName)
+void BinaryWrite(const vGenerator& rGen, const std::string& rFileName) {
+  std::map<uint32_t,std::string> extra;
+  BinaryWrite(rGen,rFileName,extra);
+}
+
+// BinaryRead(rFileName,rGen)
+void BinaryRead(const std::string& rFileName, vGenerator& rGen) {
+  BinaryGenerator bgen(rFileName);
+  bgen.ToGenerator(rGen);
+}
+
+
+// construct
+BinaryGenerator::BinaryGenerator(void) : mpData(0), mSize(0), mMapped(false) {
+  Close();
+}
+
+// construct
+BinaryGenerator::BinaryGenerator(const std::string& rFileName) : mpData(0), mSize(0), mMapped(false) {
+  Close();
+  Open(rFileName);
+}
+
+// destruct
+BinaryGenerator::~BinaryGenerator(void) {
+  Close();
+}
+
+// Tag(name)
+uint32_t BinaryGenerator::Tag(const char* pName) {
+  return ((uint32_t) (unsigned char) pName[0]) | ((uint32_t) (unsigned char) pName[1]) << 8 |
+    ((uint32_t) (unsigned char) pName[2]) << 16 | ((uint32_t) (unsigned char) pName[3]) << 24;
+}
+
+// Close()
+void BinaryGenerator::Close(void) {
+#ifdef FAUDES_POSIX
+  if(mpData && mMapped) munmap((void*) mpData,mSize);
+#endif
+  std::vector<char>().swap(mBuffer);
+  mpData=0;
+  mSize=0;
+  mMapped=false;
+  mSections.clear();
+  mAlphSize=0;
+  mStatSize=0;
+  mTransSize=0;
+  mpAlph=0;
+  mpEnof=0;
+  mpEnam=0;
+  mpStat=0;
+  mpSnof=0;
+  mpSnam=0;
+  mpInit=0;
+  mpMark=0;
+  mpToff=0;
+  mpTrev=0;
+  mpTrx2=0;
+}
+
+// Section(tag,pSize)
+const void* BinaryGenerator::Section(uint32_t tag, uint64_t* pSize) const {
+  std::map< uint32_t, std::pair<uint64_t,uint64_t> >::const_iterator sit=mSections.find(tag);
+  if(sit==mSections.end()) {
+    if(pSize) *pSize=0;
+    return 0;
+  }
+  if(pSize) *pSize=sit->second.second;
+  return mpData+sit->second.first;
+}
+
+// Array(tag,count)
+// (section must be present with exact size)
+template<class T>
+const T* BinaryGenerator::Array(const char* pTag, uint64_t count) const {
+  uint64_t size;
+  const void* data=Section(Tag(pTag),&size);
+  if(!data || size!=count*sizeof(T)) {
+    std::stringstream errstr;
+    errstr << "missing or invalid section " << std::string(pTag,4);
+    throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+  }
+  return (const T*) data;
+}
+
+// Open(rFileName)
+void BinaryGenerator::Open(const std::string& rFileName) {
+  FD_DG("BinaryGenerator::Open(" << rFileName << ")");
+  Close();
+  // map file
+#ifdef FAUDES_POSIX
+  int fd=open(rFileName.c_str(),O_RDONLY);
+  struct stat st;
+  if(fd>=0 && fstat(fd,&st)==0 && st.st_size>0) {
+    void* data=mmap(0,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+    if(data!=MAP_FAILED) {
+      mpData=(const char*) data;
+      mSize=st.st_size;
+      mMapped=true;
+    }
+  }
+  if(fd>=0) close(fd);
+#else
+  std::ifstream fin(rFileName.c_str(), std::ios::in|std::ios::binary);
+  if(fin.good()) {
+    fin.seekg(0,std::ios::end);
+    std::streamoff size=fin.tellg();
+    fin.seekg(0,std::ios::beg);
+    if(size>0) {
+      mBuffer.resize(size);
+      fin.read(&mBuffer[0],size);
+      if(fin.good()) {
+        mpData=&mBuffer[0];
+        mSize=size;
+      }
+    }
+  }
+#endif
+  if(!mpData) {
+    Close();
+    std::stringstream errstr;
+    errstr << "Exception opening/mapping binary file \"" << rFileName << "\"";
+    throw Exception("BinaryGenerator::Open", errstr.str(), 1);
+  }
+  // validate header and directory, record sections
+  try {
+    if(mSize<BinGenHeaderSize || std::memcmp(mpData,BinGenMagic,8)!=0) {
+      std::stringstream errstr;
+      errstr << "not a binary generator file";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    const uint32_t* head=(const uint32_t*) (mpData+8);
+    if(head[0]!=BinGenBom || head[1]!=BinGenVersion) {
+      std::stringstream errstr;
+      errstr << "byte order or version mismatch";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    uint64_t nsec=head[2];
+    if(mSize < BinGenHeaderSize + BinGenDirEntrySize*nsec) {
+      std::stringstream errstr;
+      errstr << "truncated section directory";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    for(uint64_t i=0; i<nsec; ++i) {
+      const char* entry=mpData+BinGenHeaderSize+BinGenDirEntrySize*i;
+      uint32_t tag=((const uint32_t*) entry)[0];
+      uint64_t offset=((const uint64_t*) entry)[1];
+      uint64_t size=((const uint64_t*) entry)[2];
+      if(offset%8!=0 || offset>mSize || size>mSize-offset) {
+        std::stringstream errstr;
+        errstr << "invalid section " << std::string(entry,4);
+        throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+      }
+      mSections[tag]=std::make_pair(offset,size);
+    }
+    // resolve core sections
+    uint64_t size;
+    Section(Tag("ALPH"),&size);
+    mAlphSize=size/4;
+    Section(Tag("STAT"),&size);
+    mStatSize=size/4;
+    Section(Tag("TREV"),&size);
+    mTransSize=size/4;
+    mpAlph=Array<uint32_t>("ALPH",mAlphSize);
+    mpEnof=Array<uint64_t>("ENOF",mAlphSize+1);
+    Section(Tag("ENAM"),&size);
+    mpEnam=Array<char>("ENAM",size);
+    mpStat=Array<uint32_t>("STAT",mStatSize);
+    mpInit=Array<uint64_t>("INIT",(mStatSize >> 6)+1);
+    mpMark=Array<uint64_t>("MARK",(mStatSize >> 6)+1);
+    mpToff=Array<uint32_t>("TOFF",mStatSize+1);
+    mpTrev=Array<uint32_t>("TREV",mTransSize);
+    mpTrx2=Array<uint32_t>("TRX2",mTransSize);
+    bool ok = mpEnof[0]==0 && mpEnof[mAlphSize]==size;
+    for(Idx pos=0; ok && pos<mAlphSize; ++pos)
+      ok = mpEnof[pos]<=mpEnof[pos+1];
+    ok = ok && mpToff[0]==0 && mpToff[mStatSize]==mTransSize;
+    for(Idx pos=0; ok && pos<mStatSize; ++pos)
+      ok = mpToff[pos]<=mpToff[pos+1];
+    if(Section(Tag("SNOF"))) {
+      Section(Tag("SNAM"),&size);
+      mpSnof=Array<uint64_t>("SNOF",mStatSize+1);
+      mpSnam=Array<char>("SNAM",size);
+      ok = ok && mpSnof[0]==0 && mpSnof[mStatSize]==size;
+      for(Idx pos=0; ok && pos<mStatSize; ++pos)
+        ok = mpSnof[pos]<=mpSnof[pos+1];
+    }
+    if(!ok) {
+      std::stringstream errstr;
+      errstr << "inconsistent offsets";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    // event and state indices: sorted, non-zero, events named
+    for(Idx pos=0; ok && pos<mAlphSize; ++pos)
+      ok = mpAlph[pos]!=0 && (pos==0 || mpAlph[pos-1]<mpAlph[pos]) && mpEnof[pos]<mpEnof[pos+1];
+    for(Idx pos=0; ok && pos<mStatSize; ++pos)
+      ok = mpStat[pos]!=0 && (pos==0 || mpStat[pos-1]<mpStat[pos]);
+    if(!ok) {
+      std::stringstream errstr;
+      errstr << "invalid event or state indices";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    // transitions: listed events and states, per state in Ev-X2 order
+    for(Idx pos=0; ok && pos<mStatSize; ++pos) {
+      for(Idx tpos=mpToff[pos]; ok && tpos<mpToff[pos+1]; ++tpos) {
+        ok = std::binary_search(mpAlph,mpAlph+mAlphSize,mpTrev[tpos]);
+        ok = ok && std::binary_search(mpStat,mpStat+mStatSize,mpTrx2[tpos]);
+        if(ok && tpos>mpToff[pos])
+          ok = mpTrev[tpos-1]<mpTrev[tpos] || (mpTrev[tpos-1]==mpTrev[tpos] && mpTrx2[tpos-1]<mpTrx2[tpos]);
+      }
+    }
+    if(!ok) {
+      std::stringstream errstr;
+      errstr << "invalid transition relation";
+      throw Exception("BinaryGenerator::Open", errstr.str(), 50);
+    }
+    // optional flags
+    if(Section(Tag("EFLG"))) Array<uint64_t>("EFLG",mAlphSize);
+    if(Section(Tag("SFLG"))) Array<uint64_t>("SFLG",mStatSize);
+  } catch (Exception&) {
+    Close();
+    throw;
+  }
+  FD_DG("BinaryGenerator::Open(" << rFileName << "): #states " << mStatSize << " #trans " << mTransSize);
+}
+
+// Name()
+std::string BinaryGenerator::Name(void) const {
+  uint64_t size;
+  const char* data=(const char*) Section(Tag("NAME"),&size);
+  if(!data) return std::string();
+  return std::string(data,size);
+}
+
+// PositionError(pFunction,pos,size)
+void BinaryGenerator::PositionError(const char* pFunction, Idx pos, Idx size) const {
+  std::stringstream errstr;
+  errstr << "position " << pos << " out of range (size " << size << ")";
+  throw Exception(std::string("BinaryGenerator::")+pFunction, errstr.str(), 62);
+}
+
+// EventName(pos)
+std::string BinaryGenerator::EventName(Idx pos) const {
+  CheckPos("EventName",pos,mAlphSize);
+  return std::string(mpEnam+mpEnof[pos],mpEnof[pos+1]-mpEnof[pos]);
+}
+
+// StatePos(index)
+Idx BinaryGenerator::StatePos(Idx index) const {
+  const uint32_t* pit=std::lower_bound(mpStat,mpStat+mStatSize,index);
+  if(pit==mpStat+mStatSize || *pit!=index) return mStatSize;
+  return (Idx) (pit - mpStat);
+}
+
+// StateName(pos)
+std::string BinaryGenerator::StateName(Idx pos) const {
+  CheckPos("StateName",pos,mStatSize);
+  if(!mpSnof) return std::string();
+  return std::string(mpSnam+mpSnof[pos],mpSnof[pos+1]-mpSnof[pos]);
+}
+
+// ToGenerator(rGen)
+void BinaryGenerator::ToGenerator(vGenerator& rGen) const {
+  FD_DG("BinaryGenerator::ToGenerator(" << &rGen << ")");
+  if(!IsOpen()) {
+    std::stringstream errstr;
+    errstr << "no binary generator file open";
+    throw Exception("BinaryGenerator::ToGenerator", errstr.str(), 50);
+  }
+  rGen.Clear();
+  rGen.Name(Name());
+  // events: translate by name
+  std::vector<Idx> evmap(mAlphSize);
+  bool remap=false;
+  for(Idx pos=0; pos<mAlphSize; ++pos) {
+    evmap[pos]=rGen.InsEvent(EventName(pos));
+    if(evmap[pos]!=mpAlph[pos]) remap=true;
+  }
+  // states
+  StateSet states;
+  StateSet initstates;
+  StateSet markedstates;
+  for(Idx pos=0; pos<mStatSize; ++pos) {
+    states.Inject(states.End(),mpStat[pos]);
+    if(InitState(pos)) initstates.Inject(initstates.End(),mpStat[pos]);
+    if(MarkedState(pos)) markedstates.Inject(markedstates.End(),mpStat[pos]);
+  }
+  rGen.InjectStates(states);
+  rGen.InjectInitStates(initstates);
+  rGen.InjectMarkedStates(markedstates);
+  if(mpSnof) {
+    for(Idx pos=0; pos<mStatSize; ++pos)
+      if(mpSnof[pos+1]>mpSnof[pos]) rGen.StateName(mpStat[pos],StateName(pos));
+  }
+  // transitions: in order, or re-sorted if event indices were translated
+  // (Open() has validated the order and that all events and successors are listed)
+  TransSet transrel;
+  if(!remap) {
+    for(Idx pos=0; pos<mStatSize; ++pos)
+      for(Idx tpos=mpToff[pos]; tpos<mpToff[pos+1]; ++tpos)
+        transrel.Inject(transrel.End(),Transition(mpStat[pos],mpTrev[tpos],mpTrx2[tpos]));
+  } else {
+    std::vector<Transition> tvec;
+    tvec.reserve(mTransSize);
+    for(Idx pos=0; pos<mStatSize; ++pos)
+      for(Idx tpos=mpToff[pos]; tpos<mpToff[pos+1]; ++tpos) {
+        Idx epos=(Idx) (std::lower_bound(mpAlph,mpAlph+mAlphSize,mpTrev[tpos]) - mpAlph);
+        tvec.push_back(Transition(mpStat[pos],evmap[epos],mpTrx2[tpos]));
+      }
+    std::sort(tvec.begin(),tvec.end());
+    for(std::size_t i=0; i<tvec.size(); ++i)
+      transrel.Inject(transrel.End(),tvec[i]);
+  }
+  rGen.InjectTransRel(transrel);
+  // event flags
+  const uint64_t* eflg=(const uint64_t*) Section(Tag("EFLG"));
+  if(eflg && dynamic_cast<const AttributeFlags*>(rGen.Alphabet().AttributeType())) {
+    for(Idx pos=0; pos<mAlphSize; ++pos) {
+      AttributeFlags* attr=dynamic_cast<AttributeFlags*>(rGen.EventAttributep(evmap[pos]));
+      if(attr) attr->mFlags=(fType) eflg[pos];
+    }
+  }
+  // state flags
+  const uint64_t* sflg=(const uint64_t*) Section(Tag("SFLG"));
+  if(sflg && dynamic_cast<const AttributeFlags*>(rGen.States().AttributeType())) {
+    for(Idx pos=0; pos<mStatSize; ++pos) {
+      AttributeFlags* attr=dynamic_cast<AttributeFlags*>(rGen.StateAttributep(mpStat[pos]));
+      if(attr) attr->mFlags=(fType) sflg[pos];
+    }
+  }
+  FD_DG("BinaryGenerator::ToGenerator(" << &rGen << "): done");
+}
+
+// TransRel(rTransRel)
+void BinaryGenerator::TransRel(CompactTransSet& rTransRel) const {
+  FD_DG("BinaryGenerator::TransRel(CompactTransSet&)");
+  if(!IsOpen()) {
+    std::stringstream errstr;
+    errstr << "no binary generator file open";
+    throw Exception("BinaryGenerator::TransRel", errstr.str(), 50);
+  }
+  rTransRel.Clear();
+  rTransRel.Reserve(mTransSize);
+  // events: translate by name
+  SymbolTable* symtab=SymbolTable::GlobalEventSymbolTablep();
+  std::vector<Idx> evmap(mAlphSize);
+  bool remap=false;
+  for(Idx pos=0; pos<mAlphSize; ++pos) {
+    evmap[pos]=symtab->InsEntry(EventName(pos));
+    if(evmap[pos]!=mpAlph[pos]) remap=true;
+  }
+  // transitions per state: in order, or re-sorted if event indices were translated
+  // (Open() has validated the order and that all events and successors are listed)
+  std::vector< std::pair<Idx,Idx> > evx2;
+  for(Idx pos=0; pos<mStatSize; ++pos) {
+    Idx x1=mpStat[pos];
+    if(!remap) {
+      for(Idx tpos=mpToff[pos]; tpos<mpToff[pos+1]; ++tpos)
+        rTransRel.Insert(x1,mpTrev[tpos],mpTrx2[tpos]);
+      continue;
+    }
+    evx2.clear();
+    for(Idx tpos=mpToff[pos]; tpos<mpToff[pos+1]; ++tpos) {
+      Idx epos=(Idx) (std::lower_bound(mpAlph,mpAlph+mAlphSize,mpTrev[tpos]) - mpAlph);
+      evx2.push_back(std::make_pair(evmap[epos],(Idx) mpTrx2[tpos]));
+    }
+    std::sort(evx2.begin(),evx2.end());
+    for(std::size_t i=0; i<evx2.size(); ++i)
+      rTransRel.Insert(x1,evx2[i].first,evx2[i].second);
+  }
+  FD_DG("BinaryGenerator::TransRel(CompactTransSet&): done");
+}
+
+
+} // namespace faudes
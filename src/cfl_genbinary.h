@@ -0,0 +1,306 @@
+/** @file cfl_genbinary.h Binary generator file format with memory-mapped access */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_GENBINARY_H
+#define FAUDES_GENBINARY_H
+
+#include "cfl_definitions.h"
+#include "cfl_generator.h"
+#include "cfl_compacttransset.h"
+#include <vector>
+#include <map>
+
+namespace faudes {
+
+/**
+ * Read-only access to a generator in binary file format.
+ *
+ * The binary format is an alternative to the token based .gen format for very
+ * large generators. It consists of a fixed header, a section directory and a
+ * sequence of 8-byte aligned sections, each identified by a four character tag:
+ *
+ * - NAME: generator name
+ * - ALPH, ENOF, ENAM: event indices (sorted), name offsets and name characters
+ * - STAT, SNOF, SNAM: state indices (sorted), name offsets and name characters
+ * - INIT, MARK: bit vectors over state positions
+ * - TOFF, TREV, TRX2: transition relation in CSR layout, i.e. per state position an
+ *   offset into the event and successor columns; successors are state indices
+ * - EFLG, SFLG: optional event and state attribute flags, see AttributeFlags
+ *
+ * Integers are stored in native byte order; the header holds a byte order mark
+ * and files written on a platform with different byte order are rejected. Further
+ * sections may be added by plugins, e.g. for acceptance conditions; unknown
+ * sections are ignored.
+ *
+ * A BinaryGenerator maps the file into memory (POSIX mmap, or a plain read on other
+ * platforms) and provides direct access to the stored arrays without any parsing,
+ * e.g. for read-only algorithms that iterate the transition relation. Event indices
+ * in the file refer to the symbol table of the writing process; they are translated
+ * by name when the file is converted to a vGenerator by ToGenerator(). States are
+ * referred to by their position 0 ... Size()-1 in the sorted array of state indices.
+ *
+ * @ingroup GeneratorClasses
+ */
+class FAUDES_API BinaryGenerator {
+
+public:
+
+  /** Construct closed instance */
+  BinaryGenerator(void);
+
+  /** Construct and open file */
+  explicit BinaryGenerator(const std::string& rFileName);
+
+  /** Destructor, closes the file */
+  ~BinaryGenerator(void);
+
+  /**
+   * Open and validate file.
+   *
+   * @param rFileName
+   *   File to open
+   * The file is validated on opening: the arrays of event and state indices must
+   * be sorted and non-zero, offsets must be consistent, and the transition relation
+   * must refer to listed events and states in X1-Ev-X2 order. Thus, accessing the
+   * arrays via positions within the respective ranges is safe thereafter.
+   *
+   * @exception Exception
+   *   - cannot open or map file (id 1)
+   *   - invalid header, byte order, section layout or contents (id 50)
+   */
+  void Open(const std::string& rFileName);
+
+  /** Release file */
+  void Close(void);
+
+  /** Test whether a file is open */
+  bool IsOpen(void) const { return mpData!=0; };
+
+  /** Section tag from four characters */
+  static uint32_t Tag(const char* pName);
+
+  /**
+   * Access section.
+   *
+   * @param tag
+   *   Section tag, see Tag()
+   * @param pSize
+   *   If not NULL, receives the section size in bytes
+   * @return
+   *   Pointer to section payload, or NULL if the section is not present
+   */
+  const void* Section(uint32_t tag, uint64_t* pSize=0) const;
+
+  /** Generator name */
+  std::string Name(void) const;
+
+  /** Number of events */
+  Idx AlphabetSize(void) const { return mAlphSize; };
+
+  /** Event index (as written) at position pos */
+  Idx Event(Idx pos) const { CheckPos("Event",pos,mAlphSize); return mpAlph[pos]; };
+
+  /** Event name at position pos */
+  std::string EventName(Idx pos) const;
+
+  /** Number of states */
+  Idx Size(void) const { return mStatSize; };
+
+  /** State index at position pos */
+  Idx State(Idx pos) const { CheckPos("State",pos,mStatSize); return mpStat[pos]; };
+
+  /** Position of state index, Size() if not a state */
+  Idx StatePos(Idx index) const;
+
+  /** State name at position pos, empty string if not named */
+  std::string StateName(Idx pos) const;
+
+  /** Test for initial state at position pos */
+  bool InitState(Idx pos) const { 
+    CheckPos("InitState",pos,mStatSize); 
+    return (mpInit[pos >> 6] >> (pos & 63)) & 1; 
+  };
+
+  /** Test for marked state at position pos */
+  bool MarkedState(Idx pos) const { 
+    CheckPos("MarkedState",pos,mStatSize); 
+    return (mpMark[pos >> 6] >> (pos & 63)) & 1; 
+  };
+
+  /** Number of transitions */
+  Idx TransRelSize(void) const { return mTransSize; };
+
+  /** First transition position of the state at position pos */
+  Idx TransBegin(Idx pos) const { CheckPos("TransBegin",pos,mStatSize); return mpToff[pos]; };
+
+  /** Transition position beyond the last transition of the state at position pos */
+  Idx TransEnd(Idx pos) const { CheckPos("TransEnd",pos,mStatSize); return mpToff[pos+1]; };
+
+  /** Event index (as written) of transition at position tpos */
+  Idx TransEv(Idx tpos) const { CheckPos("TransEv",tpos,mTransSize); return mpTrev[tpos]; };
+
+  /** Successor state index of transition at position tpos */
+  Idx TransX2(Idx tpos) const { CheckPos("TransX2",tpos,mTransSize); return mpTrx2[tpos]; };
+
+  /**
+   * Convert to generator.
+   *
+   * The core of rGen is replaced by the generator stored in the file. Event
+   * indices are translated via the event names and the symbol table of rGen.
+   * Event and state flags are restored if the respective attributes of rGen
+   * are derived from AttributeFlags.
+   *
+   * @param rGen
+   *   Generator to set up
+   * @exception Exception
+   *   - no file open (id 50)
+   */
+  void ToGenerator(vGenerator& rGen) const;
+
+  /**
+   * Load transition relation in compact representation.
+   *
+   * The transition relation is copied to rTransRel without building a TransSet,
+   * i.e., with 8 bytes per transition and 4 bytes per state index. Event indices 
+   * are translated via the event names and the global event symbol table, state 
+   * indices are used as stored.
+   *
+   * @param rTransRel
+   *   Transition relation to set up
+   * @exception Exception
+   *   - no file open (id 50)
+   */
+  void TransRel(CompactTransSet& rTransRel) const;
+
+protected:
+
+  /** Not copyable */
+  BinaryGenerator(const BinaryGenerator&);
+
+  /** Not copyable */
+  BinaryGenerator& operator=(const BinaryGenerator&);
+
+  /** Position range check, throws exception 62 if pos >= size (FAUDES_CHECKED only) */
+  void CheckPos(const char* pFunction, Idx pos, Idx size) const {
+#ifdef FAUDES_CHECKED
+    if(pos>=size) PositionError(pFunction,pos,size);
+#endif
+  };
+
+  /** Throw exception for position out of range */
+  void PositionError(const char* pFunction, Idx pos, Idx size) const;
+
+  /** Typed section access incl. size check (element count) */
+  template<class T>
+  const T* Array(const char* pTag, uint64_t count) const;
+
+  /** File data */
+  const char* mpData;
+
+  /** File size */
+  std::size_t mSize;
+
+  /** True if mpData is mapped (rather than read to mBuffer) */
+  bool mMapped;
+
+  /** Buffer for platforms without mmap */
+  std::vector<char> mBuffer;
+
+  /** Section directory: tag to offset and size */
+  std::map< uint32_t, std::pair<uint64_t,uint64_t> > mSections;
+
+  /** Cached counts */
+  Idx mAlphSize;
+  Idx mStatSize;
+  Idx mTransSize;
+
+  /** Cached section pointers */
+  const uint32_t* mpAlph;
+  const uint64_t* mpEnof;
+  const char* mpEnam;
+  const uint32_t* mpStat;
+  const uint64_t* mpSnof;
+  const char* mpSnam;
+  const uint64_t* mpInit;
+  const uint64_t* mpMark;
+  const uint32_t* mpToff;
+  const uint32_t* mpTrev;
+  const uint32_t* mpTrx2;
+
+};
+
+
+/**
+ * Write generator in binary file format.
+ *
+ * See BinaryGenerator for the file format. Event and state flags are written if
+ * the respective attributes are derived from AttributeFlags.
+ *
+ * @param rGen
+ *   Generator to write
+ * @param rFileName
+ *   File to write
+ * @exception Exception
+ *   - cannot open or write file (id 2)
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API void BinaryWrite(const vGenerator& rGen, const std::string& rFileName);
+
+/**
+ * Write generator in binary file format, incl. additional sections.
+ *
+ * @param rGen
+ *   Generator to write
+ * @param rFileName
+ *   File to write
+ * @param rExtra
+ *   Additional sections, tag to payload
+ * @exception Exception
+ *   - cannot open or write file (id 2)
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API void BinaryWrite(const vGenerator& rGen, const std::string& rFileName,
+  const std::map<uint32_t,std::string>& rExtra);
+
+/**
+ * Read generator from binary file format.
+ *
+ * Convenience wrapper for BinaryGenerator::ToGenerator().
+ *
+ * @param rFileName
+ *   File to read
+ * @param rGen
+ *   Generator to set up
+ * @exception Exception
+ *   - cannot open file (id 1)
+ *   - invalid file format (id 50)
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API void BinaryRead(const std::string& rFileName, vGenerator& rGen);
+
+
+} // namespace faudes
+
+#endif
@@ -0,0 +1,131 @@
+/** @file cfl_genbuilder.cpp Append-then-sort construction of generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_genbuilder.h"
+#include <algorithm>
+
+namespace faudes {
+
+// helper: sort and remove duplicates
+template<class T>
+static void GenBuilderSortUnique(std::vector<T>& rVec) {
+  std::sort(rVec.begin(),rVec.end());
+  rVec.erase(std::unique(rVec.begin(),rVec.end()),rVec.end());
+}
+
+// helper: sorted vector to set by in-order insertion
+template<class V, class S>
+static void GenBuilderFill(const V& rVec, S& rSet) {
+  typename V::const_iterator vit=rVec.begin();
+  typename V::const_iterator vit_end=rVec.end();
+  for(;vit!=vit_end;++vit) rSet.Inject(rSet.End(),*vit);
+}
+
+#ifdef FAUDES_CHECKED
+// helper: test states for existence
+static void GenBuilderCheckStates(const std::vector<Idx>& rStates,
+  const std::vector<Idx>& rSub, const std::string& rWhat) 
+{
+  std::vector<Idx>::const_iterator sit=rSub.begin();
+  for(;sit!=rSub.end();++sit) {
+    if(std::binary_search(rStates.begin(),rStates.end(),*sit)) continue;
+    std::stringstream errstr;
+    errstr << rWhat << " " << *sit << " not in stateset";
+    throw Exception("GeneratorBuilder::Finalize(..)", errstr.str(), 95);
+  }
+}
+#endif
+
+// construct
+GeneratorBuilder::GeneratorBuilder(void) : mMaxStateIndex(0) {}
+
+// Clear()
+void GeneratorBuilder::Clear(void) {
+  mAlphabet.Clear();
+  std::vector<Idx>().swap(mStates);
+  std::vector<Idx>().swap(mInitStates);
+  std::vector<Idx>().swap(mMarkedStates);
+  std::vector<Transition>().swap(mTransRel);
+  std::vector< std::pair<Idx,std::string> >().swap(mStateNames);
+  mMaxStateIndex=0;
+}
+
+// Reserve(states,transitions)
+void GeneratorBuilder::Reserve(Idx states, Idx transitions) {
+  mStates.reserve(states);
+  mTransRel.reserve(transitions);
+}
+
+// Finalize(rGen)
+void GeneratorBuilder::Finalize(vGenerator& rGen) {
+  FD_DG("GeneratorBuilder::Finalize(" << &rGen << "): #states " << mStates.size() 
+    << " #trans " << mTransRel.size());
+  // sort and dedup
+  GenBuilderSortUnique(mStates);
+  GenBuilderSortUnique(mInitStates);
+  GenBuilderSortUnique(mMarkedStates);
+  GenBuilderSortUnique(mTransRel);
+#ifdef FAUDES_CHECKED
+  GenBuilderCheckStates(mStates,mInitStates,"initial state");
+  GenBuilderCheckStates(mStates,mMarkedStates,"marked state");
+  std::vector<Transition>::const_iterator tit=mTransRel.begin();
+  for(;tit!=mTransRel.end();++tit) {
+    if(!std::binary_search(mStates.begin(),mStates.end(),tit->X1) ||
+       !std::binary_search(mStates.begin(),mStates.end(),tit->X2) ||
+       !mAlphabet.Exists(tit->Ev)) {
+      std::stringstream errstr;
+      errstr << "transition " << tit->Str() << " refers to unknown state or event";
+      throw Exception("GeneratorBuilder::Finalize(..)", errstr.str(), 95);
+    }
+  }
+#endif
+  // build sets by in-order insertion
+  StateSet states;
+  GenBuilderFill(mStates,states);
+  std::vector<Idx>().swap(mStates);
+  StateSet initstates;
+  GenBuilderFill(mInitStates,initstates);
+  std::vector<Idx>().swap(mInitStates);
+  StateSet markedstates;
+  GenBuilderFill(mMarkedStates,markedstates);
+  std::vector<Idx>().swap(mMarkedStates);
+  TransSet transrel;
+  GenBuilderFill(mTransRel,transrel);
+  std::vector<Transition>().swap(mTransRel);
+  // hand over to generator (shallow copies)
+  rGen.Clear();
+  rGen.InjectAlphabet(mAlphabet);
+  rGen.InjectStates(states);
+  rGen.InjectInitStates(initstates);
+  rGen.InjectMarkedStates(markedstates);
+  rGen.InjectTransRel(transrel);
+  // state names
+  std::vector< std::pair<Idx,std::string> >::const_iterator nit=mStateNames.begin();
+  for(;nit!=mStateNames.end();++nit)
+    rGen.StateName(nit->first,nit->second);
+  // reset builder
+  Clear();
+  FD_DG("GeneratorBuilder::Finalize(" << &rGen << "): done");
+}
+
+
+} // namespace faudes
@@ -0,0 +1,168 @@
+/** @file cfl_genbuilder.h Append-then-sort construction of generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_GENBUILDER_H
+#define FAUDES_GENBUILDER_H
+
+#include "cfl_definitions.h"
+#include "cfl_generator.h"
+#include <vector>
+
+namespace faudes {
+
+/**
+ * Bulk construction of generators.
+ *
+ * Algorithms that compute a result generator state by state, e.g. Parallel() or
+ * Product(), typically call InsState() and SetTransition() in their inner loop,
+ * and each call amounts to a tree insertion plus a consistency check. The
+ * GeneratorBuilder instead records states, events, transitions, initial and
+ * marked states in plain append-only buffers. Finalize() then sorts and
+ * de-duplicates each buffer once, builds the core sets by in-order insertion
+ * and injects them into the target generator. Since the injection is a shallow
+ * copy whenever the attribute types match, the sets built by Finalize() are
+ * handed over to the generator without a further copy.
+ *
+ * State indices issued by InsState() are consecutive, starting with 1, and
+ * coincide with the indices a freshly cleared vGenerator would issue. Explicit
+ * indices may be mixed in via InsState(Idx). Consistency, i.e., that all
+ * referenced states have been inserted, is checked once in Finalize() when
+ * compiled with FAUDES_CHECKED.
+ *
+ * @ingroup GeneratorClasses
+ */
+class FAUDES_API GeneratorBuilder {
+
+public:
+
+  /** Construct empty builder */
+  GeneratorBuilder(void);
+
+  /** Discard all recorded items */
+  void Clear(void);
+
+  /** Reserve buffer capacity for the expected number of states and transitions */
+  void Reserve(Idx states, Idx transitions);
+
+  /** Record event by index */
+  void InsEvent(Idx ev) { mAlphabet.Insert(ev); };
+
+  /** Record event by name */
+  Idx InsEvent(const std::string& rName) { return mAlphabet.Insert(rName); };
+
+  /** Record all events of an alphabet */
+  void InsEvents(const EventSet& rEvents) { mAlphabet.InsertSet(rEvents); };
+
+  /** Record a new state with the next free index and return that index */
+  Idx InsState(void) {
+    mStates.push_back(++mMaxStateIndex);
+    return mMaxStateIndex;
+  };
+
+  /** Record state with specified index */
+  void InsState(Idx index) {
+    mStates.push_back(index);
+    if(index>mMaxStateIndex) mMaxStateIndex=index;
+  };
+
+  /** Record a new initial state and return its index */
+  Idx InsInitState(void) {
+    Idx index=InsState();
+    mInitStates.push_back(index);
+    return index;
+  };
+
+  /** Record a new marked state and return its index */
+  Idx InsMarkedState(void) {
+    Idx index=InsState();
+    mMarkedStates.push_back(index);
+    return index;
+  };
+
+  /** Mark state as initial state */
+  void SetInitState(Idx index) { mInitStates.push_back(index); };
+
+  /** Mark state as marked state */
+  void SetMarkedState(Idx index) { mMarkedStates.push_back(index); };
+
+  /** Record state name */
+  void StateName(Idx index, const std::string& rName) {
+    mStateNames.push_back(std::make_pair(index,rName));
+  };
+
+  /** Record transition */
+  void SetTransition(Idx x1, Idx ev, Idx x2) { mTransRel.push_back(Transition(x1,ev,x2)); };
+
+  /** Record transition */
+  void SetTransition(const Transition& rTrans) { mTransRel.push_back(rTrans); };
+
+  /** Largest state index issued or recorded so far */
+  Idx MaxStateIndex(void) const { return mMaxStateIndex; };
+
+  /** Number of transitions recorded so far, incl. duplicates */
+  Idx TransRelSize(void) const { return (Idx) mTransRel.size(); };
+
+  /**
+   * Build generator from recorded items.
+   *
+   * The core of rGen, i.e. alphabet, states, initial and marked states,
+   * transition relation and state names, is replaced by the recorded items.
+   * Attributes of rGen are reset to their defaults, the generator name is
+   * maintained. The builder is cleared and releases its buffers.
+   *
+   * @param rGen
+   *   Generator to set up
+   * @exception Exception
+   *   - transition or initial/marked state refers to an unknown state (id 95)
+   *   - transition refers to an unknown event (id 95)
+   */
+  void Finalize(vGenerator& rGen);
+
+protected:
+
+  /** Alphabet */
+  EventSet mAlphabet;
+
+  /** States, unsorted */
+  std::vector<Idx> mStates;
+
+  /** Initial states, unsorted */
+  std::vector<Idx> mInitStates;
+
+  /** Marked states, unsorted */
+  std::vector<Idx> mMarkedStates;
+
+  /** Transitions, unsorted */
+  std::vector<Transition> mTransRel;
+
+  /** State names */
+  std::vector< std::pair<Idx,std::string> > mStateNames;
+
+  /** Largest state index */
+  Idx mMaxStateIndex;
+
+};
+
+
+} // namespace faudes
+
+#endif
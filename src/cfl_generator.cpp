@@ -22,7 +22,11 @@
 
 
 #include "cfl_generator.h"
+#include "cfl_densestateset.h"
 #include <stack>
+#include <atomic>
+#include <limits>
+#include <algorithm>
 
 //locval debug
 //#undef FD_DG
@@ -31,7 +35,11 @@
 namespace faudes {
 
 // msObjectCount (static) 
+#ifdef FAUDES_THREADS
+std::atomic<Idx> vGenerator::msObjectCount(0);
+#else
 Idx vGenerator::msObjectCount = 0;
+#endif
 
 // State names default (static) 
 bool vGenerator::msStateNamesEnabledDefault = true;
@@ -75,6 +83,8 @@ vGenerator::vGenerator(void) :
   mpAlphabet(0),
   mpStates(0),
   mpTransRel(0),
+  mpTransRelX2EvX1(0),
+  mpTransRelEvX1X2(0),
   mpGlobalAttribute(0),
   // initialise prototypes
   pAlphabetPrototype(&AlphabetVoid()),
@@ -83,10 +93,12 @@ vGenerator::vGenerator(void) :
   pGlobalPrototype(&GlobalVoid())
 {
   FAUDES_OBJCOUNT_INC("Generator");
+#ifdef FAUDES_THREADS
+  faudes_mutex_init(&mCacheMutex);
+#endif
   FD_DG("vGenerator(" << this << ")::vGenerator()");
   // track generator objects
-  msObjectCount++; 
-  mId = msObjectCount;
+  mId = ++msObjectCount;
   // overwrite base defaults
   mObjectName="Generator",
   // allocate core members
@@ -110,6 +122,8 @@ vGenerator::vGenerator(const vGenerator& rOtherGen) :
   mpAlphabet(0),
   mpStates(0),
   mpTransRel(0),
+  mpTransRelX2EvX1(0),
+  mpTransRelEvX1X2(0),
   mpGlobalAttribute(0),
   // initialise prototypes
   pAlphabetPrototype(&AlphabetVoid()),
@@ -118,10 +132,12 @@ vGenerator::vGenerator(const vGenerator& rOtherGen) :
   pGlobalPrototype(&GlobalVoid())
 {
   FAUDES_OBJCOUNT_INC("Generator");
+#ifdef FAUDES_THREADS
+  faudes_mutex_init(&mCacheMutex);
+#endif
   FD_DG("vGenerator(" << this << ")::vGenerator(" << &rOtherGen << ")");
   // track generator objects
-  msObjectCount++; 
-  mId = msObjectCount;
+  mId = ++msObjectCount;
   // overwrite base defaults
   mObjectName="Generator",
   // allocate core members
@@ -144,6 +160,8 @@ vGenerator::vGenerator(const std::string& rFileName) :
   mpAlphabet(0),
   mpStates(0),
   mpTransRel(0),
+  mpTransRelX2EvX1(0),
+  mpTransRelEvX1X2(0),
   mpGlobalAttribute(0),
   // initialise prototypes
   pAlphabetPrototype(&AlphabetVoid()),
@@ -152,10 +170,12 @@ vGenerator::vGenerator(const std::string& rFileName) :
   pGlobalPrototype(&GlobalVoid())
 {
   FAUDES_OBJCOUNT_INC("Generator");
+#ifdef FAUDES_THREADS
+  faudes_mutex_init(&mCacheMutex);
+#endif
   FD_DG("vGenerator(" << this << ")::vGenerator(" << rFileName << ")");
   // track generator objects
-  msObjectCount++; 
-  mId = msObjectCount;
+  mId = ++msObjectCount;
   // overwrite base defaults
   mObjectName="Generator",
   // allocate core members
@@ -202,6 +222,9 @@ vGenerator::~vGenerator(void) {
   FAUDES_OBJCOUNT_DEC("Generator");
   // free my members
   DeleteCore();
+#ifdef FAUDES_THREADS
+  faudes_mutex_destroy(&mCacheMutex);
+#endif
 }
 
 // configure attribute types
@@ -218,6 +241,8 @@ void vGenerator::ConfigureAttributeTypes(const AttributeVoid* pNewGlobalPrototyp
 
 // indicate new core
 void vGenerator::UpdateCore(void) {
+  // invalidate cached indices
+  ClearTransRelIndices();
   // fix std names
   if(mpAlphabet) mpAlphabet->Name("Alphabet");
   if(mpStates) mpStates->Name("States");
@@ -275,8 +300,9 @@ void vGenerator::DoAssign(const vGenerator& rGen) {
   ReindexOnWrite(rGen.ReindexOnWrite());
   InjectInitStates(rGen.mInitStates);
   InjectMarkedStates(rGen.mMarkedStates);
-  // core members, try attributes
-  InjectStates(*rGen.mpStates);
+  // core members, try attributes (state symbols are consistent with source states)
+  *mpStates=*rGen.mpStates;
+  mpStates->Name("States");
   InjectAlphabet(*rGen.mpAlphabet);
   InjectTransRel(*rGen.mpTransRel);
   GlobalAttributeTry(*rGen.mpGlobalAttribute);
@@ -324,6 +350,7 @@ vGenerator& vGenerator::AssignWithoutAttributes(const vGenerator& rGen) {
   // core members, ignore attributes
   mpStates->AssignWithoutAttributes(rGen.States());
   mpAlphabet->AssignWithoutAttributes(rGen.Alphabet());
+  ClearTransRelIndices();
   mpTransRel->AssignWithoutAttributes(rGen.TransRel());
 #ifdef FAUDES_DEBUG_CODE
   if(!Valid()) {
@@ -580,6 +607,7 @@ void vGenerator::Clear(void) {
   mpAlphabet->Clear();
   mpStates->Clear();
   mpStateSymbolTable->Clear();
+  ClearTransRelIndices();
   mpTransRel->Clear();
   mInitStates.Clear();
   mMarkedStates.Clear();
@@ -619,6 +647,7 @@ void vGenerator::ClearAttributes(void) {
 // ClearStates()
 void vGenerator::ClearStates(void) {
   mpStates->Clear();
+  ClearTransRelIndices();
   mpTransRel->Clear();
   mInitStates.Clear();
   mMarkedStates.Clear();
@@ -1187,6 +1216,7 @@ void vGenerator::RestrictAlphabet(const EventSet& rNewAlphabet) {
   }
 #endif
   mpAlphabet->RestrictSet(rNewAlphabet);
+  ClearTransRelIndices();
   mpTransRel->RestrictEvents(rNewAlphabet);
 }
 
@@ -1210,6 +1240,7 @@ void vGenerator::InsEvents(const EventSet& events) {
 // DelEvent(index)
 bool vGenerator::DelEvent(Idx index) {
   FD_DG("vGenerator(" << this << ")::DelEvent(" << index << ")");
+  ClearTransRelIndices();
   mpTransRel->EraseByEv(index);
   return mpAlphabet->Erase(index);
 }
@@ -1218,6 +1249,7 @@ bool vGenerator::DelEvent(Idx index) {
 bool vGenerator::DelEvent(const std::string& rName) {
   FD_DG("vGenerator(" << this << ")::DelEvent(\"" << rName << "\")");
   Idx index = mpAlphabet->Index(rName);
+  ClearTransRelIndices();
   mpTransRel->EraseByEv(index);
   return mpAlphabet->Erase(index);
 }
@@ -1350,6 +1382,7 @@ bool vGenerator::DelState(Idx index) {
   // mstates
   mMarkedStates.Erase(index);
   // transrel 
+  ClearTransRelIndices();
   mpTransRel->EraseByX1OrX2(index);
   // symbolic name
   mpStateSymbolTable->ClrEntry(index);
@@ -1388,6 +1421,7 @@ void vGenerator::DelStates(const StateSet& rDelStates) {
   mInitStates.EraseSet(rDelStates);
   mMarkedStates.EraseSet(rDelStates);
   // mpTransRel:
+  ClearTransRelIndices();
   mpTransRel->EraseByX1OrX2(rDelStates);
 }
 
@@ -1420,6 +1454,7 @@ void vGenerator::RestrictStates(const StateSet& rStates) {
   mInitStates.RestrictSet(rStates);
   mMarkedStates.RestrictSet(rStates);
   // mpTransRel:
+  ClearTransRelIndices();
   mpTransRel->RestrictStates(rStates);
 }
 
@@ -1577,12 +1612,14 @@ void vGenerator::ClearMarkedStates(void) {
 // InjectTransition(newtrans)
 void vGenerator::InjectTransition(const Transition& rTrans) {
   FD_DG("vGenerator::InjectTransition(" << TStr(rTrans) << ")");
+  ClearTransRelIndices();
   mpTransRel->Inject(rTrans);
 }
 
 // InjectTransRel(newtransrel)
 void vGenerator::InjectTransRel(const TransSet& rNewTransrel) {
   FD_DG("vGenerator::InjectTransRel(...)");
+  ClearTransRelIndices();
   *mpTransRel=rNewTransrel;
   mpTransRel->Name("TransRel");
 }
@@ -1647,6 +1684,7 @@ bool vGenerator::SetTransition(const Transition& rTransition) {
     throw Exception("vGenerator::SetTransition(..)", errstr.str(), 95);
   }
 #endif
+  ClearTransRelIndices();
   return mpTransRel->Insert(rTransition);
 }
 
@@ -1656,18 +1694,21 @@ bool vGenerator::SetTransition(const Transition& rTransition) {
 void vGenerator::ClrTransition(Idx x1, Idx ev, Idx x2) {
   FD_DG("vGenerator(" << this << ")::ClrTransition(" 
 	<< x1 << "," << ev << "," << x2 << ")");
+  ClearTransRelIndices();
   mpTransRel->Erase(x1, ev, x2);
 }
 
 // ClrTransition(rTransition)
 void vGenerator::ClrTransition(const Transition& rTransition) {
   FD_DG("vGenerator(" << this << ")::ClrTransition(" << TStr(rTransition) << ")");
+  ClearTransRelIndices();
   mpTransRel->Erase(rTransition);
 }
 
 // ClrTransition(it)
 TransSet::Iterator vGenerator::ClrTransition(TransSet::Iterator it) {
   FD_DG("vGenerator(" << this << ")::ClrTransition(" << TStr(*it)<< ")" );
+  ClearTransRelIndices();
   return mpTransRel->Erase(it);
 }
 
@@ -1675,6 +1716,7 @@ TransSet::Iterator vGenerator::ClrTransition(TransSet::Iterator it) {
 void vGenerator::ClrTransitions(Idx x1, Idx ev) {
   FD_DG("vGenerator(" << this << ")::ClrTransition(" 
 	<< x1 << "," << ev << ")");
+  ClearTransRelIndices();
   mpTransRel->EraseByX1Ev(x1, ev);
 }
 
@@ -1682,6 +1724,7 @@ void vGenerator::ClrTransitions(Idx x1, Idx ev) {
 void vGenerator::ClrTransitions(Idx x1) {
   FD_DG("vGenerator(" << this << ")::ClrTransition(" 
 	<< x1  << ")");
+  ClearTransRelIndices();
   mpTransRel->EraseByX1(x1);
 }
 
@@ -1711,6 +1754,7 @@ void vGenerator::ClrTransAttribute(const Transition& rTrans)  {
 
 // ClearTransRel()
 void vGenerator::ClearTransRel(void) {
+  ClearTransRelIndices();
   mpTransRel->Clear();
 }
 
@@ -1894,6 +1938,53 @@ void vGenerator::TransRel(TransSetX2EvX1& res) const { mpTransRel->ReSort(res);
 void vGenerator::TransRel(TransSetX2X1Ev& res) const { mpTransRel->ReSort(res); }
 void vGenerator::TransRel(TransSetX1X2Ev& res) const { mpTransRel->ReSort(res); }
 
+// lock for building/discarding cached transition relations (per generator)
+#ifdef FAUDES_THREADS
+namespace {
+class TransRelCacheLock {
+public:
+  TransRelCacheLock(faudes_mutex_t* pMutex) : mpMutex(pMutex) { faudes_mutex_lock(mpMutex); }
+  ~TransRelCacheLock(void) { faudes_mutex_unlock(mpMutex); }
+private:
+  faudes_mutex_t* mpMutex;
+};
+}
+#define FD_CACHELOCK TransRelCacheLock cachelock(&mCacheMutex)
+#else
+#define FD_CACHELOCK
+#endif
+
+// TransRelX2EvX1() const
+const TransSetX2EvX1& vGenerator::TransRelX2EvX1(void) const {
+  FD_CACHELOCK;
+  if(!mpTransRelX2EvX1) {
+    mpTransRelX2EvX1 = new TransSetX2EvX1();
+    mpTransRel->ReSort(*mpTransRelX2EvX1);
+  }
+  return *mpTransRelX2EvX1;
+}
+
+// TransRelEvX1X2() const
+const TransSetEvX1X2& vGenerator::TransRelEvX1X2(void) const {
+  FD_CACHELOCK;
+  if(!mpTransRelEvX1X2) {
+    mpTransRelEvX1X2 = new TransSetEvX1X2();
+    mpTransRel->ReSort(*mpTransRelEvX1X2);
+  }
+  return *mpTransRelEvX1X2;
+}
+
+// ClearTransRelIndices() const
+void vGenerator::ClearTransRelIndices(void) const {
+  // nothing cached: skip the lock (modifications are exclusive anyway)
+  if(!mpTransRelX2EvX1 && !mpTransRelEvX1X2) return;
+  FD_CACHELOCK;
+  if(mpTransRelX2EvX1) delete mpTransRelX2EvX1;
+  if(mpTransRelEvX1X2) delete mpTransRelEvX1X2;
+  mpTransRelX2EvX1=0;
+  mpTransRelEvX1X2=0;
+}
+
 
 Transition vGenerator::TransitionByNames(
     const std::string& rX1, const std::string& rEv, const std::string& rX2) const {
@@ -1990,15 +2081,16 @@ Idx vGenerator::SuccessorState(Idx x1, Idx ev) const {
 }
 
 
-// AccessibleSet()
-StateSet vGenerator::AccessibleSet(void) const {
+// helper: forward reach by depth-first search, parametrised by the
+// type of the visited-set (StateSet or DenseStateSet)
+template<class VSet>
+static void ForwardReach(const TransSet& rTrans, const StateSet& rStart, VSet& rVisited) {
   // initialize todo stack
   std::stack<Idx> todo;
   StateSet::Iterator sit;
-  for(sit = InitStatesBegin(); sit != InitStatesEnd(); ++sit) 
+  for(sit = rStart.Begin(); sit != rStart.End(); ++sit) 
     todo.push(*sit);
   // loop variables
-  StateSet accessibleset;
   TransSet::Iterator tit;
   TransSet::Iterator tit_end;
   // loop
@@ -2007,16 +2099,63 @@ StateSet vGenerator::AccessibleSet(void) const {
     Idx x1=todo.top();
     todo.pop();
     // sense known
-    if(accessibleset.Exists(x1)) continue; 
+    if(rVisited.Exists(x1)) continue; 
     // record
-    accessibleset.Insert(x1);
+    rVisited.Insert(x1);
     // iterate/push
-    tit=TransRelBegin(x1);
-    tit_end=TransRelEnd(x1);
+    tit=rTrans.Begin(x1);
+    tit_end=rTrans.End(x1);
     for(; tit != tit_end; ++tit) 
-      if(tit->X2 != x1) 
+      if(!rVisited.Exists(tit->X2)) 
         todo.push(tit->X2);
   }
+}
+
+// helper: backward reach by depth-first search, see ForwardReach()
+template<class VSet>
+static void BackwardReach(const TransSetX2EvX1& rRTrans, const StateSet& rStart, VSet& rVisited) {
+  // initialize todo stack
+  std::stack<Idx> todo;
+  StateSet::Iterator sit;
+  for(sit = rStart.Begin(); sit != rStart.End(); ++sit) 
+    todo.push(*sit);
+  // loop variables
+  TransSetX2EvX1::Iterator tit;
+  TransSetX2EvX1::Iterator tit_end;
+  // loop
+  while(!todo.empty()) {
+    // pop
+    Idx x2=todo.top();
+    todo.pop();
+    // sense known
+    if(rVisited.Exists(x2)) continue; 
+    // record
+    rVisited.Insert(x2);
+    // iterate/push
+    tit=rRTrans.BeginByX2(x2);
+    tit_end=rRTrans.EndByX2(x2);
+    for(; tit != tit_end; ++tit) 
+      if(!rVisited.Exists(tit->X1)) 
+        todo.push(tit->X1);
+  }
+}
+
+// AccessibleSet()
+// (use a bit vector to record visited states when state indices are dense)
+StateSet vGenerator::AccessibleSet(void) const {
+  StateSet accessibleset;
+  if(mpStates->Empty()) {
+    accessibleset.Name("AccessibleSet");
+    return accessibleset;
+  }
+  Idx maxidx= *(--mpStates->End());
+  if(DenseStateSet::Suitable(maxidx,mpStates->Size())) {
+    DenseStateSet visited(maxidx);
+    ForwardReach(TransRel(),mInitStates,visited);
+    visited.ToStateSet(accessibleset);
+  } else {
+    ForwardReach(TransRel(),mInitStates,accessibleset);
+  }
   // done
   accessibleset.Name("AccessibleSet");
   return accessibleset;
@@ -2048,33 +2187,21 @@ bool vGenerator::IsAccessible(void) const {
 
 // CoaccessibleSet()
 StateSet vGenerator::CoaccessibleSet(void) const {
-  // build reverse transition relation
-  TransSetX2EvX1 rtrel;
-  TransRel(rtrel);
-  // initialize todo stack
-  StateSet::Iterator sit;
-  std::stack<Idx> todo;
-  for(sit = MarkedStatesBegin(); sit != MarkedStatesEnd(); ++sit) 
-    todo.push(*sit);
-  // loop variables
   StateSet coaccessibleset;
-  TransSetX2EvX1::Iterator tit;
-  TransSetX2EvX1::Iterator tit_end;
-  // loop
-  while(!todo.empty()) {
-    // pop
-    Idx x2=todo.top();
-    todo.pop();
-    // sense known
-    if(coaccessibleset.Exists(x2)) continue; 
-    // record
-    coaccessibleset.Insert(x2);
-    // iterate/push
-    tit=rtrel.BeginByX2(x2);
-    tit_end=rtrel.EndByX2(x2);
-    for(; tit != tit_end; ++tit) 
-      if(tit->X1 != x2) 
-        todo.push(tit->X1);
+  if(mpStates->Empty()) {
+    coaccessibleset.Name("CoaccessibleSet");
+    return coaccessibleset;
+  }
+  // reverse transition relation (cached)
+  const TransSetX2EvX1& rtrel=TransRelX2EvX1();
+  // backward search
+  Idx maxidx= *(--mpStates->End());
+  if(DenseStateSet::Suitable(maxidx,mpStates->Size())) {
+    DenseStateSet visited(maxidx);
+    BackwardReach(rtrel,mMarkedStates,visited);
+    visited.ToStateSet(coaccessibleset);
+  } else {
+    BackwardReach(rtrel,mMarkedStates,coaccessibleset);
   }
   // done
   coaccessibleset.Name("CoaccessibleSet");
@@ -2178,9 +2305,8 @@ bool vGenerator::IsComplete(const EventSet& rSigmaO) const {
     todo.push(tit->X1);
     tit=TransRelEnd(tit->X1);
   }
-  // build reverse transition relation
-  TransSetX2EvX1 rtrel;
-  TransRel(rtrel);
+  // reverse transition relation (cached)
+  const TransSetX2EvX1& rtrel=TransRelX2EvX1();
   // reverse reachability analysis for more good states
   StateSet good;
   while(!todo.empty()) {
@@ -2820,21 +2946,38 @@ std::string vGenerator::TransRelToText(void) const {
   return tw.Str();
 }
 
+// test for void attribute type (compare type names, since type_info objects
+// may not be unique across libraries)
+static bool IsVoidAttribute(const AttributeVoid* pAttr) {
+  return std::string(typeid(*pAttr).name()) == typeid(AttributeVoid).name();
+}
+
 // WriteTransRel(rTw&)
 void vGenerator::WriteTransRel(TokenWriter& rTw) const {
   TransSet::Iterator tit;
   int oldcolumns = rTw.Columns();
   rTw.Columns(3);
   rTw.WriteBegin("TransRel");
-  bool smalltransrel = (Size() < FD_SMALLTRANSREL);
+  bool smalltransrel = (Size() < FD_SMALLTRANSREL) && rTw.SymbolicNames();
+  bool voidattr = IsVoidAttribute(mpTransRel->AttributeType());
+
+  // cache event names and the current x1
+  std::map<Idx,std::string> evnames;
+  std::map<Idx,std::string>::iterator enit;
+  Idx lastx1=0;
+  Idx x1=0;
+  std::string x1name;
 
   // loop all transitions
   for(tit = mpTransRel->Begin(); tit != mpTransRel->End(); ++tit) {
 
     // write x1
-    Idx x1=MinStateIndex(tit->X1);
+    if(tit->X1 != lastx1) {
+      lastx1=tit->X1;
+      x1=MinStateIndex(tit->X1);
+      if(smalltransrel) x1name = StateName(tit->X1);
+    }
     if (smalltransrel) {
-      std::string x1name = StateName(tit->X1);
       if (x1name != "") {
 	rTw << x1name;
       } else {
@@ -2845,7 +2988,10 @@ void vGenerator::WriteTransRel(TokenWriter& rTw) const {
     }
 
     // write ev
-    rTw << EventName(tit->Ev);
+    enit=evnames.find(tit->Ev);
+    if(enit==evnames.end()) 
+      enit=evnames.insert(std::make_pair(tit->Ev,EventName(tit->Ev))).first;
+    rTw << enit->second;
 
     // write x2
     Idx x2=MinStateIndex(tit->X2);
@@ -2861,7 +3007,7 @@ void vGenerator::WriteTransRel(TokenWriter& rTw) const {
     }
 
     // write attributes
-    TransAttribute(*tit).Write(rTw);
+    if(!voidattr) TransAttribute(*tit).Write(rTw);
 
   }
   rTw.WriteEnd("TransRel");
@@ -3587,6 +3733,272 @@ void vGenerator::XReadStateSet(TokenReader& rTr, StateSet& rStateSet, const std:
 
 
 
+// number of threads for parallel parsing
+static std::atomic<unsigned int> gGeneratorReadThreads(0);
+
+// set number of threads
+void GeneratorReadThreads(unsigned int count) {
+  gGeneratorReadThreads=count;
+}
+
+// get number of threads
+unsigned int GeneratorReadThreads(void) {
+  return gGeneratorReadThreads;
+}
+
+// parallel parsing: token resolved by a worker
+struct TransRelToken {
+  Idx mState;         // state index as read or looked up
+  Idx mEvent;         // event index, 0 if not an event
+  bool mValid;        // true for integer or string tokens, excl. options
+  bool mKnown;        // true if mState is an existing state
+  std::string mName;  // symbolic name of an unknown state
+  int mLine;          // line within the collected section text
+};
+
+// parallel parsing: one chunk of the section body
+struct TransRelChunk {
+  const vGenerator* pGen;
+  const std::string* pText;
+  std::size_t mBegin;
+  std::size_t mEnd;
+  int mLine;
+  std::vector<TransRelToken> mTokens;
+  std::string mError;
+  int mErrorLine;
+};
+
+// parallel parsing: map line in the collected section text to the line in the file
+// (rLines holds pairs of text line and file line for each piece of character data)
+static std::string TransRelFileLine(const TokenReader& rTr, 
+  const std::vector< std::pair<int,int> >& rLines, int line)
+{
+  std::vector< std::pair<int,int> >::const_iterator lit=
+    std::upper_bound(rLines.begin(),rLines.end(),std::make_pair(line,std::numeric_limits<int>::max()));
+  if(lit!=rLines.begin()) {
+    --lit;
+    line= lit->second + (line - lit->first);
+  }
+  if(rTr.FileName()!="") 
+    return "("+ rTr.FileName() + ":" + ToStringInteger(line) +")";
+  return "(#" + ToStringInteger(line) +")";
+}
+
+// parallel parsing: tokenize and resolve one chunk
+static void* TransRelChunkWorker(void* arg) {
+  TransRelChunk* chunk = static_cast<TransRelChunk*>(arg);
+  const vGenerator* gen = chunk->pGen;
+  try {
+    TokenReader tr(TokenReader::String,chunk->pText->substr(chunk->mBegin,chunk->mEnd-chunk->mBegin));
+    Token token;
+    chunk->mErrorLine=chunk->mLine;
+    while(tr.Get(token)) {
+      TransRelToken rtok;
+      rtok.mLine=chunk->mLine + tr.Line() - 1;
+      chunk->mErrorLine=rtok.mLine;
+      rtok.mState=0;
+      rtok.mEvent=0;
+      rtok.mValid= (token.IsInteger() || token.IsString()) && !token.IsOption();
+      if(token.IsInteger()) {
+        rtok.mState=token.IntegerValue();
+      } else if(token.IsString()) {
+        rtok.mState=gen->StateIndex(token.StringValue());
+      }
+      rtok.mKnown= rtok.mState!=0 && gen->ExistsState(rtok.mState);
+      if(!rtok.mKnown && !token.IsInteger() && token.IsString()) 
+        rtok.mName=token.StringValue();
+      if(token.IsString()) {
+        rtok.mEvent=gen->EventIndex(token.StringValue());
+        if(rtok.mEvent!=0 && !gen->ExistsEvent(rtok.mEvent)) rtok.mEvent=0;
+      }
+      chunk->mTokens.push_back(rtok);
+    }
+  } catch (faudes::Exception& exception) {
+    chunk->mError=exception.What();
+  }
+  return 0;
+}
+
+// parallel parsing: sort one range of transitions
+struct TransRelSortTask {
+  std::vector<Transition>::iterator mBegin;
+  std::vector<Transition>::iterator mEnd;
+};
+
+// parallel parsing: sort worker
+static void* TransRelSortWorker(void* arg) {
+  TransRelSortTask* task = static_cast<TransRelSortTask*>(arg);
+  std::sort(task->mBegin,task->mEnd);
+  return 0;
+}
+
+// run tasks by worker threads, the calling thread runs the first task
+template<class Task>
+static void TransRelRunTasks(std::vector<Task>& rTasks, void* (*fnct)(void*)) {
+#ifdef FAUDES_THREADS
+  std::size_t tcount=rTasks.size();
+  std::vector<faudes_thread_t> threads(tcount);
+  std::vector<bool> running(tcount,false);
+  for(std::size_t t=1;t<tcount;t++)
+    running[t] = (faudes_thread_create(&threads[t],fnct,&rTasks[t]) == FAUDES_THREAD_SUCCESS);
+  if(tcount>0) fnct(&rTasks[0]);
+  for(std::size_t t=1;t<tcount;t++) {
+    if(running[t]) faudes_thread_join(threads[t],0);
+    else fnct(&rTasks[t]);
+  }
+#else
+  for(std::size_t t=0;t<rTasks.size();t++)
+    fnct(&rTasks[t]);
+#endif
+}
+
+// ReadTransRelParallel(tr) 
+void vGenerator::ReadTransRelParallel(TokenReader& rTr, bool isx, bool isn) {
+  FD_DG("vGenerator(" << this << ")::ReadTransRelParallel(\"" << rTr.FileName() << "\")");
+  // collect the section body, skip attributes from other file formats
+  std::string text;
+  std::string cdata;
+  std::vector< std::pair<int,int> > lines;
+  int tline=1;
+  Token token;
+  while(true) {
+    lines.push_back(std::make_pair(tline,rTr.Line()));
+    rTr.ReadCharacterData(cdata);
+    text.append(cdata);
+    text.append(1,'\n');
+    tline+= (int) std::count(cdata.begin(),cdata.end(),'\n') + 1;
+    if(!rTr.Peek(token)) break;
+    if(token.IsEnd()) break;
+    if(token.IsBegin("Consecutive")) {
+      std::stringstream errstr;
+      errstr << "unexpected section " << token.StringValue() << " " << rTr.FileLine();
+      throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 50);
+    }
+    AttributeVoid::Skip(rTr);
+    // take back an integer or string token from the peek buffer
+    if(!rTr.Peek(token)) break;
+    if(token.IsInteger() || token.IsString()) {
+      lines.push_back(std::make_pair(tline,rTr.Line()));
+      rTr.Get(token);
+      TokenWriter tw(TokenWriter::String);
+      tw.Write(token);
+      std::string tstr=tw.Str();
+      tstr.erase(std::remove(tstr.begin(),tstr.end(),'\n'),tstr.end());
+      text.append(tstr);
+      text.append(1,'\n');
+      ++tline;
+    }
+  }
+  // number of chunks, avoid tiny chunks
+  std::size_t tcount = GeneratorReadThreads();
+  if(tcount<1) tcount=1;
+  if(tcount> text.size()/65536+1) tcount= text.size()/65536+1;
+  // split at line boundaries
+  std::vector<TransRelChunk> chunks(tcount);
+  std::size_t pos=0;
+  tline=1;
+  for(std::size_t t=0;t<tcount;t++) {
+    chunks[t].pGen=this;
+    chunks[t].pText=&text;
+    chunks[t].mBegin=pos;
+    chunks[t].mLine=tline;
+    pos= (text.size()*(t+1))/tcount;
+    if(pos<chunks[t].mBegin) pos=chunks[t].mBegin;
+    if(t+1<tcount) {
+      pos=text.find('\n',pos);
+      if(pos==std::string::npos) pos=text.size();
+      else pos++;
+    }
+    chunks[t].mEnd=pos;
+    tline+= (int) std::count(text.begin()+chunks[t].mBegin,text.begin()+pos,'\n');
+  }
+  // tokenize and resolve
+  TransRelRunTasks(chunks,TransRelChunkWorker);
+  // assemble triples
+  std::vector<Transition> trans;
+  Transition ftrans;
+  int cnt=0;
+  for(std::size_t t=0;t<tcount;t++) {
+    if(chunks[t].mError!="") {
+      std::stringstream errstr;
+      errstr << chunks[t].mError << " " << TransRelFileLine(rTr,lines,chunks[t].mErrorLine);
+      throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 50);
+    }
+    std::vector<TransRelToken>::const_iterator tit=chunks[t].mTokens.begin();
+    for(;tit!=chunks[t].mTokens.end();++tit) {
+      // skip other tokens between transitions
+      if(!tit->mValid && cnt==0) continue;
+      // the event
+      if(cnt==1) {
+        ftrans.Ev=tit->mEvent;
+        if(ftrans.Ev==0) {
+          std::stringstream errstr;
+          errstr << "invalid event in transition #" << trans.size()+1 << " " 
+                 << TransRelFileLine(rTr,lines,tit->mLine);
+          throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 85);
+        }
+      }
+      // a state: insert new states as in ReadTransRel()
+      if(cnt!=1) {
+        if(tit->mState==0 && tit->mName=="") {
+          std::stringstream errstr;
+          errstr << "invalid state " << (cnt==0 ? "x1" : "x2") << " in transition #" << trans.size()+1 << " " 
+                 << TransRelFileLine(rTr,lines,tit->mLine);
+          throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 85);
+        }
+        Idx x=tit->mState;
+        if(!tit->mKnown) {
+          if(tit->mName=="") {
+            if((!ExistsState(x)) && isx) { InsState(x); isn=false; };
+          } else {
+            x=StateIndex(tit->mName);
+            if(x==0 && isn) { x=InsState(tit->mName); isx=false; };
+          }
+          if(!ExistsState(x)) {
+            std::stringstream errstr;
+            errstr << "invalid state " << (cnt==0 ? "x1 " : "x2 ") << tit->mName 
+                   << " in transition #" << trans.size()+1 << " " << TransRelFileLine(rTr,lines,tit->mLine);
+            throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 85);
+          }
+        }
+        if(cnt==0) ftrans.X1=x;
+        else ftrans.X2=x;
+      }
+      if(++cnt<3) continue;
+      trans.push_back(ftrans);
+      cnt=0;
+    }
+    // release memory early
+    std::vector<TransRelToken>().swap(chunks[t].mTokens);
+  }
+  if(cnt!=0) {
+    std::stringstream errstr;
+    errstr << "incomplete transition " << rTr.FileLine();
+    throw Exception("vGenerator::ReadTransRelParallel", errstr.str(), 50);
+  }
+  // sort ranges in parallel and merge
+  if(tcount> trans.size()/4096+1) tcount= trans.size()/4096+1;
+  std::vector<TransRelSortTask> tasks(tcount);
+  for(std::size_t t=0;t<tcount;t++) {
+    tasks[t].mBegin=trans.begin() + (trans.size()*t)/tcount;
+    tasks[t].mEnd=trans.begin() + (trans.size()*(t+1))/tcount;
+  }
+  TransRelRunTasks(tasks,TransRelSortWorker);
+  for(std::size_t t=1;t<tcount;t++)
+    std::inplace_merge(trans.begin(),tasks[t].mBegin,tasks[t].mEnd);
+  trans.erase(std::unique(trans.begin(),trans.end()),trans.end());
+  // inject in order
+  ClearTransRelIndices();
+  bool inject=mpTransRel->Empty();
+  std::vector<Transition>::const_iterator vit=trans.begin();
+  for(;vit!=trans.end();++vit) {
+    if(inject) mpTransRel->Inject(mpTransRel->End(),*vit);
+    else mpTransRel->Insert(*vit);
+  }
+  FD_DG("vGenerator(" << this << ")::ReadTransRelParallel(..): done, #" << trans.size());
+}
+
+
 // ReadTransRel(tr) 
 void vGenerator::ReadTransRel(TokenReader& rTr) {
   FD_DG("vGenerator(" << this << ")::ReadTransRel(\"" << rTr.FileName() << "\")");
@@ -3613,6 +4025,12 @@ void vGenerator::ReadTransRel(TokenReader& rTr) {
 
   // read section
   try {
+
+  // parallel variant for plain transition relations over known events
+  if(GeneratorReadThreads()>0 && !ien && IsVoidAttribute(attrp)) 
+    ReadTransRelParallel(rTr,isx,isn);
+
+  // token by token
   while(!rTr.Eos(label)) {
 
     // local vars
@@ -3706,6 +4124,7 @@ void vGenerator::XReadTransRel(TokenReader& rTr) {
   AttributeVoid* attrp = mpTransRel->AttributeType()->New();
   FD_DG("vGenerator(" << this << ")::ReadTransRel(..): attribute type " << typeid(*attrp).name());
   // Clear my set
+  ClearTransRelIndices();
   mpTransRel->Clear();
   mpTransRel->Name("TransRel");
   // Read begin
@@ -40,6 +40,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 #include <sstream>
 #include <cstdlib>
 #include <cassert>
+#ifdef FAUDES_THREADS
+#include <atomic>
+#endif
 
 namespace faudes {
 
@@ -205,6 +208,13 @@ namespace faudes {
  * specialised algorithms that refer to extended generator semantics, we recommend derived 
  * generator classes as argument type.
  *
+ * @subsection GeneratorCopy Copies
+ *
+ * Generators are cheap to copy: the alphabet, the state set, the transition relation and the
+ * state symbol table share their data with the original and are only detached when either
+ * generator is modified. To pass on a result that is no longer needed, e.g. from a temporary
+ * to the actual result parameter of a function, use the destructive copy Move().
+ *
  *
  * @ingroup GeneratorClasses
  */
@@ -1261,6 +1271,42 @@ class FAUDES_API vGenerator : public ExtType  {
   void TransRel(TransSetX2X1Ev& res) const;
   void TransRel(TransSetX1X2Ev& res) const;
 
+  /**
+   * Return reference to transition relation sorted by "x2,ev,x1".
+   *
+   * The re-sorted copy is built on the first request and cached for
+   * subsequent requests. Any modification of the transition relation 
+   * invalidates the cache, including the returned reference.
+   * Use this variant instead of TransRel(TransSetX2EvX1&) when the
+   * reverse relation is needed repeatedly for the same generator.
+   * As with any other access, concurrent calls on the same generator
+   * need external synchronisation.
+   *
+   * @return 
+   *   Transition relation sorted by "x2,ev,x1"
+   */
+  const TransSetX2EvX1& TransRelX2EvX1(void) const;
+
+  /**
+   * Return reference to transition relation sorted by "ev,x1,x2".
+   *
+   * See also TransRelX2EvX1().
+   *
+   * @return 
+   *   Transition relation sorted by "ev,x1,x2"
+   */
+  const TransSetEvX1X2& TransRelEvX1X2(void) const;
+
+  /**
+   * Discard cached re-sorted copies of the transition relation.
+   *
+   * This is done automatically on any modification of the transition 
+   * relation; an explicit call only serves to free memory. Though declared
+   * const, this counts as a modification w.r.t. concurrent access, since it
+   * invalidates references obtained from TransRelX2EvX1() and TransRelEvX1X2().
+   */
+  void ClearTransRelIndices(void) const;
+
   /**
    * Convebience function.
    * 
@@ -2893,7 +2939,11 @@ class FAUDES_API vGenerator : public ExtType  {
   Idx mId;
 
   /** Number of generator objects */
+#ifdef FAUDES_THREADS
+  static std::atomic<Idx> msObjectCount;
+#else
   static Idx msObjectCount;
+#endif
 
   /** State symbol table (local per Generator)*/
   SymbolTable mStateSymbolTable;
@@ -2925,6 +2975,17 @@ class FAUDES_API vGenerator : public ExtType  {
   /** Pointer to ransition relation (actual type depends on attributes) */
   TransSet* mpTransRel;
 
+  /** Cached copy of transition relation sorted by "x2,ev,x1" (or 0) */
+  mutable TransSetX2EvX1* mpTransRelX2EvX1;
+
+  /** Cached copy of transition relation sorted by "ev,x1,x2" (or 0) */
+  mutable TransSetEvX1X2* mpTransRelEvX1X2;
+
+#ifdef FAUDES_THREADS
+  /** Lock for building/discarding the cached transition relations */
+  mutable faudes_mutex_t mCacheMutex;
+#endif
+
   /** Pointer to lobal attribute (actual type depends on attributes) */
   AttributeVoid* mpGlobalAttribute;
 
@@ -3154,6 +3215,31 @@ class FAUDES_API vGenerator : public ExtType  {
    */
   void ReadTransRel(TokenReader& rTr);
 
+  /**
+   * Read the generator's transition relation by worker threads.
+   *
+   * Variant of ReadTransRel(TokenReader&) for plain transition relations over
+   * known events. The section body is read as character data and split at
+   * line boundaries into chunks, which are tokenized and resolved by
+   * GeneratorReadThreads() threads. The collected transitions are sorted in parallel
+   * and injected into the transition relation. Unknown states are inserted in order of
+   * occurrence, attributes from other file formats are skipped. Must be called after the
+   * begin tag has been read and leaves the end tag in the reader.
+   *
+   * @param rTr
+   *   Reference to TokenReader
+   * @param isx
+   *   Insert unknown states given by index
+   * @param isn
+   *   Insert unknown states given by name
+   *
+   * @exception Exception
+   *   - IO errors (id 1)
+   *   - token mismatch (id 50)
+   *   - invalid state or event (id 85)
+   */
+  void ReadTransRelParallel(TokenReader& rTr, bool isx, bool isn);
+
   /**
    * Read the generator's transition relation from a TokenReader. 
    *
@@ -3200,6 +3286,32 @@ typedef vGenerator Generator;
 typedef  TBaseVector<Generator> GeneratorVector;  
 
 
+/** 
+ * Set the number of threads used to parse the transition relation when reading
+ * generators from file in native token format. The default 0 selects sequential
+ * parsing. Parallel parsing applies to generators without transition attributes whose
+ * alphabet is given before the transition relation (requires FAUDES_THREADS,
+ * otherwise chunks are parsed sequentially). See also vGenerator::ReadTransRelParallel().
+ * The setting is global; it is stored atomically and may be changed while other threads read.
+ *
+ * @param count
+ *   number of threads, or 0 for sequential parsing
+ *
+ * \ingroup GeneratorClasses
+ */
+extern FAUDES_API void GeneratorReadThreads(unsigned int count);
+
+/** 
+ * Get the number of threads used to parse the transition relation.
+ *
+ * @return
+ *   number of threads, or 0 for sequential parsing
+ *
+ * \ingroup GeneratorClasses
+ */
+extern FAUDES_API unsigned int GeneratorReadThreads(void);
+
+
 /** 
  * RTI wrapper function. See also vGenerator::IsAccessible().
  * \ingroup GeneratorFunctions
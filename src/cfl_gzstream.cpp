@@ -0,0 +1,282 @@
+/** @file cfl_gzstream.cpp @brief Stream buffers for gzip compressed files */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_gzstream.h"
+#include "cfl_exception.h"
+#include <cstring>
+
+#ifdef FAUDES_ZLIB
+#include <zlib.h>
+#endif
+
+namespace faudes {
+
+// buffer sizes
+static const std::size_t GzInBufferSize = 1 << 16;
+static const std::size_t GzOutBufferSize = 1 << 15;
+
+// report configuration
+bool GzSupported(void) {
+#ifdef FAUDES_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+/*
+********************************************************************
+********************************************************************
+
+GzOutBuffer
+
+********************************************************************
+********************************************************************
+*/
+
+// construct
+GzOutBuffer::GzOutBuffer(std::streambuf* pSink) :
+  pSink(pSink), mBuffer(GzOutBufferSize), mpZState(0), mFinished(false)
+{
+  setp(&mBuffer[0],&mBuffer[0]+mBuffer.size());
+#ifndef FAUDES_ZLIB
+  throw Exception("GzOutBuffer::GzOutBuffer", 
+    "gzip compressed files require zlib (configure option core_zlib)", 2);
+#else
+  z_stream* zs = new z_stream;
+  std::memset(zs,0,sizeof(z_stream));
+  // windowBits+16: have zlib write the gzip header and trailer
+  if(deflateInit2(zs,Z_BEST_SPEED,Z_DEFLATED,MAX_WBITS+16,8,Z_DEFAULT_STRATEGY)!=Z_OK) {
+    delete zs;
+    throw Exception("GzOutBuffer::GzOutBuffer", "cannot initialise zlib", 2);
+  }
+  mpZState=zs;
+  mOut.resize(GzOutBufferSize);
+#endif
+}
+
+// destruct
+GzOutBuffer::~GzOutBuffer(void) {
+#ifdef FAUDES_ZLIB
+  z_stream* zs = static_cast<z_stream*>(mpZState);
+  deflateEnd(zs);
+  delete zs;
+#endif
+}
+
+// write to sink
+void GzOutBuffer::Put(const char* pData, std::size_t len) {
+  if(len==0) return;
+  if(pSink->sputn(pData,len) != (std::streamsize) len)
+    throw Exception("GzOutBuffer::Put", "error writing gzip stream", 2);
+}
+
+// encode pending data: mode 0 plain, 1 flush, 2 finish
+void GzOutBuffer::Encode(int mode) {
+  std::size_t len = pptr()-pbase();
+#ifdef FAUDES_ZLIB
+  z_stream* zs = static_cast<z_stream*>(mpZState);
+  int flush = Z_NO_FLUSH;
+  if(mode==1) flush = Z_SYNC_FLUSH;
+  if(mode==2) flush = Z_FINISH;
+  if(len>0 || mode==2) {
+    zs->next_in = reinterpret_cast<Bytef*>(pbase());
+    zs->avail_in = (uInt) len;
+    do {
+      zs->next_out = reinterpret_cast<Bytef*>(&mOut[0]);
+      zs->avail_out = (uInt) mOut.size();
+      int ret = deflate(zs,flush);
+      if(ret==Z_STREAM_ERROR)
+        throw Exception("GzOutBuffer::Encode", "zlib error", 2);
+      Put(&mOut[0],mOut.size()-zs->avail_out);
+    } while(zs->avail_out==0);
+  }
+#endif
+  setp(&mBuffer[0],&mBuffer[0]+mBuffer.size());
+}
+
+// streambuf interface: buffer full
+GzOutBuffer::int_type GzOutBuffer::overflow(int_type c) {
+  if(mFinished) return traits_type::eof();
+  Encode(0);
+  if(!traits_type::eq_int_type(c,traits_type::eof())) {
+    *pptr()=traits_type::to_char_type(c);
+    pbump(1);
+  }
+  return traits_type::not_eof(c);
+}
+
+// streambuf interface: flush
+int GzOutBuffer::sync(void) {
+  if(mFinished) return 0;
+  if(pptr()==pbase()) return pSink->pubsync();
+  Encode(1);
+  return pSink->pubsync();
+}
+
+// finish gzip stream
+void GzOutBuffer::Finish(void) {
+  if(mFinished) return;
+  Encode(2);
+  mFinished=true;
+  pSink->pubsync();
+}
+
+
+/*
+********************************************************************
+********************************************************************
+
+GzInBuffer
+
+********************************************************************
+********************************************************************
+*/
+
+// construct
+GzInBuffer::GzInBuffer(std::streambuf* pSource) :
+  pSource(pSource), mBuffer(GzInBufferSize), mWinPos(0), mIn(GzInBufferSize), mpZState(0), mDone(false)
+{
+#ifndef FAUDES_ZLIB
+  throw Exception("GzInBuffer::GzInBuffer", 
+    "gzip compressed files require zlib (configure option core_zlib)", 1);
+#endif
+  Restart();
+}
+
+// destruct
+GzInBuffer::~GzInBuffer(void) {
+#ifdef FAUDES_ZLIB
+  z_stream* zs = static_cast<z_stream*>(mpZState);
+  if(zs) inflateEnd(zs);
+  delete zs;
+#endif
+}
+
+// test for gzip file
+bool GzInBuffer::IsGzip(std::streambuf* pSource) {
+  char magic[2];
+  std::streamsize len=pSource->sgetn(magic,2);
+  pSource->pubseekpos(0,std::ios_base::in);
+  return len==2 && magic[0]=='\x1f' && magic[1]=='\x8b';
+}
+
+// restart from the beginning
+void GzInBuffer::Restart(void) {
+  pSource->pubseekpos(0,std::ios_base::in);
+  mWinPos=0;
+  setg(&mBuffer[0],&mBuffer[0],&mBuffer[0]);
+  mDone=false;
+#ifdef FAUDES_ZLIB
+  z_stream* zs = static_cast<z_stream*>(mpZState);
+  if(zs) inflateEnd(zs);
+  else zs = new z_stream;
+  std::memset(zs,0,sizeof(z_stream));
+  mpZState=zs;
+  // windowBits+16: have zlib parse the gzip header and trailer
+  if(inflateInit2(zs,MAX_WBITS+16)!=Z_OK)
+    throw Exception("GzInBuffer::Restart", "cannot initialise zlib", 1);
+#endif
+}
+
+// decode next window
+bool GzInBuffer::Fill(void) {
+  mWinPos += egptr()-eback();
+  std::size_t fill=0;
+#ifdef FAUDES_ZLIB
+  z_stream* zs = static_cast<z_stream*>(mpZState);
+  zs->next_out = reinterpret_cast<Bytef*>(&mBuffer[0]);
+  zs->avail_out = (uInt) mBuffer.size();
+  while(zs->avail_out>0 && !mDone) {
+    if(zs->avail_in==0) {
+      std::streamsize len=pSource->sgetn(&mIn[0],mIn.size());
+      if(len<=0) throw Exception("GzInBuffer::Fill", "unexpected end of gzip stream", 1);
+      zs->next_in = reinterpret_cast<Bytef*>(&mIn[0]);
+      zs->avail_in = (uInt) len;
+    }
+    int ret=inflate(zs,Z_NO_FLUSH);
+    if(ret==Z_STREAM_END) { mDone=true; break; }
+    if(ret!=Z_OK) throw Exception("GzInBuffer::Fill", "invalid gzip stream", 1);
+  }
+  fill = mBuffer.size()-zs->avail_out;
+#endif
+  setg(&mBuffer[0],&mBuffer[0],&mBuffer[0]+fill);
+  return fill>0;
+}
+
+// streambuf interface: buffer empty
+GzInBuffer::int_type GzInBuffer::underflow(void) {
+  if(gptr()<egptr()) return traits_type::to_int_type(*gptr());
+  if(!Fill()) return traits_type::eof();
+  return traits_type::to_int_type(*gptr());
+}
+
+// streambuf interface: tell or seek
+GzInBuffer::pos_type GzInBuffer::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+  if(!(which & std::ios_base::in)) return pos_type(off_type(-1));
+  std::streamoff cur = mWinPos + (gptr()-eback());
+  if(dir==std::ios_base::cur) {
+    if(off==0) return pos_type(cur);
+    return seekpos(pos_type(cur+off),which);
+  }
+  if(dir==std::ios_base::beg) return seekpos(pos_type(off),which);
+  return pos_type(off_type(-1));
+}
+
+// streambuf interface: seek
+GzInBuffer::pos_type GzInBuffer::seekpos(pos_type pos, std::ios_base::openmode which) {
+  if(!(which & std::ios_base::in)) return pos_type(off_type(-1));
+  std::streamoff target = pos;
+  if(target<0) return pos_type(off_type(-1));
+  if(target<mWinPos) Restart();
+  while(target > mWinPos + (egptr()-eback()))
+    if(!Fill()) return pos_type(off_type(-1));
+  setg(eback(),eback()+(target-mWinPos),egptr());
+  return pos;
+}
+
+
+/*
+********************************************************************
+********************************************************************
+
+GzOStream
+
+********************************************************************
+********************************************************************
+*/
+
+// destruct
+GzOStream::~GzOStream(void) {
+  try {
+    mBuffer.Finish();
+  } catch(...) {}
+}
+
+// finish
+void GzOStream::Finish(void) {
+  mBuffer.Finish();
+}
+
+
+} // namespace faudes
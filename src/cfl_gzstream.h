@@ -0,0 +1,210 @@
+/** @file cfl_gzstream.h @brief Stream buffers for gzip compressed files */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_GZSTREAM_H
+#define FAUDES_GZSTREAM_H
+
+#include "cfl_definitions.h"
+#include "cfl_platform.h"
+#include <vector>
+#include <streambuf>
+#include <istream>
+#include <ostream>
+
+namespace faudes {
+
+/**
+ * Test whether gzip compressed files are supported, i.e., whether libFAUDES 
+ * has been configured with the option core_zlib (FAUDES_ZLIB).
+ *
+ * @ingroup TokenIO
+ */
+extern FAUDES_API bool GzSupported(void);
+
+/**
+ * Output stream buffer for gzip compressed data.
+ *
+ * The buffer collects characters and passes them gzip encoded to a sink stream
+ * buffer, typically the filebuf of an std::ofstream. Compression is by zlib and
+ * requires libFAUDES to be configured with the option core_zlib (FAUDES_ZLIB).
+ * Finish() must be called to write the gzip trailer; this is done by the GzOStream 
+ * destructor.
+ *
+ * @ingroup TokenIO
+ */
+class FAUDES_API GzOutBuffer : public std::streambuf {
+public:
+  /** 
+   * Construct on sink 
+   *
+   * @exception Exception
+   *   - not configured with zlib (id 2)
+   */
+  explicit GzOutBuffer(std::streambuf* pSink);
+
+  /** Destruct (does not finish the gzip stream) */
+  virtual ~GzOutBuffer(void);
+
+  /**
+   * Write pending data and the gzip trailer.
+   *
+   * @exception Exception
+   *   - error writing to sink (id 2)
+   */
+  void Finish(void);
+
+protected:
+  /** Encode pending characters and c */
+  virtual int_type overflow(int_type c);
+
+  /** Encode pending characters and flush */
+  virtual int sync(void);
+
+  /** Encode pending characters, optionally flush or finish the deflate stream */
+  void Encode(int mode);
+
+  /** Write to sink */
+  void Put(const char* pData, std::size_t len);
+
+  /** Sink */
+  std::streambuf* pSink;
+
+  /** Uncompressed input */
+  std::vector<char> mBuffer;
+
+  /** Compressed output */
+  std::vector<char> mOut;
+
+  /** zlib state (opaque) */
+  void* mpZState;
+
+  /** Trailer written */
+  bool mFinished;
+};
+
+
+/**
+ * Input stream buffer for gzip compressed data.
+ *
+ * The buffer decodes gzip encoded data from a source stream buffer, typically the
+ * filebuf of an std::ifstream. Decompression is by zlib and requires libFAUDES to be
+ * configured with the option core_zlib (FAUDES_ZLIB). Seeking is supported by position
+ * in the decoded data; positions before the current window restart decoding from
+ * the beginning of the file.
+ *
+ * @ingroup TokenIO
+ */
+class FAUDES_API GzInBuffer : public std::streambuf {
+public:
+  /** 
+   * Construct on source 
+   *
+   * @exception Exception
+   *   - not configured with zlib (id 1)
+   */
+  explicit GzInBuffer(std::streambuf* pSource);
+
+  /** Destruct */
+  virtual ~GzInBuffer(void);
+
+  /** Test source for the gzip magic bytes (and rewind source) */
+  static bool IsGzip(std::streambuf* pSource);
+
+protected:
+  /** Decode next window */
+  virtual int_type underflow(void);
+
+  /** Tell position (or seek relative to the beginning) */
+  virtual pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+    std::ios_base::openmode which = std::ios_base::in | std::ios_base::out);
+
+  /** Seek position */
+  virtual pos_type seekpos(pos_type pos,
+    std::ios_base::openmode which = std::ios_base::in | std::ios_base::out);
+
+  /** Restart decoding from the beginning of the source */
+  void Restart(void);
+
+  /** Decode next window, return false at end of data */
+  bool Fill(void);
+
+  /** Source */
+  std::streambuf* pSource;
+
+  /** Decoded window */
+  std::vector<char> mBuffer;
+
+  /** Position of window in decoded data */
+  std::streamoff mWinPos;
+
+  /** Compressed input */
+  std::vector<char> mIn;
+
+  /** zlib state (opaque) */
+  void* mpZState;
+
+  /** End of data */
+  bool mDone;
+};
+
+
+/**
+ * Output stream writing gzip compressed data to a stream buffer.
+ *
+ * @ingroup TokenIO
+ */
+class FAUDES_API GzOStream : public std::ostream {
+public:
+  /** Construct on sink */
+  explicit GzOStream(std::streambuf* pSink) : std::ostream(0), mBuffer(pSink) { rdbuf(&mBuffer); };
+
+  /** Destruct, finishes the gzip stream (errors are ignored) */
+  virtual ~GzOStream(void);
+
+  /** Finish the gzip stream, see GzOutBuffer::Finish() */
+  void Finish(void);
+
+protected:
+  /** Stream buffer */
+  GzOutBuffer mBuffer;
+};
+
+
+/**
+ * Input stream reading gzip compressed data from a stream buffer.
+ *
+ * @ingroup TokenIO
+ */
+class FAUDES_API GzIStream : public std::istream {
+public:
+  /** Construct on source */
+  explicit GzIStream(std::streambuf* pSource) : std::istream(0), mBuffer(pSource) { rdbuf(&mBuffer); };
+
+protected:
+  /** Stream buffer */
+  GzInBuffer mBuffer;
+};
+
+
+} // namespace faudes
+
+#endif
@@ -0,0 +1,449 @@
+/** @file cfl_isomorphism.cpp @brief Structural fingerprint and isomorphism test for generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_isomorphism.h"
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+namespace faudes {
+
+// hex representation
+std::string StructuralFingerprint::Str(void) const {
+  std::ostringstream str;
+  str << std::hex << std::setfill('0') << std::setw(16) << mHigh << std::setw(16) << mLow;
+  return str.str();
+}
+
+
+/*
+************************************************************************
+************************************************************************
+
+Internal: generator as graph over state positions
+
+************************************************************************
+************************************************************************
+*/
+
+namespace {
+
+// mix 64 bits, two variants (splitmix64 and murmur3 finaliser)
+inline uint64_t IsoMixA(uint64_t x) {
+  x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+inline uint64_t IsoMixB(uint64_t x) {
+  x ^= x >> 33; x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33; x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+// combine ordered
+inline uint64_t IsoCombine(uint64_t h, uint64_t v) {
+  return IsoMixA(h ^ (v + 0x9e3779b97f4a7c15ULL + (h<<6) + (h>>2)));
+}
+
+// hash string (fnv-1a)
+uint64_t IsoString(const std::string& rStr) {
+  uint64_t h=0xcbf29ce484222325ULL;
+  for(std::size_t i=0; i<rStr.size(); ++i) {
+    h ^= (unsigned char) rStr[i];
+    h *= 0x100000001b3ULL;
+  }
+  return IsoMixA(h);
+}
+
+// edge: event (by name id) and state position
+struct IsoEdge {
+  Idx mEv;
+  Idx mState;
+  bool operator<(const IsoEdge& rOther) const
+    { return mEv<rOther.mEv || (mEv==rOther.mEv && mState<rOther.mState); };
+};
+
+// graph representation
+struct IsoGraph {
+  // state indices by position (ascending)
+  std::vector<Idx> mStates;
+  // flags by position: 1 init, 2 marked
+  std::vector<Idx> mFlags;
+  // outgoing and incoming edges by position, sorted
+  std::vector< std::vector<IsoEdge> > mOut;
+  std::vector< std::vector<IsoEdge> > mIn;
+  // event hashes by event id
+  std::vector<uint64_t> mEvHash;
+  // sorted event ids of the alphabet
+  std::vector<Idx> mAlphabet;
+  // number of transitions
+  Idx mTransCount;
+};
+
+// position of state
+inline Idx IsoPos(const std::vector<Idx>& rStates, Idx idx) {
+  return (Idx) (std::lower_bound(rStates.begin(),rStates.end(),idx) - rStates.begin());
+}
+
+// set up graph, events are identified by name via the name table
+void IsoBuild(const vGenerator& rGen, std::map<std::string,Idx>& rNames, IsoGraph& rGraph) {
+  // states
+  rGraph.mStates.clear();
+  rGraph.mStates.reserve(rGen.States().Size());
+  StateSet::Iterator sit;
+  for(sit=rGen.StatesBegin(); sit!=rGen.StatesEnd(); ++sit)
+    rGraph.mStates.push_back(*sit);
+  Idx n=rGraph.mStates.size();
+  rGraph.mFlags.assign(n,0);
+  for(sit=rGen.InitStatesBegin(); sit!=rGen.InitStatesEnd(); ++sit)
+    rGraph.mFlags[IsoPos(rGraph.mStates,*sit)] |= 1;
+  for(sit=rGen.MarkedStatesBegin(); sit!=rGen.MarkedStatesEnd(); ++sit)
+    rGraph.mFlags[IsoPos(rGraph.mStates,*sit)] |= 2;
+  // events by name
+  std::map<Idx,Idx> evids;
+  rGraph.mAlphabet.clear();
+  EventSet::Iterator eit;
+  for(eit=rGen.AlphabetBegin(); eit!=rGen.AlphabetEnd(); ++eit) {
+    std::string name=rGen.EventName(*eit);
+    std::map<std::string,Idx>::iterator nit=rNames.find(name);
+    Idx id=rNames.size();
+    if(nit!=rNames.end()) id=nit->second;
+    else rNames[name]=id;
+    evids[*eit]=id;
+    rGraph.mAlphabet.push_back(id);
+  }
+  std::sort(rGraph.mAlphabet.begin(),rGraph.mAlphabet.end());
+  // transitions
+  rGraph.mOut.assign(n,std::vector<IsoEdge>());
+  rGraph.mIn.assign(n,std::vector<IsoEdge>());
+  rGraph.mTransCount=0;
+  Idx lastev=0, lastid=0, lastx1=0, x1pos=0;
+  TransSet::Iterator tit;
+  for(tit=rGen.TransRelBegin(); tit!=rGen.TransRelEnd(); ++tit) {
+    if(tit->Ev!=lastev || lastev==0) {
+      std::map<Idx,Idx>::iterator vit=evids.find(tit->Ev);
+      if(vit!=evids.end()) {
+        lastid=vit->second;
+      } else {
+        std::string name=rGen.EventName(tit->Ev);
+        std::map<std::string,Idx>::iterator nit=rNames.find(name);
+        lastid=rNames.size();
+        if(nit!=rNames.end()) lastid=nit->second;
+        else rNames[name]=lastid;
+        evids[tit->Ev]=lastid;
+      }
+      lastev=tit->Ev;
+    }
+    if(tit->X1!=lastx1 || lastx1==0) {
+      x1pos=IsoPos(rGraph.mStates,tit->X1);
+      lastx1=tit->X1;
+    }
+    Idx x2pos=IsoPos(rGraph.mStates,tit->X2);
+    IsoEdge out={lastid,x2pos};
+    IsoEdge in={lastid,x1pos};
+    rGraph.mOut[x1pos].push_back(out);
+    rGraph.mIn[x2pos].push_back(in);
+    ++rGraph.mTransCount;
+  }
+  for(Idx i=0; i<n; ++i) {
+    std::sort(rGraph.mOut[i].begin(),rGraph.mOut[i].end());
+    std::sort(rGraph.mIn[i].begin(),rGraph.mIn[i].end());
+  }
+  // event hashes
+  rGraph.mEvHash.assign(rNames.size(),0);
+  std::map<std::string,Idx>::iterator nit;
+  for(nit=rNames.begin(); nit!=rNames.end(); ++nit)
+    rGraph.mEvHash[nit->second]=IsoString(nit->first);
+}
+
+// number of distinct colors
+Idx IsoClasses(const std::vector<uint64_t>& rColors) {
+  std::vector<uint64_t> sorted(rColors);
+  std::sort(sorted.begin(),sorted.end());
+  return (Idx) (std::unique(sorted.begin(),sorted.end()) - sorted.begin());
+}
+
+// refine state colors until the number of classes is stable, two independent lanes
+void IsoRefine(const IsoGraph& rGraph, std::vector<uint64_t>& rColA, std::vector<uint64_t>& rColB, Idx& rRounds) {
+  Idx n=rGraph.mStates.size();
+  rColA.resize(n);
+  rColB.resize(n);
+  for(Idx i=0; i<n; ++i) {
+    rColA[i]=IsoMixA(rGraph.mFlags[i]+1);
+    rColB[i]=IsoMixB(rGraph.mFlags[i]+1);
+  }
+  Idx classes=IsoClasses(rColA);
+  std::vector<uint64_t> nextA(n), nextB(n);
+  rRounds=0;
+  while(true) {
+    for(Idx i=0; i<n; ++i) {
+      uint64_t sa=0, sb=0;
+      std::vector<IsoEdge>::const_iterator eit;
+      for(eit=rGraph.mOut[i].begin(); eit!=rGraph.mOut[i].end(); ++eit) {
+        uint64_t ev=rGraph.mEvHash[eit->mEv];
+        sa+=IsoMixA(ev ^ IsoMixA(rColA[eit->mState]));
+        sb+=IsoMixB(ev ^ IsoMixB(rColB[eit->mState]));
+      }
+      for(eit=rGraph.mIn[i].begin(); eit!=rGraph.mIn[i].end(); ++eit) {
+        uint64_t ev=~rGraph.mEvHash[eit->mEv];
+        sa+=IsoMixA(ev ^ IsoMixA(rColA[eit->mState]));
+        sb+=IsoMixB(ev ^ IsoMixB(rColB[eit->mState]));
+      }
+      nextA[i]=IsoCombine(rColA[i],sa);
+      nextB[i]=IsoMixB(rColB[i] ^ IsoMixB(sb + 0x9e3779b97f4a7c15ULL));
+    }
+    rColA.swap(nextA);
+    rColB.swap(nextB);
+    ++rRounds;
+    Idx next=IsoClasses(rColA);
+    if(next<=classes) break;
+    classes=next;
+  }
+}
+
+// fingerprint from refined colors
+StructuralFingerprint IsoFingerprint(const IsoGraph& rGraph,
+  const std::vector<uint64_t>& rColA, const std::vector<uint64_t>& rColB, Idx rounds)
+{
+  uint64_t evacc=0;
+  for(std::size_t i=0; i<rGraph.mAlphabet.size(); ++i)
+    evacc+=IsoMixA(rGraph.mEvHash[rGraph.mAlphabet[i]]);
+  uint64_t acca=0, accb=0;
+  for(std::size_t i=0; i<rColA.size(); ++i) {
+    acca+=IsoMixA(rColA[i]);
+    accb+=IsoMixB(rColB[i]);
+  }
+  uint64_t base=IsoString("StructuralFingerprint");
+  base=IsoCombine(base,rGraph.mAlphabet.size());
+  base=IsoCombine(base,evacc);
+  base=IsoCombine(base,rGraph.mStates.size());
+  base=IsoCombine(base,rGraph.mTransCount);
+  base=IsoCombine(base,rounds);
+  StructuralFingerprint res;
+  res.mHigh=IsoCombine(base,acca);
+  res.mLow=IsoMixB(IsoMixB(base) ^ accb);
+  return res;
+}
+
+// test edge in sorted edge list
+inline bool IsoHasEdge(const std::vector<IsoEdge>& rEdges, Idx ev, Idx state) {
+  IsoEdge edge={ev,state};
+  return std::binary_search(rEdges.begin(),rEdges.end(),edge);
+}
+
+// test whether mapping x1 -> x2 is consistent with the current partial map
+// (unmapped states are indicated by none)
+bool IsoConsistent(const IsoGraph& rGraph1, const IsoGraph& rGraph2, Idx x1, Idx x2,
+  const std::vector<Idx>& rMap12, const std::vector<Idx>& rMap21, Idx none)
+{
+  if(rGraph1.mFlags[x1]!=rGraph2.mFlags[x2]) return false;
+  if(rGraph1.mOut[x1].size()!=rGraph2.mOut[x2].size()) return false;
+  if(rGraph1.mIn[x1].size()!=rGraph2.mIn[x2].size()) return false;
+  std::vector<IsoEdge>::const_iterator eit;
+  // edges to mapped states, from 1 to 2 (incl self-loops)
+  for(eit=rGraph1.mOut[x1].begin(); eit!=rGraph1.mOut[x1].end(); ++eit) {
+    Idx y2 = eit->mState==x1 ? x2 : rMap12[eit->mState];
+    if(y2==none) continue;
+    if(!IsoHasEdge(rGraph2.mOut[x2],eit->mEv,y2)) return false;
+  }
+  for(eit=rGraph1.mIn[x1].begin(); eit!=rGraph1.mIn[x1].end(); ++eit) {
+    Idx y2 = eit->mState==x1 ? x2 : rMap12[eit->mState];
+    if(y2==none) continue;
+    if(!IsoHasEdge(rGraph2.mIn[x2],eit->mEv,y2)) return false;
+  }
+  // edges to mapped states, from 2 to 1 (incl self-loops)
+  for(eit=rGraph2.mOut[x2].begin(); eit!=rGraph2.mOut[x2].end(); ++eit) {
+    Idx y1 = eit->mState==x2 ? x1 : rMap21[eit->mState];
+    if(y1==none) continue;
+    if(!IsoHasEdge(rGraph1.mOut[x1],eit->mEv,y1)) return false;
+  }
+  for(eit=rGraph2.mIn[x2].begin(); eit!=rGraph2.mIn[x2].end(); ++eit) {
+    Idx y1 = eit->mState==x2 ? x1 : rMap21[eit->mState];
+    if(y1==none) continue;
+    if(!IsoHasEdge(rGraph1.mIn[x1],eit->mEv,y1)) return false;
+  }
+  return true;
+}
+
+} // namespace
+
+
+/*
+************************************************************************
+************************************************************************
+
+Fingerprint and isomorphism test
+
+************************************************************************
+************************************************************************
+*/
+
+// Fingerprint(rGen)
+StructuralFingerprint Fingerprint(const vGenerator& rGen) {
+  FD_DF("Fingerprint(" << rGen.Name() << ")");
+  std::map<std::string,Idx> names;
+  IsoGraph graph;
+  IsoBuild(rGen,names,graph);
+  std::vector<uint64_t> cola, colb;
+  Idx rounds;
+  IsoRefine(graph,cola,colb,rounds);
+  return IsoFingerprint(graph,cola,colb,rounds);
+}
+
+// IsIsomorphic(rGen1, rGen2)
+bool IsIsomorphic(const vGenerator& rGen1, const vGenerator& rGen2) {
+  std::map<Idx,Idx> statemap;
+  return IsIsomorphic(rGen1,rGen2,statemap);
+}
+
+// IsIsomorphic(rGen1, rGen2, rStateMap)
+bool IsIsomorphic(const vGenerator& rGen1, const vGenerator& rGen2, std::map<Idx,Idx>& rStateMap) {
+  FD_DF("IsIsomorphic(" << rGen1.Name() << "," << rGen2.Name() << ")");
+  rStateMap.clear();
+  // trivial reject
+  if(rGen1.Size()!=rGen2.Size()) return false;
+  if(rGen1.TransRelSize()!=rGen2.TransRelSize()) return false;
+  if(rGen1.InitStatesSize()!=rGen2.InitStatesSize()) return false;
+  if(rGen1.MarkedStatesSize()!=rGen2.MarkedStatesSize()) return false;
+  if(rGen1.AlphabetSize()!=rGen2.AlphabetSize()) return false;
+  // set up graphs with common event ids
+  std::map<std::string,Idx> names;
+  IsoGraph graph1, graph2;
+  IsoBuild(rGen1,names,graph1);
+  IsoBuild(rGen2,names,graph2);
+  if(graph1.mAlphabet!=graph2.mAlphabet) return false;
+  graph1.mEvHash=graph2.mEvHash;
+  // reject by fingerprint
+  std::vector<uint64_t> cola1, colb1, cola2, colb2;
+  Idx rounds1, rounds2;
+  IsoRefine(graph1,cola1,colb1,rounds1);
+  IsoRefine(graph2,cola2,colb2,rounds2);
+  if(IsoFingerprint(graph1,cola1,colb1,rounds1)!=IsoFingerprint(graph2,cola2,colb2,rounds2)) {
+    FD_DF("IsIsomorphic(): reject by fingerprint");
+    return false;
+  }
+  // isomorphic generators refine identically: compare color classes
+  std::vector<uint64_t> sorted1(cola1), sorted2(cola2);
+  std::sort(sorted1.begin(),sorted1.end());
+  std::sort(sorted2.begin(),sorted2.end());
+  if(sorted1!=sorted2) return false;
+  Idx n=graph1.mStates.size();
+  if(n==0) return true;
+  // candidates by color
+  std::map<uint64_t, std::vector<Idx> > classes2;
+  for(Idx i=0; i<n; ++i) classes2[cola2[i]].push_back(i);
+  // search order: breadth-first over undirected edges, smaller classes first as roots
+  std::vector<Idx> order;
+  order.reserve(n);
+  std::vector<Idx> anchor(n,n);  // position of an earlier neighbour in order, or n
+  std::vector<bool> visited(n,false);
+  std::vector< std::pair<std::size_t,Idx> > roots;
+  for(Idx i=0; i<n; ++i) roots.push_back(std::make_pair(classes2[cola1[i]].size(),i));
+  std::sort(roots.begin(),roots.end());
+  for(Idx r=0; r<n; ++r) {
+    Idx root=roots[r].second;
+    if(visited[root]) continue;
+    visited[root]=true;
+    std::size_t head=order.size();
+    order.push_back(root);
+    while(head<order.size()) {
+      Idx x=order[head++];
+      for(int dir=0; dir<2; ++dir) {
+        const std::vector<IsoEdge>& edges = dir==0 ? graph1.mOut[x] : graph1.mIn[x];
+        std::vector<IsoEdge>::const_iterator eit;
+        for(eit=edges.begin(); eit!=edges.end(); ++eit) {
+          if(visited[eit->mState]) continue;
+          visited[eit->mState]=true;
+          anchor[eit->mState]=x;
+          order.push_back(eit->mState);
+        }
+      }
+    }
+  }
+  // backtracking search with explicit stack
+  const Idx none=2*n;
+  std::vector<Idx> map12(n,none), map21(n,none);
+  std::vector< std::vector<Idx> > cands(n);
+  std::vector<std::size_t> next(n,0);
+  Idx depth=0;
+  bool fresh=true;
+  while(true) {
+    Idx x1=order[depth];
+    // candidates: neighbours of the anchor's image, or the entire color class
+    if(fresh) {
+      cands[depth].clear();
+      next[depth]=0;
+      Idx a1=anchor[x1];
+      if(a1<n) {
+        Idx a2=map12[a1];
+        std::vector<IsoEdge>::const_iterator eit;
+        for(eit=graph2.mOut[a2].begin(); eit!=graph2.mOut[a2].end(); ++eit)
+          if(cola2[eit->mState]==cola1[x1]) cands[depth].push_back(eit->mState);
+        for(eit=graph2.mIn[a2].begin(); eit!=graph2.mIn[a2].end(); ++eit)
+          if(cola2[eit->mState]==cola1[x1]) cands[depth].push_back(eit->mState);
+        std::sort(cands[depth].begin(),cands[depth].end());
+        cands[depth].erase(std::unique(cands[depth].begin(),cands[depth].end()),cands[depth].end());
+      } else {
+        cands[depth]=classes2[cola1[x1]];
+      }
+      fresh=false;
+    }
+    // undo previous choice at this depth
+    if(map12[x1]!=none) {
+      map21[map12[x1]]=none;
+      map12[x1]=none;
+    }
+    // try next candidate
+    bool found=false;
+    while(next[depth]<cands[depth].size()) {
+      Idx x2=cands[depth][next[depth]++];
+      if(map21[x2]!=none) continue;
+      if(!IsoConsistent(graph1,graph2,x1,x2,map12,map21,none)) continue;
+      map12[x1]=x2;
+      map21[x2]=x1;
+      found=true;
+      break;
+    }
+    if(found) {
+      if(depth+1==n) break;
+      ++depth;
+      fresh=true;
+      continue;
+    }
+    // backtrack
+    if(depth==0) {
+      FD_DF("IsIsomorphic(): no bijection");
+      return false;
+    }
+    --depth;
+  }
+  // report state map
+  for(Idx i=0; i<n; ++i)
+    rStateMap[graph1.mStates[i]]=graph2.mStates[map12[i]];
+  return true;
+}
+
+
+} // namespace faudes
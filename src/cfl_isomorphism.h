@@ -0,0 +1,143 @@
+/** @file cfl_isomorphism.h @brief Structural fingerprint and isomorphism test for generators */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_ISOMORPHISM_H
+#define FAUDES_ISOMORPHISM_H
+
+#include "cfl_definitions.h"
+#include "cfl_generator.h"
+#include <map>
+#include <string>
+
+namespace faudes {
+
+/**
+ * Structural fingerprint of a generator.
+ *
+ * A 128-bit value that only depends on the structure of a generator, i.e.,
+ * on the alphabet (by event names), the transition relation and the initial and marked
+ * states, up to renumbering of states. State names, attributes and the generator name are
+ * not considered. Isomorphic generators have equal fingerprints; generators with equal
+ * fingerprints are isomorphic with high probability. See Fingerprint(const vGenerator&).
+ *
+ * @ingroup GeneratorFunctions
+ */
+class FAUDES_API StructuralFingerprint {
+public:
+  /** Construct zero fingerprint */
+  StructuralFingerprint(void) : mHigh(0), mLow(0) {};
+
+  /** Upper 64 bits */
+  uint64_t mHigh;
+
+  /** Lower 64 bits */
+  uint64_t mLow;
+
+  /** Test equality */
+  bool operator==(const StructuralFingerprint& rOther) const
+    { return mHigh==rOther.mHigh && mLow==rOther.mLow; };
+
+  /** Test inequality */
+  bool operator!=(const StructuralFingerprint& rOther) const
+    { return !operator==(rOther); };
+
+  /** Order for sorting and containers */
+  bool operator<(const StructuralFingerprint& rOther) const
+    { return mHigh<rOther.mHigh || (mHigh==rOther.mHigh && mLow<rOther.mLow); };
+
+  /** Hexadecimal representation (32 digits) */
+  std::string Str(void) const;
+};
+
+
+/**
+ * Structural fingerprint.
+ *
+ * The fingerprint is computed by iterated refinement of state colors: initially,
+ * states are colored by their initial and marked flags; in each round, the color of a
+ * state is combined with the colors of its successors and predecessors and the
+ * respective events. Refinement stops when the number of distinct colors is stable,
+ * and the fingerprint is a hash over the alphabet and the final colors. Thus, the
+ * fingerprint is invariant under renumbering of states, and it distinguishes
+ * generators that can be told apart by refinement. Computational cost is
+ * O((n log n + m) * r) for n states, m transitions and r rounds.
+ *
+ * @param rGen
+ *   Generator
+ * @return
+ *   Fingerprint
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API StructuralFingerprint Fingerprint(const vGenerator& rGen);
+
+
+/**
+ * Test for isomorphism.
+ *
+ * Two generators are isomorphic if there is a bijection between their state sets that
+ * maps initial states to initial states, marked states to marked states and transitions
+ * to transitions. Events are identified by name and the alphabets must match. State
+ * names, attributes and the generator names are not considered.
+ *
+ * The test first compares the structural fingerprints and then searches for a
+ * bijection among states with matching refinement colors. Thus, non-isomorphic generators
+ * are in most cases rejected in time linear per refinement round. For highly
+ * symmetric generators, the search may require backtracking.
+ *
+ * @param rGen1
+ *   First generator
+ * @param rGen2
+ *   Second generator
+ * @return
+ *   True if generators are isomorphic
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API bool IsIsomorphic(const vGenerator& rGen1, const vGenerator& rGen2);
+
+
+/**
+ * Test for isomorphism.
+ *
+ * Same as IsIsomorphic(const vGenerator&, const vGenerator&), however, the
+ * bijection is returned as a map from states of the first generator to states of
+ * the second generator.
+ *
+ * @param rGen1
+ *   First generator
+ * @param rGen2
+ *   Second generator
+ * @param rStateMap
+ *   Resulting state map, cleared if not isomorphic
+ * @return
+ *   True if generators are isomorphic
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API bool IsIsomorphic(const vGenerator& rGen1, const vGenerator& rGen2,
+  std::map<Idx,Idx>& rStateMap);
+
+
+} // namespace faudes
+
+#endif
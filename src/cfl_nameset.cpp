@@ -467,8 +467,7 @@ NameSet NameSet::operator + (const NameSet& rOtherSet) const {
 #endif
   NameSet res;
   res.mpSymbolTable=mpSymbolTable;
-  res.InsertSet(*this);
-  res.InsertSet(rOtherSet);
+  res.DoSetUnion(*this,rOtherSet);
   return res;
 }
 
@@ -484,8 +483,7 @@ NameSet NameSet::operator - (const NameSet& rOtherSet) const {
 #endif
   NameSet res;
   res.mpSymbolTable=mpSymbolTable;
-  res.InsertSet(*this);
-  res.EraseSet(rOtherSet);
+  res.DoSetDifference(*this,rOtherSet);
   return res;
 }
 
@@ -502,8 +500,7 @@ NameSet NameSet::operator * (const NameSet& rOtherSet) const {
 #endif
   NameSet res;
   res.mpSymbolTable=mpSymbolTable;
-  res.InsertSet(*this);
-  res.RestrictSet(rOtherSet);
+  res.DoSetIntersection(*this,rOtherSet);
   return res;
 }
 
@@ -22,6 +22,8 @@
 
 #include "cfl_parallel.h"
 #include "cfl_conflequiv.h"
+#include "cfl_genbuilder.h"
+#include "cfl_budget.h"
 
 /* turn on debugging for this file */
 //#undef FD_DF
@@ -38,8 +40,16 @@ void Parallel(const Generator& rGen1, const Generator& rGen2, Generator& rResGen
   if(&rResGen== &rGen1 || &rResGen== &rGen2) {
     pResGen= rResGen.New();
   }
-  // doit
-  Parallel(rGen1, rGen2, cmap, *pResGen);
+  // doit (pass on partial result on exceeded execution budget)
+  try {
+    Parallel(rGen1, rGen2, cmap, *pResGen);
+  } catch(const Exception& exception) {
+    if(pResGen != &rResGen) {
+      if(exception.Id()==111) pResGen->Move(rResGen);
+      delete pResGen;
+    }
+    throw;
+  }
   // copy result
   if(pResGen != &rResGen) {
     pResGen->Move(rResGen);
@@ -306,16 +316,12 @@ void Parallel(
   pResGen->Name(CollapsString(rGen1.Name()+"||"+rGen2.Name()));
   rCompositionMap.clear();
 
+  // record result in append-only buffers
+  GeneratorBuilder builder;
+
   // create res alphabet
-  EventSet::Iterator eit;
-  for (eit = rGen1.AlphabetBegin(); eit != rGen1.AlphabetEnd(); ++eit) {
-    pResGen->InsEvent(*eit);
-  }
-  for (eit = rGen2.AlphabetBegin(); eit != rGen2.AlphabetEnd(); ++eit) {
-    pResGen->InsEvent(*eit);
-  }
-  FD_DF("Parallel: inserted indices in rResGen.alphabet( "
-      << pResGen->AlphabetToString() << ")");
+  builder.InsEvents(rGen1.Alphabet());
+  builder.InsEvents(rGen2.Alphabet());
 
   // shared events
   EventSet sharedalphabet = rGen1.Alphabet() * rGen2.Alphabet();
@@ -328,7 +334,10 @@ void Parallel(
   // state
   Idx tmpstate;
   StateSet::Iterator lit1,lit2;
-  TransSet::Iterator tit1, tit1_end, tit2, tit2_end;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView trans1(rGen1.TransRel());
+  TransSet::ConstView trans2(rGen2.TransRel());
+  TransSet::ConstView::Iterator tit1, tit1_end, tit2, tit2_end;
   std::map< std::pair<Idx,Idx>, Idx>::iterator rcit;
 
   // push all combinations of initial states on todo stack
@@ -337,7 +346,7 @@ void Parallel(
     for (lit2 = rGen2.InitStatesBegin(); lit2 != rGen2.InitStatesEnd(); ++lit2) {
       currentstates = std::make_pair(*lit1, *lit2);
       todo.push(currentstates);
-      tmpstate = pResGen->InsInitState();
+      tmpstate = builder.InsInitState();
       rCompositionMap[currentstates] = tmpstate;
       FD_DF("Parallel:   (" << *lit1 << "|" << *lit2 << ") -> " 
           << rCompositionMap[currentstates]);
@@ -351,6 +360,8 @@ void Parallel(
     // LoopCallback();
     // allow for user interrupt, incl progress report
     FD_WPC(rCompositionMap.size(),rCompositionMap.size()+todo.size(),"Parallel(): processing"); 
+    // stop on exceeded execution budget
+    if(ExecutionBudget::Check(rCompositionMap.size(),builder.TransRelSize())) break;
     // get next reachable state from todo stack
     currentstates = todo.top();
     todo.pop();
@@ -359,8 +370,8 @@ void Parallel(
         << rCompositionMap[currentstates]);
     // iterate over all rGen1 transitions 
     // (includes execution of shared events)
-    tit1 = rGen1.TransRelBegin(currentstates.first);
-    tit1_end = rGen1.TransRelEnd(currentstates.first);
+    tit1 = trans1.Begin(currentstates.first);
+    tit1_end = trans1.End(currentstates.first);
     for (; tit1 != tit1_end; ++tit1) {
       // if event not shared
       if (! sharedalphabet.Exists(tit1->Ev)) {
@@ -370,7 +381,7 @@ void Parallel(
         rcit = rCompositionMap.find(newstates);
         if (rcit == rCompositionMap.end()) {
           todo.push(newstates);
-          tmpstate = pResGen->InsState();
+          tmpstate = builder.InsState();
           rCompositionMap[newstates] = tmpstate;
           FD_DF("Parallel:   todo push: (" << newstates.first << "|" 
               << newstates.second << ") -> " 
@@ -379,7 +390,7 @@ void Parallel(
         else {
           tmpstate = rcit->second;
         }
-        pResGen->SetTransition(rCompositionMap[currentstates], tit1->Ev, tmpstate);
+        builder.SetTransition(rCompositionMap[currentstates], tit1->Ev, tmpstate);
         FD_DF("Parallel:   add transition to new generator: " 
             << rCompositionMap[currentstates] << "-" << tit1->Ev << "-" 
             << tmpstate);
@@ -388,15 +399,15 @@ void Parallel(
       else {
         FD_DF("Parallel:   common event");
         // find shared transitions
-        tit2 = rGen2.TransRelBegin(currentstates.second, tit1->Ev);
-        tit2_end = rGen2.TransRelEnd(currentstates.second, tit1->Ev);
+        tit2 = trans2.Begin(currentstates.second, tit1->Ev);
+        tit2_end = trans2.End(currentstates.second, tit1->Ev);
         for (; tit2 != tit2_end; ++tit2) {
           newstates = std::make_pair(tit1->X2, tit2->X2);
           // add to todo list if composition state is new
           rcit = rCompositionMap.find(newstates);
           if (rcit == rCompositionMap.end()) {
             todo.push(newstates);
-            tmpstate = pResGen->InsState();
+            tmpstate = builder.InsState();
             rCompositionMap[newstates] = tmpstate;
             FD_DF("Parallel:   todo push: (" << newstates.first << "|" 
                 << newstates.second << ") -> " 
@@ -405,7 +416,7 @@ void Parallel(
           else {
             tmpstate = rcit->second;
           }
-          pResGen->SetTransition(rCompositionMap[currentstates], 
+          builder.SetTransition(rCompositionMap[currentstates], 
               tit1->Ev, tmpstate);
           FD_DF("Parallel:   add transition to new generator: " 
               << rCompositionMap[currentstates] << "-" 
@@ -415,8 +426,8 @@ void Parallel(
     }
     // iterate over all rGen2 transitions 
     // (without execution of shared events)
-    tit2 = rGen2.TransRelBegin(currentstates.second);
-    tit2_end = rGen2.TransRelEnd(currentstates.second);
+    tit2 = trans2.Begin(currentstates.second);
+    tit2_end = trans2.End(currentstates.second);
     for (; tit2 != tit2_end; ++tit2) {
       if (! sharedalphabet.Exists(tit2->Ev)) {
         FD_DF("Parallel:   exists only in rGen2");
@@ -425,7 +436,7 @@ void Parallel(
         rcit = rCompositionMap.find(newstates);
         if (rcit == rCompositionMap.end()) {
           todo.push(newstates);
-          tmpstate = pResGen->InsState();
+          tmpstate = builder.InsState();
           rCompositionMap[newstates] = tmpstate;
           FD_DF("Parallel:   todo push: (" << newstates.first << "|" 
               << newstates.second << ") -> " 
@@ -434,7 +445,7 @@ void Parallel(
         else {
           tmpstate = rcit->second;
         }
-        pResGen->SetTransition(rCompositionMap[currentstates], 
+        builder.SetTransition(rCompositionMap[currentstates], 
             tit2->Ev, tmpstate);
         FD_DF("Parallel:   add transition to new generator: " 
             << rCompositionMap[currentstates] << "-" 
@@ -448,21 +459,24 @@ void Parallel(
   while(rcit!=rCompositionMap.end()) {    
     if(rGen1.ExistsMarkedState(rcit->first.first))
       if(rGen2.ExistsMarkedState(rcit->first.second))
-        pResGen->SetMarkedState(rcit->second);
+        builder.SetMarkedState(rcit->second);
     ++rcit;
   }
+  builder.Finalize(*pResGen);
   FD_DF("Parallel: marked states: " << pResGen->MarkedStatesToString());
 
-  // copy result
+  // set statenames (before the move, since the result may alias an argument)
+  if(rGen1.StateNamesEnabled() && rGen2.StateNamesEnabled() && pResGen->StateNamesEnabled()) 
+    SetComposedStateNames(rGen1, rGen2, rCompositionMap, *pResGen); 
+  else
+    pResGen->StateNamesEnabled(false);
+  // move result
   if(pResGen != &rResGen) {
-    rResGen = *pResGen;
+    pResGen->Move(rResGen);
     delete pResGen;
   }
-  // set statenames
-  if(rGen1.StateNamesEnabled() && rGen2.StateNamesEnabled() && rResGen.StateNamesEnabled()) 
-    SetComposedStateNames(rGen1, rGen2, rCompositionMap, rResGen); 
-  else
-    rResGen.StateNamesEnabled(false);
+  // throw on exceeded execution budget
+  ExecutionBudget::Abort("Parallel()",rResGen);
 }
 
 
@@ -583,8 +597,11 @@ void Product(
   pResGen->Clear();
   rCompositionMap.clear();
 
+  // record result in append-only buffers
+  GeneratorBuilder builder;
+
   // shared alphabet
-  pResGen->InjectAlphabet(rGen1.Alphabet() * rGen2.Alphabet());
+  builder.InsEvents(rGen1.Alphabet() * rGen2.Alphabet());
   FD_DF("Product: shared alphabet: "
       << (rGen1.Alphabet() * rGen2.Alphabet()).ToString());
 
@@ -596,7 +613,10 @@ void Product(
   Idx tmpstate;
   
   StateSet::Iterator lit1, lit2;
-  TransSet::Iterator tit1, tit1_end, tit2, tit2_end, tit2_begin;
+  // read-only views on transition relations, no iterator tracking
+  TransSet::ConstView trans1(rGen1.TransRel());
+  TransSet::ConstView trans2(rGen2.TransRel());
+  TransSet::ConstView::Iterator tit1, tit1_end, tit2, tit2_end, tit2_begin;
   std::map< std::pair<Idx,Idx>, Idx>::iterator rcit;
 
   // push all combinations of initial states on todo stack
@@ -607,7 +627,7 @@ void Product(
         lit2 != rGen2.InitStatesEnd(); ++lit2) {
       currentstates = std::make_pair(*lit1, *lit2);
       todo.push(currentstates);
-      rCompositionMap[currentstates] = pResGen->InsInitState();
+      rCompositionMap[currentstates] = builder.InsInitState();
       FD_DF("Product:   (" << *lit1 << "|" << *lit2 << ") -> " 
           << rCompositionMap[currentstates]);
     }
@@ -620,16 +640,18 @@ void Product(
     // LoopCallback();
     // allow for user interrupt, incl progress report
     FD_WPC(rCompositionMap.size(),rCompositionMap.size()+todo.size(),"Product(): processing"); 
+    // stop on exceeded execution budget
+    if(ExecutionBudget::Check(rCompositionMap.size(),builder.TransRelSize())) break;
     // get next reachable state from todo stack
     currentstates = todo.top();
     todo.pop();
     FD_DF("Product: processing (" << currentstates.first << "|" 
         << currentstates.second << ") -> " << rCompositionMap[currentstates]);
     // iterate over all rGen1 and rGen2 transitions
-    tit1 = rGen1.TransRelBegin(currentstates.first);
-    tit1_end = rGen1.TransRelEnd(currentstates.first);
-    tit2 = rGen2.TransRelBegin(currentstates.second);
-    tit2_end = rGen2.TransRelEnd(currentstates.second);
+    tit1 = trans1.Begin(currentstates.first);
+    tit1_end = trans1.End(currentstates.first);
+    tit2 = trans2.Begin(currentstates.second);
+    tit2_end = trans2.End(currentstates.second);
     while((tit1 != tit1_end) && (tit2 != tit2_end)) {
       // sync event by tit1
       if(tit1->Ev < tit2->Ev) {
@@ -652,7 +674,7 @@ void Product(
         rcit = rCompositionMap.find(newstates);
         if(rcit == rCompositionMap.end()) {
           todo.push(newstates);
-          tmpstate = pResGen->InsState();
+          tmpstate = builder.InsState();
           rCompositionMap[newstates] = tmpstate;
 	  //if(tmpstate%1000==0)
           FD_DF("Product: todo push: (" << newstates.first << "|" 
@@ -661,7 +683,7 @@ void Product(
           tmpstate = rcit->second;
         }
         // set transition in result
-        pResGen->SetTransition(rCompositionMap[currentstates], tit1->Ev, tmpstate);
+        builder.SetTransition(rCompositionMap[currentstates], tit1->Ev, tmpstate);
         FD_DF("Product: add transition to new generator: " 
             << rCompositionMap[currentstates] << "-" << tit1->Ev << "-" << tmpstate);
         ++tit2;
@@ -681,21 +703,24 @@ void Product(
   while(rcit!=rCompositionMap.end()) {    
     if(rGen1.ExistsMarkedState(rcit->first.first))
       if(rGen2.ExistsMarkedState(rcit->first.second))
-        pResGen->SetMarkedState(rcit->second);
+        builder.SetMarkedState(rcit->second);
     ++rcit;
   }
+  builder.Finalize(*pResGen);
   FD_DF("Parallel: marked states: " << pResGen->MarkedStatesToString());
 
-  // copy result (TODO: use move)
+  // set statenames (before the move, since the result may alias an argument)
+  if(rGen1.StateNamesEnabled() && rGen2.StateNamesEnabled() && pResGen->StateNamesEnabled()) 
+    SetComposedStateNames(rGen1, rGen2, rCompositionMap, *pResGen); 
+  else
+    pResGen->ClearStateNames();
+  // move result
   if(pResGen != &rResGen) {
-    rResGen = *pResGen;
+    pResGen->Move(rResGen);
     delete pResGen;
   }
-  // set statenames
-  if(rGen1.StateNamesEnabled() && rGen2.StateNamesEnabled() && rResGen.StateNamesEnabled()) 
-    SetComposedStateNames(rGen1, rGen2, rCompositionMap, rResGen); 
-  else
-    rResGen.ClearStateNames();
+  // throw on exceeded execution budget
+  ExecutionBudget::Abort("Product()",rResGen);
 
   FD_DF("Product(...): done");
 }
@@ -27,6 +27,7 @@
 
 // Extra header
 #include <signal.h>
+#include <cstdio>
 #include <exception>
 #include <ostream>
 
@@ -115,6 +116,20 @@ void faudes_sleep(long int sec) { faudes_invalid("faudes_sleep()"); }
 void faudes_usleep(long int usec) { faudes_invalid("faudes_usleep()"); }
 #endif
 
+// Uniform memory usage for POSIX/Windows (currently Linux only)
+#if defined(FAUDES_POSIX) && defined(__linux__)
+std::size_t faudes_memusage(void) {
+  FILE* statm=fopen("/proc/self/statm","r");
+  if(!statm) return 0;
+  unsigned long int pages=0, resident=0;
+  if(fscanf(statm,"%lu %lu",&pages,&resident)!=2) resident=0;
+  fclose(statm);
+  return (std::size_t) resident * (std::size_t) sysconf(_SC_PAGESIZE);
+}
+#else
+std::size_t faudes_memusage(void) { return 0; }
+#endif
+
 
 
 #ifdef FAUDES_SYSTIME
@@ -435,6 +450,60 @@ int faudes_mutex_unlock(faudes_mutex_t *mtx){
 #endif // Windows mutexes
 
 
+// straight POSIX reader/writer locks (aka plain wrappers)
+#ifdef FAUDES_THREADS
+#ifdef FAUDES_POSIX
+int faudes_rwlock_init(faudes_rwlock_t* rwl){
+  return pthread_rwlock_init(rwl, NULL)==0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+}
+void faudes_rwlock_destroy(faudes_rwlock_t* rwl){
+  pthread_rwlock_destroy(rwl);
+}
+int faudes_rwlock_rdlock(faudes_rwlock_t* rwl) {
+  return pthread_rwlock_rdlock(rwl) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+}
+int faudes_rwlock_rdunlock(faudes_rwlock_t* rwl) {
+  return pthread_rwlock_unlock(rwl) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+}
+int faudes_rwlock_wrlock(faudes_rwlock_t* rwl) {
+  return pthread_rwlock_wrlock(rwl) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+}
+int faudes_rwlock_wrunlock(faudes_rwlock_t* rwl) {
+  return pthread_rwlock_unlock(rwl) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+}
+#endif
+#endif // POSIX reader/writer locks
+
+// Windows slim reader/writer locks to mimique POSIX rwlocks
+#ifdef FAUDES_THREADS
+#ifdef FAUDES_WINDOWS
+int faudes_rwlock_init(faudes_rwlock_t* rwl){
+  InitializeSRWLock(rwl);
+  return FAUDES_THREAD_SUCCESS;
+}
+void faudes_rwlock_destroy(faudes_rwlock_t* rwl){
+  (void) rwl;
+}
+int faudes_rwlock_rdlock(faudes_rwlock_t* rwl) {
+  AcquireSRWLockShared(rwl);
+  return FAUDES_THREAD_SUCCESS;
+}
+int faudes_rwlock_rdunlock(faudes_rwlock_t* rwl) {
+  ReleaseSRWLockShared(rwl);
+  return FAUDES_THREAD_SUCCESS;
+}
+int faudes_rwlock_wrlock(faudes_rwlock_t* rwl) {
+  AcquireSRWLockExclusive(rwl);
+  return FAUDES_THREAD_SUCCESS;
+}
+int faudes_rwlock_wrunlock(faudes_rwlock_t* rwl) {
+  ReleaseSRWLockExclusive(rwl);
+  return FAUDES_THREAD_SUCCESS;
+}
+#endif
+#endif // Windows reader/writer locks
+
+
 // straight PPOSIX conditions (aka plain wrappers)
 #ifdef FAUDES_THREADS
 #ifdef FAUDES_POSIX
@@ -448,7 +517,7 @@ int faudes_cond_signal(faudes_cond_t *cond){
   return pthread_cond_signal(cond) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
 }
 int faudes_cond_broadcast(faudes_cond_t *cond) {
-  return pthread_cond_signal(cond) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
+  return pthread_cond_broadcast(cond) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
 }
 int faudes_cond_wait(faudes_cond_t *cond, faudes_mutex_t *mtx) {
   return pthread_cond_wait(cond, mtx) == 0 ? FAUDES_THREAD_SUCCESS : FAUDES_THREAD_ERROR;
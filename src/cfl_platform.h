@@ -195,6 +195,9 @@ extern FAUDES_API const char* faudes_strsignal(int sig);
 extern FAUDES_API void faudes_sleep(long int sec);
 extern FAUDES_API void faudes_usleep(long int usec); 
 
+// Uniform memory usage for POSIX/Windows: resident set size in bytes, 0 if not available (see e.g. ExecutionBudget)
+extern FAUDES_API std::size_t faudes_memusage(void);
+
 
 // have time
 #ifdef FAUDES_SYSTIME
@@ -253,10 +256,31 @@ extern FAUDES_API int faudes_getsocket_error(int fd);
 The remaining section of this file provides elementary support for threads, 
 using a minimalistic subset of the POSIX threads interface. It is tailored for 
 the use of edge-detection and networking as required by the iodevice plug-in. 
-In general, libFAUDES is not threadsafe due to global variables, e.g. 
-symoltables. This may change in a future revision.
+
+The library core supports concurrent computations on independent objects: 
+the global event symbol table is guarded by a reader/writer lock, console 
+output and singleton construction are serialised, and scratch/statistics 
+variables are thread local. Concurrent access to one object, incl. const 
+access, needs external synchronisation: e.g. iterators register with the set 
+they refer to, and generators build re-sorted transition relations on demand. 
+Objects that share data by copy-on-write, i.e., a generator and its copies, 
+must not be accessed from different threads concurrently either; give each 
+thread its own inputs (e.g. read from file) or pass results between threads 
+after join. 
+
+Per-run state of algorithms is local to the call or thread local. Algorithm 
+settings, i.e., BisimulationAlgorithm(), BisimulationCTAThreads(), 
+GeneratorReadThreads() and ConflictEquivalentAbstractionFixpoint(), are stored 
+atomically; they may be changed at any time and apply to invocations that start 
+thereafter, incl. those by other threads. Other global configuration 
+(registries, loop callback, defaults, result cache) is meant to be set up before 
+threads are started.
 */
 
+// Storage class for variables that are static in a single threaded build
+#define FAUDES_TLS thread_local
+
+
 
 // Common return codes 
 #define FAUDES_THREAD_SUCCESS  0 
@@ -293,7 +317,7 @@ extern FAUDES_API faudes_thread_t faudes_thread_current(void);
 extern FAUDES_API int faudes_thread_detach(faudes_thread_t thr);
 extern FAUDES_API int faudes_thread_equal(faudes_thread_t thr0, faudes_thread_t thr1);
 extern FAUDES_API void faudes_thread_exit(void* res);
-extern int faudes_thread_join(faudes_thread_t thr, void **res);
+extern FAUDES_API int faudes_thread_join(faudes_thread_t thr, void **res);
 
 // Mutex data type (use plain POSIX mutex)
 #ifdef FAUDES_POSIX
@@ -312,6 +336,24 @@ extern FAUDES_API int faudes_mutex_lock(faudes_mutex_t *mtx);
 extern FAUDES_API int faudes_mutex_trylock(faudes_mutex_t *mtx);
 extern FAUDES_API int faudes_mutex_unlock(faudes_mutex_t *mtx);
 
+// Reader/writer lock data type (use plain POSIX rwlock)
+#ifdef FAUDES_POSIX
+typedef pthread_rwlock_t faudes_rwlock_t;
+#endif
+
+// Reader/writer lock data type (use Windows "slim reader/writer lock")
+#ifdef FAUDES_WINDOWS
+typedef SRWLOCK faudes_rwlock_t;
+#endif
+
+// Reader/writer lock functions
+extern FAUDES_API int faudes_rwlock_init(faudes_rwlock_t* rwl);
+extern FAUDES_API void faudes_rwlock_destroy(faudes_rwlock_t* rwl);
+extern FAUDES_API int faudes_rwlock_rdlock(faudes_rwlock_t* rwl);
+extern FAUDES_API int faudes_rwlock_rdunlock(faudes_rwlock_t* rwl);
+extern FAUDES_API int faudes_rwlock_wrlock(faudes_rwlock_t* rwl);
+extern FAUDES_API int faudes_rwlock_wrunlock(faudes_rwlock_t* rwl);
+
 // Condition variables (use plain POSIX cond vars)
 #ifdef FAUDES_POSIX
 typedef pthread_cond_t faudes_cond_t;
@@ -340,6 +382,11 @@ extern FAUDES_API int faudes_cond_reltimedwait(faudes_cond_t *cond, faudes_mutex
 
 
 
+#else // threads
+
+// Storage class for variables that are static in a single threaded build
+#define FAUDES_TLS
+
 #endif // threads
 
 #endif // header
@@ -139,6 +139,12 @@ void ProjectNonDet_ref(Generator& rGen, const EventSet& rProjectAlphabet) {
   // NAME
   std::string name=CollapsString("ProjectNonDet(" + rGen.Name() + ")");
 
+  // have the transition relation host its own storage, so that the local reach can
+  // iterate by a read-only view while we insert transitions (no iterator tracking)
+  rGen.TransRel().Detach();
+  TransSet::ConstView trans(rGen.TransRel());
+  TransSet::ConstView::Iterator vit, vit_end;
+
   // ALGORITHM:
 
   // initialize todo stack by adding init states to todo 
@@ -171,22 +177,21 @@ void ProjectNonDet_ref(Generator& rGen, const EventSet& rProjectAlphabet) {
       //track marking
       marked|=rGen.ExistsMarkedState(reachstate);
       // iterate successors
-      tit = rGen.TransRelBegin(reachstate);
-      tit_end = rGen.TransRelEnd();  
-      for(; tit != tit_end; ++tit) {
-        if(tit->X1!=reachstate) break;
+      vit = trans.Begin(reachstate);
+      vit_end = trans.End(reachstate);  
+      for(; vit != vit_end; ++vit) {
    	// for high-level events: insert new transition, add to main todo
-	if(rProjectAlphabet.Exists(tit->Ev)) {
-	  rGen.SetTransition(currentstate, tit->Ev, tit->X2);
-	  if(doned.Insert(tit->X2)) {
-	    FD_DF("ProjectNonDet: todod insert: " << rGen.SStr(tit->X2));
-	    todod.push(tit->X2);
+	if(rProjectAlphabet.Exists(vit->Ev)) {
+	  rGen.SetTransition(currentstate, vit->Ev, vit->X2);
+	  if(doned.Insert(vit->X2)) {
+	    FD_DF("ProjectNonDet: todod insert: " << rGen.SStr(vit->X2));
+	    todod.push(vit->X2);
 	  }
 	}
         // for low-level events: add new states to local reach todo
   	else {
-          if(doner.Insert(tit->X2)) {
-	    todor.push(tit->X2);
+          if(doner.Insert(vit->X2)) {
+	    todor.push(vit->X2);
 	  }
 	}
       }
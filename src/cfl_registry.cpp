@@ -66,7 +66,14 @@ TypeRegistry* TypeRegistry::mpInstance = 0;
 
 // static member: access to singleton
 TypeRegistry* TypeRegistry::G(){
-  // lazy initialization
+  // lazy initialization (function scope statics are initialised exactly once,
+  // also on concurrent first access)
+  static TypeRegistry* sinstance = NewInstance();
+  return(sinstance);
+}
+
+// static member: construct singleton
+TypeRegistry* TypeRegistry::NewInstance(){
   if(!mpInstance){
     FD_DREG("TypeRegistry(): Constrtuct singleton");
     mpInstance = new TypeRegistry();
@@ -416,7 +423,14 @@ FunctionRegistry* FunctionRegistry::mpInstance = 0;
 
 // static member: access to signleton
 FunctionRegistry* FunctionRegistry::G(){
-  // lazy initialization
+  // lazy initialization (function scope statics are initialised exactly once,
+  // also on concurrent first access)
+  static FunctionRegistry* sinstance = NewInstance();
+  return(sinstance);
+}
+
+// static member: construct singleton
+FunctionRegistry* FunctionRegistry::NewInstance(){
   if(!mpInstance){
     FD_DREG("FunctionRegistry(): Construct singleton");
     mpInstance = new FunctionRegistry();
@@ -453,6 +453,9 @@ public:
   /** Singleton instance */
   static TypeRegistry* mpInstance;
 
+  /** Construct singleton instance */
+  static TypeRegistry* NewInstance(void);
+
   /** Constructor */
   TypeRegistry(){}
 
@@ -762,6 +765,9 @@ public:
   /** Singleton instance */
   static FunctionRegistry* mpInstance;
 
+  /** Construct singleton instance */
+  static FunctionRegistry* NewInstance(void);
+
   /** Constructor */
   FunctionRegistry(){}
 
@@ -0,0 +1,557 @@
+/** @file cfl_resultcache.cpp @brief Result cache for run-time interface functions */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#include "cfl_resultcache.h"
+#include "cfl_generator.h"
+#include "cfl_nameset.h"
+#include "cfl_basevector.h"
+#include "cfl_utils.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdio>
+
+namespace faudes {
+
+/*
+************************************************************************
+************************************************************************
+
+Hash primitives
+
+************************************************************************
+************************************************************************
+*/
+
+namespace {
+
+// hash parameters: keys combine two hashes with independent constants
+struct RcParam {
+  uint64_t mBasis;      // string hash: initial value
+  uint64_t mPrime;      // string hash: multiplier
+  uint64_t mMul1;       // mixer: multipliers and shifts
+  uint64_t mMul2;
+  int mShift1;
+  int mShift2;
+  int mShift3;
+  uint64_t mGolden;     // combine: offset
+};
+
+// primary: fnv-1a and splitmix64 finaliser
+const RcParam gRcPrimary = {
+  0xcbf29ce484222325ULL, 0x100000001b3ULL,
+  0xbf58476d1ce4e5b9ULL, 0x94d049bb133111ebULL, 30, 27, 31,
+  0x9e3779b97f4a7c15ULL };
+
+// secondary: other multiplier and murmur3 finaliser
+const RcParam gRcSecondary = {
+  0x84222325cbf29ce4ULL, 0x9e3779b185ebca87ULL,
+  0xff51afd7ed558ccdULL, 0xc4ceb9fe1a85ec53ULL, 33, 33, 33,
+  0xc2b2ae3d27d4eb4fULL };
+
+// mix 64 bits
+inline uint64_t RcMix(uint64_t x, const RcParam& rP) {
+  x ^= x >> rP.mShift1; x *= rP.mMul1;
+  x ^= x >> rP.mShift2; x *= rP.mMul2;
+  x ^= x >> rP.mShift3;
+  return x;
+}
+
+// combine ordered
+inline uint64_t RcCombine(uint64_t h, uint64_t v, const RcParam& rP) {
+  return RcMix(h ^ (v + rP.mGolden + (h<<6) + (h>>2)), rP);
+}
+
+// hash string
+uint64_t RcString(const std::string& rStr, const RcParam& rP) {
+  uint64_t h=rP.mBasis;
+  for(std::size_t i=0; i<rStr.size(); ++i) {
+    h ^= (unsigned char) rStr[i];
+    h *= rP.mPrime;
+  }
+  return RcMix(h,rP);
+}
+
+// hash attribute (0 for default)
+uint64_t RcAttribute(const AttributeVoid& rAttr, const RcParam& rP) {
+  if(rAttr.IsDefault()) return 0;
+  return RcString(rAttr.ToString(),rP);
+}
+
+// hash symbolic set, independent of symbol indices
+uint64_t RcNameSet(const NameSet& rSet, const RcParam& rP) {
+  bool attr = rSet.AttributesSize()>0;
+  uint64_t acc=0;
+  NameSet::Iterator eit;
+  for(eit=rSet.Begin(); eit!=rSet.End(); ++eit) {
+    uint64_t e=RcString(rSet.SymbolicName(*eit),rP);
+    if(attr) e=RcCombine(e,RcAttribute(rSet.Attribute(*eit),rP),rP);
+    acc+=RcMix(e,rP);
+  }
+  uint64_t h=RcString("NameSet",rP);
+  h=RcCombine(h,RcString(rSet.Name(),rP),rP);
+  h=RcCombine(h,rSet.Size(),rP);
+  h=RcCombine(h,acc,rP);
+  return h;
+}
+
+// hash generator, independent of event indices and storage order
+uint64_t RcGenerator(const vGenerator& rGen, const RcParam& rP) {
+  // events by name
+  const EventSet& events=rGen.Alphabet();
+  std::map<Idx,uint64_t> evhash;
+  bool eattr = events.AttributesSize()>0;
+  uint64_t evacc=0;
+  EventSet::Iterator eit;
+  for(eit=events.Begin(); eit!=events.End(); ++eit) {
+    uint64_t e=RcString(rGen.EventName(*eit),rP);
+    evhash[*eit]=e;
+    if(eattr) e=RcCombine(e,RcAttribute(events.Attribute(*eit),rP),rP);
+    evacc+=RcMix(e,rP);
+  }
+  // states incl. names
+  const StateSet& states=rGen.States();
+  bool sattr = states.AttributesSize()>0;
+  bool snames = rGen.StateSymbolTable().Size()>0;
+  uint64_t stacc=0;
+  StateSet::Iterator sit;
+  for(sit=states.Begin(); sit!=states.End(); ++sit) {
+    uint64_t s=RcMix(*sit,rP);
+    if(snames) s=RcCombine(s,RcString(rGen.StateName(*sit),rP),rP);
+    if(sattr) s=RcCombine(s,RcAttribute(states.Attribute(*sit),rP),rP);
+    stacc+=RcMix(s,rP);
+  }
+  // initial and marked states
+  uint64_t inacc=0;
+  for(sit=rGen.InitStatesBegin(); sit!=rGen.InitStatesEnd(); ++sit)
+    inacc+=RcMix(*sit ^ (0x1ULL<<40),rP);
+  uint64_t mkacc=0;
+  for(sit=rGen.MarkedStatesBegin(); sit!=rGen.MarkedStatesEnd(); ++sit)
+    mkacc+=RcMix(*sit ^ (0x2ULL<<40),rP);
+  // transitions, events by name
+  const TransSet& trans=rGen.TransRel();
+  bool tattr = trans.AttributesSize()>0;
+  uint64_t tracc=0;
+  Idx lastev=0;
+  uint64_t lasth=0;
+  TransSet::Iterator tit;
+  for(tit=trans.Begin(); tit!=trans.End(); ++tit) {
+    if(tit->Ev!=lastev || lasth==0) {
+      std::map<Idx,uint64_t>::const_iterator hit=evhash.find(tit->Ev);
+      lasth = hit!=evhash.end() ? hit->second : RcString(rGen.EventName(tit->Ev),rP);
+      lastev=tit->Ev;
+    }
+    uint64_t t=RcCombine(RcCombine(RcMix(tit->X1,rP),lasth,rP),tit->X2,rP);
+    if(tattr) t=RcCombine(t,RcAttribute(trans.Attribute(*tit),rP),rP);
+    tracc+=RcMix(t,rP);
+  }
+  // combine
+  uint64_t h=RcString("Generator",rP);
+  h=RcCombine(h,RcString(rGen.Name(),rP),rP);
+  h=RcCombine(h,events.Size(),rP);
+  h=RcCombine(h,evacc,rP);
+  h=RcCombine(h,states.Size(),rP);
+  h=RcCombine(h,stacc,rP);
+  h=RcCombine(h,rGen.InitStatesSize(),rP);
+  h=RcCombine(h,inacc,rP);
+  h=RcCombine(h,rGen.MarkedStatesSize(),rP);
+  h=RcCombine(h,mkacc,rP);
+  h=RcCombine(h,trans.Size(),rP);
+  h=RcCombine(h,tracc,rP);
+  h=RcCombine(h,RcAttribute(rGen.GlobalAttribute(),rP),rP);
+  return h;
+}
+
+// hash any object
+uint64_t RcObject(const Type& rObject, const RcParam& rP) {
+  // generators
+  const vGenerator* gen=dynamic_cast<const vGenerator*>(&rObject);
+  if(gen) return RcGenerator(*gen,rP);
+  // symbolic sets
+  const NameSet* nset=dynamic_cast<const NameSet*>(&rObject);
+  if(nset) return RcNameSet(*nset,rP);
+  // vectors
+  const vBaseVector* vec=dynamic_cast<const vBaseVector*>(&rObject);
+  if(vec) {
+    uint64_t h=RcString("Vector",rP);
+    h=RcCombine(h,RcString(vec->Name(),rP),rP);
+    h=RcCombine(h,vec->Size(),rP);
+    for(Idx i=0; i<vec->Size(); ++i)
+      h=RcCombine(h,RcObject(vec->At(i),rP),rP);
+    return h;
+  }
+  // fallback: token representation
+  return RcString(rObject.ToString(),rP);
+}
+
+// size of any object: number of elements, or length of token representation
+uint64_t RcSize(const Type& rObject) {
+  const vGenerator* gen=dynamic_cast<const vGenerator*>(&rObject);
+  if(gen) return gen->AlphabetSize() + gen->Size() + gen->TransRelSize();
+  const NameSet* nset=dynamic_cast<const NameSet*>(&rObject);
+  if(nset) return nset->Size();
+  const vBaseVector* vec=dynamic_cast<const vBaseVector*>(&rObject);
+  if(vec) {
+    uint64_t sz=vec->Size();
+    for(Idx i=0; i<vec->Size(); ++i) sz+=RcSize(vec->At(i));
+    return sz;
+  }
+  return rObject.ToString().size();
+}
+
+// key record: both hashes and the total size of the arguments
+struct RcKeyRecord {
+  uint64_t mPrimary;
+  uint64_t mSecondary;
+  uint64_t mSize;
+  RcKeyRecord(const std::string& rOperation) :
+    mPrimary(RcString(rOperation,gRcPrimary)),
+    mSecondary(RcString(rOperation,gRcSecondary)),
+    mSize(0) {}
+  void Combine(uint64_t v) {
+    mPrimary=RcCombine(mPrimary,v,gRcPrimary);
+    mSecondary=RcCombine(mSecondary,v,gRcSecondary);
+  }
+  void Combine(const std::string& rStr) {
+    mPrimary=RcCombine(mPrimary,RcString(rStr,gRcPrimary),gRcPrimary);
+    mSecondary=RcCombine(mSecondary,RcString(rStr,gRcSecondary),gRcSecondary);
+  }
+  void Combine(const Type& rObject) {
+    mPrimary=RcCombine(mPrimary,RcObject(rObject,gRcPrimary),gRcPrimary);
+    mSecondary=RcCombine(mSecondary,RcObject(rObject,gRcSecondary),gRcSecondary);
+    mSize+=RcSize(rObject);
+  }
+  // format key
+  std::string Str(void) const {
+    std::ostringstream str;
+    str << std::hex << std::setfill('0') << std::setw(16) << mPrimary
+        << std::setw(16) << mSecondary << "-" << std::dec << mSize;
+    return str.str();
+  }
+};
+
+} // namespace
+
+
+/*
+************************************************************************
+************************************************************************
+
+Implementation of ResultCache
+
+************************************************************************
+************************************************************************
+*/
+
+// lock helper
+#ifdef FAUDES_THREADS
+namespace {
+class ResultCacheLock {
+public:
+  ResultCacheLock(faudes_mutex_t* pMutex) : mpMutex(pMutex) { faudes_mutex_lock(mpMutex); }
+  ~ResultCacheLock(void) { faudes_mutex_unlock(mpMutex); }
+private:
+  faudes_mutex_t* mpMutex;
+};
+}
+#define FD_RCLOCK ResultCacheLock rclock(&mMutex)
+#else
+#define FD_RCLOCK
+#endif
+
+// singleton
+ResultCache* ResultCache::G(void) {
+  // function scope static, never destructed
+  static ResultCache* sinstance = new ResultCache();
+  return sinstance;
+}
+
+// construct
+ResultCache::ResultCache(void) :
+  mEnabled(false),
+  mCapacity(256),
+  mHits(0),
+  mMisses(0)
+{
+#ifdef FAUDES_THREADS
+  faudes_mutex_init(&mMutex);
+#endif
+  mCacheable.insert("Deterministic");
+  mCacheable.insert("StateMin");
+  mCacheable.insert("Project");
+  mCacheable.insert("Parallel");
+}
+
+// configuration
+void ResultCache::Enabled(bool on) {
+  mEnabled=on;
+  if(on) Function::Cache(this);
+  else if(Function::Cache()==this) Function::Cache(NULL);
+}
+
+// configuration
+bool ResultCache::Enabled(void) const {
+  return mEnabled;
+}
+
+// configuration
+void ResultCache::Capacity(Idx entries) {
+  FD_RCLOCK;
+  mCapacity=entries;
+  DoShrink();
+}
+
+// configuration
+Idx ResultCache::Capacity(void) const {
+  return mCapacity;
+}
+
+// configuration
+void ResultCache::Directory(const std::string& rDirectory) {
+  if(rDirectory!="" && !DirectoryExists(rDirectory)) {
+    std::stringstream errstr;
+    errstr << "Cannot access directory \"" << rDirectory << "\"";
+    throw Exception("ResultCache::Directory()", errstr.str(), 2);
+  }
+  FD_RCLOCK;
+  mDirectory=rDirectory;
+}
+
+// configuration
+std::string ResultCache::Directory(void) const {
+  FD_RCLOCK;
+  return mDirectory;
+}
+
+// configuration
+void ResultCache::Cacheable(const std::string& rFunction, bool on) {
+  FD_RCLOCK;
+  if(on) mCacheable.insert(rFunction);
+  else mCacheable.erase(rFunction);
+}
+
+// configuration
+bool ResultCache::Cacheable(const std::string& rFunction) const {
+  FD_RCLOCK;
+  return mCacheable.find(rFunction)!=mCacheable.end();
+}
+
+// clear
+void ResultCache::Clear(void) {
+  FD_RCLOCK;
+  mEntries.clear();
+  mIndex.clear();
+  mHits=0;
+  mMisses=0;
+}
+
+// statistics
+Idx ResultCache::Size(void) const {
+  FD_RCLOCK;
+  return (Idx) mEntries.size();
+}
+
+// statistics
+Idx ResultCache::Hits(void) const {
+  FD_RCLOCK;
+  return mHits;
+}
+
+// statistics
+Idx ResultCache::Misses(void) const {
+  FD_RCLOCK;
+  return mMisses;
+}
+
+// hash objects
+uint64_t ResultCache::Hash(const Type& rObject) {
+  return RcObject(rObject,gRcPrimary);
+}
+
+// key for operation
+std::string ResultCache::Key(const std::string& rOperation, const std::vector<const Type*>& rArgs) {
+  RcKeyRecord key(rOperation);
+  for(std::size_t i=0; i<rArgs.size(); ++i) {
+    if(rArgs[i]) key.Combine(*rArgs[i]);
+    else key.Combine((uint64_t) 0);
+  }
+  return key.Str();
+}
+
+// key for function call
+std::string ResultCache::Key(const Function& rFunction) const {
+  if(!mEnabled) return "";
+  const FunctionDefinition* fdef=rFunction.Definition();
+  const Signature* sig=rFunction.Variant();
+  if(!fdef || !sig) return "";
+  if(!Cacheable(fdef->Name())) return "";
+  RcKeyRecord key(fdef->Name());
+  key.Combine(sig->Name());
+  for(int i=0; i<rFunction.ParamsSize(); ++i) {
+    const Type* val=rFunction.ParamValue(i);
+    if(!val) return "";
+    Parameter::ParamAttr attr=sig->At(i).Attribute();
+    key.Combine(attr);
+    key.Combine(val->TypeName());
+    if(attr==Parameter::In || attr==Parameter::InOut)
+      key.Combine(*val);
+  }
+  return key.Str();
+}
+
+// look up
+bool ResultCache::Lookup(const std::string& rKey, const std::vector<Type*>& rResults) {
+  // find token representation
+  std::string text;
+  bool found;
+  {
+    FD_RCLOCK;
+    found=DoFind(rKey,text);
+    if(!found) ++mMisses;
+  }
+  if(!found) return false;
+  // read results
+  bool ok=true;
+  try {
+    TokenReader tr(TokenReader::String,text);
+    Token btag;
+    tr.ReadBegin("ResultCache",btag);
+    if(btag.AttributeStringValue("key")!=rKey) ok=false;
+    if(btag.AttributeIntegerValue("results")!=(Int) rResults.size()) ok=false;
+    for(std::size_t i=0; ok && i<rResults.size(); ++i)
+      rResults[i]->Read(tr);
+    if(ok) tr.ReadEnd("ResultCache");
+  } catch(Exception&) {
+    ok=false;
+  }
+  // record outcome, drop invalid entries
+  FD_RCLOCK;
+  if(ok) {
+    ++mHits;
+  } else {
+    ++mMisses;
+    std::map<std::string, std::list<Entry>::iterator>::iterator iit=mIndex.find(rKey);
+    if(iit!=mIndex.end()) {
+      mEntries.erase(iit->second);
+      mIndex.erase(iit);
+    }
+  }
+  FD_DRTI("ResultCache::Lookup(" << rKey << "): " << (ok ? "hit" : "miss"));
+  return ok;
+}
+
+// look up function call
+bool ResultCache::Lookup(const std::string& rKey, Function& rFunction) {
+  std::vector<Type*> results;
+  for(int i=0; i<rFunction.ParamsSize(); ++i)
+    if(rFunction.Variant()->At(i).Attribute()!=Parameter::In)
+      results.push_back(rFunction.ParamValue(i));
+  return Lookup(rKey,results);
+}
+
+// insert
+void ResultCache::Insert(const std::string& rKey, const std::vector<const Type*>& rResults) {
+  // token representation
+  TokenWriter tw(TokenWriter::String);
+  Token btag;
+  btag.SetBegin("ResultCache");
+  btag.InsAttributeString("key",rKey);
+  btag.InsAttributeInteger("results",rResults.size());
+  tw.Write(btag);
+  for(std::size_t i=0; i<rResults.size(); ++i)
+    rResults[i]->Write(tw);
+  tw.WriteEnd("ResultCache");
+  std::string text=tw.Str();
+  // record
+  FD_RCLOCK;
+  DoRecord(rKey,text);
+  if(mDirectory=="") return;
+  // write to store, rename for atomic update (failure to write is not an error)
+  std::string fname=DoFileName(rKey);
+  std::string tname=fname + ".tmp";
+  {
+    std::ofstream fout(tname.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!fout.good()) return;
+    fout << text;
+    if(!fout.good()) return;
+  }
+  if(std::rename(tname.c_str(),fname.c_str())!=0) FileDelete(tname);
+}
+
+// insert function call
+void ResultCache::Insert(const std::string& rKey, const Function& rFunction) {
+  std::vector<const Type*> results;
+  for(int i=0; i<rFunction.ParamsSize(); ++i)
+    if(rFunction.Variant()->At(i).Attribute()!=Parameter::In)
+      results.push_back(rFunction.ParamValue(i));
+  Insert(rKey,results);
+}
+
+// find entry
+bool ResultCache::DoFind(const std::string& rKey, std::string& rText) {
+  // in memory: move to front
+  std::map<std::string, std::list<Entry>::iterator>::iterator iit=mIndex.find(rKey);
+  if(iit!=mIndex.end()) {
+    mEntries.splice(mEntries.begin(),mEntries,iit->second);
+    rText=iit->second->second;
+    return true;
+  }
+  // on disk: load to memory
+  if(mDirectory=="") return false;
+  std::ifstream fin(DoFileName(rKey).c_str(), std::ios::in | std::ios::binary);
+  if(!fin.good()) return false;
+  std::ostringstream sstr;
+  sstr << fin.rdbuf();
+  if(fin.bad()) return false;
+  rText=sstr.str();
+  DoRecord(rKey,rText);
+  return true;
+}
+
+// record entry
+void ResultCache::DoRecord(const std::string& rKey, const std::string& rText) {
+  std::map<std::string, std::list<Entry>::iterator>::iterator iit=mIndex.find(rKey);
+  if(iit!=mIndex.end()) {
+    iit->second->second=rText;
+    mEntries.splice(mEntries.begin(),mEntries,iit->second);
+    return;
+  }
+  mEntries.push_front(Entry(rKey,rText));
+  mIndex[rKey]=mEntries.begin();
+  DoShrink();
+}
+
+// drop least recently used entries
+void ResultCache::DoShrink(void) {
+  while(mEntries.size()>mCapacity) {
+    mIndex.erase(mEntries.back().first);
+    mEntries.pop_back();
+  }
+}
+
+// store file name
+std::string ResultCache::DoFileName(const std::string& rKey) const {
+  return PrependPath(mDirectory, rKey + ".rcache");
+}
+
+
+} // namespace faudes
@@ -0,0 +1,290 @@
+/** @file cfl_resultcache.h @brief Result cache for run-time interface functions */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+
+#ifndef FAUDES_RESULTCACHE_H
+#define FAUDES_RESULTCACHE_H
+
+#include "cfl_definitions.h"
+#include "cfl_platform.h"
+#include "cfl_types.h"
+#include "cfl_functions.h"
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+
+namespace faudes {
+
+/**
+ * Result cache for expensive operations.
+ *
+ * The ResultCache memoizes the results of operations on faudes objects. Entries are
+ * addressed by a key that is computed from the operation name and two structural hashes
+ * of the arguments. For generators, the hash is taken over the alphabet, the state set, the
+ * initial and marked states and the transition relation, incl. attributes and names.
+ * It is independent of the order in which elements are stored, and it refers to events by
+ * name rather than by index. Thus, keys are reproducible across runs and can be used to
+ * look up results from an on-disk store.
+ *
+ * Results are kept in their token representation, in memory within a
+ * least-recently-used list of bounded capacity and, optionally, as files within a store
+ * directory. A lookup first consults the memory and then the store directory.
+ *
+ * The cache is disabled by default. When enabled, it is installed by Function::Cache(),
+ * and Function::Execute() consults the cache for all functions that have been declared
+ * cacheable, which by default are Deterministic, StateMin, Project and Parallel. C++
+ * applications may use the cache directly:
+ * @code
+ * ResultCache::G()->Enabled(true);
+ * std::string key=ResultCache::Key("Deterministic",{&gen});
+ * if(!ResultCache::G()->Lookup(key,{&res})) {
+ *   Deterministic(gen,res);
+ *   ResultCache::G()->Insert(key,{&res});
+ * }
+ * @endcode
+ *
+ * Technical note: a key consists of two 64-bit hashes of the arguments with independent
+ * constants and of the total size of the arguments, i.e., the number of events, states
+ * and transitions of generators, and the number of elements of sets. Each entry records
+ * its full key, which is verified before results are returned. Thus, a false hit
+ * requires a collision of both hashes on arguments of the same size. The cache must be
+ * configured before any threads are started; lookup and insertion are thread-safe.
+ *
+ * @ingroup RunTimeInterface
+ */
+class FAUDES_API ResultCache : public FunctionCache {
+public:
+
+  /** Access singleton */
+  static ResultCache* G(void);
+
+  /**
+   * Enable or disable the cache.
+   *
+   * Enabling installs the cache for Function::Execute().
+   *
+   * @param on
+   *   True to enable
+   */
+  void Enabled(bool on);
+
+  /** Test whether the cache is enabled */
+  bool Enabled(void) const;
+
+  /**
+   * Set capacity of in-memory cache.
+   *
+   * When the capacity is exceeded, the least recently used entries are dropped.
+   *
+   * @param entries
+   *   Maximum number of entries, defaults to 256
+   */
+  void Capacity(Idx entries);
+
+  /** Get capacity of in-memory cache */
+  Idx Capacity(void) const;
+
+  /**
+   * Set store directory.
+   *
+   * Results are written to and looked up from files in the specified
+   * directory. The directory must exist. Set an empty string to disable the store.
+   *
+   * @param rDirectory
+   *   Path of store directory
+   * @exception Exception
+   *   - no such directory (id 2)
+   */
+  void Directory(const std::string& rDirectory);
+
+  /** Get store directory */
+  std::string Directory(void) const;
+
+  /**
+   * Declare a registered function as cacheable.
+   *
+   * Only functions without side effects should be declared cacheable, i.e.,
+   * the result must be determined by the values of the In and InOut parameters.
+   *
+   * @param rFunction
+   *   Function name as registered in the FunctionRegistry
+   * @param on
+   *   True to declare cacheable, false to exclude from cache
+   */
+  void Cacheable(const std::string& rFunction, bool on=true);
+
+  /** Test whether function is cacheable */
+  bool Cacheable(const std::string& rFunction) const;
+
+  /** Clear in-memory cache and statistics (the store directory is not affected) */
+  void Clear(void);
+
+  /** Number of entries in in-memory cache */
+  Idx Size(void) const;
+
+  /** Statistics: number of successful lookups */
+  Idx Hits(void) const;
+
+  /** Statistics: number of failed lookups */
+  Idx Misses(void) const;
+
+  /**
+   * Structural hash of a faudes object.
+   *
+   * Generators, symbolic sets and vectors are hashed structurally; other
+   * types are hashed by their token representation. This is the first of the
+   * two hashes that make up a key.
+   *
+   * @param rObject
+   *   Faudes object
+   * @return
+   *   Hash value
+   */
+  static uint64_t Hash(const Type& rObject);
+
+  /**
+   * Compute key for an operation.
+   *
+   * The key is a string of 32 hex digits for the two hashes, followed by a dash
+   * and the total size of the arguments in decimal.
+   *
+   * @param rOperation
+   *   Name of operation, incl. any parameters that are not passed as faudes objects
+   * @param rArgs
+   *   Arguments
+   * @return
+   *   Key
+   */
+  static std::string Key(const std::string& rOperation, const std::vector<const Type*>& rArgs);
+
+  /**
+   * Compute key for a function call.
+   *
+   * The key refers to the function name, the variant, the faudes types of all parameters
+   * and the values of the In and InOut parameters.
+   *
+   * @param rFunction
+   *   Function with variant and parameter values set
+   * @return
+   *   Key, or empty string if the cache is disabled or the function is not cacheable
+   */
+  virtual std::string Key(const Function& rFunction) const;
+
+  /**
+   * Look up results.
+   *
+   * @param rKey
+   *   Key of operation
+   * @param rResults
+   *   Objects to read the results to
+   * @return
+   *   True if results were found
+   */
+  bool Lookup(const std::string& rKey, const std::vector<Type*>& rResults);
+
+  /**
+   * Look up results of function call.
+   *
+   * On success, the values of the Out and InOut parameters are set.
+   *
+   * @param rKey
+   *   Key of function call
+   * @param rFunction
+   *   Function to set parameter values
+   * @return
+   *   True if results were found
+   */
+  virtual bool Lookup(const std::string& rKey, Function& rFunction);
+
+  /**
+   * Insert results.
+   *
+   * @param rKey
+   *   Key of operation
+   * @param rResults
+   *   Results to record
+   */
+  void Insert(const std::string& rKey, const std::vector<const Type*>& rResults);
+
+  /**
+   * Insert results of function call.
+   *
+   * @param rKey
+   *   Key of function call
+   * @param rFunction
+   *   Function to record the values of Out and InOut parameters from
+   */
+  virtual void Insert(const std::string& rKey, const Function& rFunction);
+
+protected:
+
+  /** Construct singleton */
+  ResultCache(void);
+
+  /** Entry of in-memory cache */
+  typedef std::pair<std::string,std::string> Entry;
+
+  /** Find entry in memory or store (no locking) */
+  bool DoFind(const std::string& rKey, std::string& rText);
+
+  /** Record entry in memory (no locking) */
+  void DoRecord(const std::string& rKey, const std::string& rText);
+
+  /** Drop entries beyond capacity (no locking) */
+  void DoShrink(void);
+
+  /** File name in store directory */
+  std::string DoFileName(const std::string& rKey) const;
+
+  /** Configuration */
+  bool mEnabled;
+  Idx mCapacity;
+  std::string mDirectory;
+  std::set<std::string> mCacheable;
+
+  /** In-memory cache: entries in order of recent use */
+  std::list<Entry> mEntries;
+
+  /** In-memory cache: entries by key */
+  std::map<std::string, std::list<Entry>::iterator> mIndex;
+
+  /** Statistics */
+  Idx mHits;
+  Idx mMisses;
+
+#ifdef FAUDES_THREADS
+  /** Lock for entries and statistics */
+  mutable faudes_mutex_t mMutex;
+#endif
+
+private:
+
+  /** Not copyable */
+  ResultCache(const ResultCache&);
+  ResultCache& operator=(const ResultCache&);
+};
+
+
+} // namespace faudes
+
+#endif
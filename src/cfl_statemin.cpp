@@ -26,6 +26,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 #include "cfl_project.h"
 
 #include <stack>
+#include <algorithm>
 
 namespace faudes {
 
@@ -374,6 +375,288 @@ public:
 
 
 
+/*
+*********************************************************
+Part 1b: Hopcroft algorithm on flat arrays
+- construct with generator to minimize
+- invoke Minimize() to run Hopcroft iteration, optionally
+  with a time budget
+- invoke Apply() to turn the generator into its quotient
+  in-place
+
+Predecessors are held in CSR form (offsets by target state),
+blocks are maintained as a refinable partition over a single
+element array. Splitters are whole blocks; when a block splits
+and is not queued, only the smaller half is queued. Since the
+input is deterministic, splitting by the larger half is then
+implied.
+*********************************************************
+*/
+
+class HopcroftFlat {
+
+public:
+
+  /**
+   * Initialize from specified generator
+   */
+  HopcroftFlat(const Generator& rGen) : gen(&rGen), complete(false) {
+
+    // ensure generator is deterministic
+#ifdef FAUDES_CHECKED
+    if(!rGen.IsDeterministic()) 
+     throw Exception("StateMin", "input automaton non-deterministic", 101);
+#endif
+
+    // accessible states, internal index by position
+    StateSet acc = gen->AccessibleSet();
+    states.reserve(acc.Size());
+    StateSet::Iterator sit=acc.Begin();
+    for(; sit != acc.End(); ++sit) states.push_back(*sit);
+    Idx n=states.size();
+
+    // incoming transitions in CSR form
+    prebeg.assign(n+1,0);
+    std::vector<Idx> x2s;
+    std::vector<Idx> x1s;
+    std::vector<Idx> evs;
+    std::vector<Idx>::iterator xit=states.begin();
+    TransSet::Iterator tit=gen->TransRelBegin();
+    for(; tit != gen->TransRelEnd(); ++tit) {
+      // walk sorted states along sorted X1
+      while(xit!=states.end() && *xit < tit->X1) ++xit;
+      if(xit==states.end()) break;
+      if(*xit != tit->X1) continue;
+      Idx x2=Code(tit->X2);
+      if(x2==n) continue;
+      x1s.push_back(xit-states.begin());
+      x2s.push_back(x2);
+      evs.push_back(tit->Ev);
+      ++prebeg[x2+1];
+    }
+    for(Idx q=0; q<n; ++q) prebeg[q+1]+=prebeg[q];
+    presrc.resize(x1s.size());
+    preev.resize(x1s.size());
+    std::vector<Idx> fill(prebeg.begin(),prebeg.end()-1);
+    for(Idx t=0; t<x1s.size(); ++t) {
+      Idx pos=fill[x2s[t]]++;
+      presrc[pos]=x1s[t];
+      preev[pos]=evs[t];
+    }
+
+    FD_DF("HopcroftFlat::Initialize(): states #" << n << " transitions #" << presrc.size());
+  }
+
+  /**
+   * Hopcroft iteration (invoke this only once)
+   *
+   * @param msecs
+   *   time budget in milliseconds, 0 for no limit
+   * @return
+   *   true if the iteration completed within the budget
+   */
+  bool Minimize(Idx msecs) {
+
+    // initial partition Xm and X-Xm, resp. (prevent empty blocks)
+    Idx n=states.size();
+    elems.resize(n);
+    loc.resize(n);
+    blk.resize(n);
+    Idx pos=0;
+    for(int pass=0; pass<2; ++pass) {
+      Idx start=pos;
+      for(Idx q=0; q<n; ++q) {
+        if(gen->ExistsMarkedState(states[q]) != (pass==0)) continue;
+        elems[pos]=q;
+        loc[q]=pos;
+        blk[q]=first.size();
+        ++pos;
+      }
+      if(pos==start) continue;
+      first.push_back(start);
+      mid.push_back(start);
+      end.push_back(pos);
+      queued.push_back(true);
+      active.push_back(first.size()-1);
+    }
+
+#ifdef FAUDES_SYSTIME
+    faudes_systime_t start;
+    faudes_gettimeofday(&start);
+#endif
+
+    // loop variables
+    std::vector< std::pair<Idx,Idx> > evsrc; // predecessors of splitter (event, source)
+    std::vector<Idx> touched;                // blocks with marked elements
+    Idx count=0;
+
+    // while there is an active block
+    while(!active.empty()) {
+      FD_WPC(first.size()-active.size(), first.size(), "StateMin: blocks/active:   " << first.size() << " / " << active.size());
+
+      // test budget
+#ifdef FAUDES_SYSTIME
+      if(msecs>0 && ((++count) % 256 == 0)) {
+        faudes_systime_t now;
+        faudes_mstime_t lap;
+        faudes_gettimeofday(&now);
+        faudes_diffsystime(now,start,&lap);
+        if(lap > (faudes_mstime_t) msecs) {
+          FD_DF("HopcroftFlat::Minimize(): time budget exceeded at blocks #" << first.size());
+          return false;
+        }
+      }
+#else
+      (void) msecs;
+      (void) count;
+#endif
+
+      // pick splitter and record its predecessors (splitter may be split itself)
+      Idx b=active.back();
+      active.pop_back();
+      queued[b]=false;
+      evsrc.clear();
+      for(Idx i=first[b]; i<end[b]; ++i) {
+        Idx q=elems[i];
+        for(Idx t=prebeg[q]; t<prebeg[q+1]; ++t)
+          evsrc.push_back(std::make_pair(preev[t],presrc[t]));
+      }
+      std::sort(evsrc.begin(),evsrc.end());
+
+      // split per event
+      std::vector< std::pair<Idx,Idx> >::iterator eit=evsrc.begin();
+      while(eit!=evsrc.end()) {
+        Idx ev=eit->first;
+        // mark predecessors
+        for(; eit!=evsrc.end() && eit->first==ev; ++eit) {
+          Idx q=eit->second;
+          Idx d=blk[q];
+          if(loc[q] < mid[d]) continue;
+          if(mid[d]==first[d]) touched.push_back(d);
+          Idx p=elems[mid[d]];
+          elems[loc[q]]=p;
+          loc[p]=loc[q];
+          elems[mid[d]]=q;
+          loc[q]=mid[d];
+          ++mid[d];
+        }
+        // split touched blocks, marked part becomes the new block
+        std::vector<Idx>::iterator dit=touched.begin();
+        for(; dit!=touched.end(); ++dit) {
+          Idx d=*dit;
+          if(mid[d]==end[d]) { mid[d]=first[d]; continue; }
+          Idx nd=first.size();
+          first.push_back(first[d]);
+          mid.push_back(first[d]);
+          end.push_back(mid[d]);
+          queued.push_back(false);
+          for(Idx i=first[d]; i<mid[d]; ++i) blk[elems[i]]=nd;
+          first[d]=mid[d];
+          // queue new block if d was queued, else queue the smaller half
+          Idx sel=nd;
+          if(!queued[d] && (end[nd]-first[nd] > end[d]-first[d])) sel=d;
+          queued[sel]=true;
+          active.push_back(sel);
+        }
+        touched.clear();
+      }
+    } // while active blocks exist
+
+    complete=true;
+    return true;
+  }
+
+  /**
+   * Turn generator into quotient, in-place
+   * By convention, each block is represented by its least original state index. If the
+   * iteration did not complete, the generator is only restricted to accessible states.
+   */
+  void Apply(Generator& rGen) {
+
+    FD_DF("HopcroftFlat::Apply(): blocks #" << first.size() << " complete " << complete);
+
+    // representatives per internal state
+    Idx n=states.size();
+    std::vector<Idx> rep(n);
+    for(Idx q=0; q<n; ++q) rep[q]=states[q];
+    if(complete) {
+      for(Idx b=0; b<first.size(); ++b) {
+        Idx r=states[elems[first[b]]];
+        for(Idx i=first[b]; i<end[b]; ++i) 
+          if(states[elems[i]]<r) r=states[elems[i]];
+        for(Idx i=first[b]; i<end[b]; ++i) rep[elems[i]]=r;
+      }
+    }
+
+    // quotient states
+    StateSet reps;
+    StateSet inits;
+    for(Idx q=0; q<n; ++q) {
+      if(rep[q]==states[q]) reps.Insert(states[q]);
+      if(gen->ExistsInitState(states[q])) inits.Insert(rep[q]);
+    }
+
+    // quotient transitions, i.e., redirect transitions of representatives
+    TransSet trans;
+    std::vector<Idx>::iterator xit=states.begin();
+    TransSet::Iterator tit=gen->TransRelBegin();
+    for(; tit != gen->TransRelEnd(); ++tit) {
+      while(xit!=states.end() && *xit < tit->X1) ++xit;
+      if(xit==states.end()) break;
+      if(*xit != tit->X1) continue;
+      if(rep[xit-states.begin()] != tit->X1) continue;
+      Idx x2=Code(tit->X2);
+      if(x2==n) continue;
+      trans.Insert(tit->X1,tit->Ev,rep[x2]);
+    }
+
+    // install
+    rGen.InjectTransRel(trans);
+    rGen.RestrictStates(reps);
+    rGen.InjectInitStates(inits);
+    rGen.Name(rGen.Name()+" [minstate]");
+  }
+
+private:
+
+  /** internal index by original index (size of states if not found) */
+  Idx Code(Idx idx) const {
+    std::vector<Idx>::const_iterator it=std::lower_bound(states.begin(),states.end(),idx);
+    if(it==states.end()) return states.size();
+    if(*it!=idx) return states.size();
+    return it-states.begin();
+  }
+
+  /** keep reference to argument */
+  const Generator* gen;
+
+  /** original state indices, sorted */
+  std::vector<Idx> states;
+
+  /** incoming transitions in CSR form */
+  std::vector<Idx> prebeg;
+  std::vector<Idx> presrc;
+  std::vector<Idx> preev;
+
+  /** refinable partition: elements and their location and block, block ranges with marks */
+  std::vector<Idx> elems;
+  std::vector<Idx> loc;
+  std::vector<Idx> blk;
+  std::vector<Idx> first;
+  std::vector<Idx> mid;
+  std::vector<Idx> end;
+
+  /** splitter queue */
+  std::vector<Idx> active;
+  std::vector<bool> queued;
+
+  /** iteration completed */
+  bool complete;
+
+}; // end class HopcroftFlat
+
+
+
 /*
 *********************************************************
 Part 2: Original 2006 code basis for reference.
@@ -637,6 +920,19 @@ void StateMin(const Generator& rGen, Generator& rResGen,
   hc.Partition(rResGen);
 } 
 
+// StateMin(rGen)
+void StateMin(Generator& rGen) {
+  StateMin(rGen,0);
+}
+
+// StateMin(rGen, msecs)
+bool StateMin(Generator& rGen, Idx msecs) {
+  HopcroftFlat hc(rGen);
+  bool res=hc.Minimize(msecs);
+  hc.Apply(rGen);
+  return res;
+}
+
 // StateMin(rGen, rResGen)
 void aStateMin(const Generator& rGen, Generator& rResGen) {
   StateMin(rGen, rResGen);
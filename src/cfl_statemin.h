@@ -95,6 +95,47 @@ extern FAUDES_API void aStateMin(const Generator& rGen, Generator& rResGen);
  */
 extern FAUDES_API void aStateMin(Generator& rGen);
 
+/**
+ * State set minimization, in-place.
+ *
+ * See also StateMin(const Generator&, Generator&).
+ * This version avoids the copy to a result generator and is meant for 
+ * repeated minimization of intermediate results. It uses a variant of the
+ * Hopcroft algorithm on flat arrays. Each equivalence class is represented by its least
+ * original state, i.e., index, name and attribute of the representative are maintained,
+ * all other states are removed. The generator is made accessible.
+ *
+ * @param rGen
+ *   Generator to minimize
+ *
+ * @exception Exception
+ *   Input automaton nondeterministic (id 101)
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API void StateMin(Generator& rGen);
+
+/**
+ * State set minimization, in-place with time budget.
+ *
+ * See also StateMin(Generator&). If the partition refinement does not complete 
+ * within the specified time budget, it is abandoned and the generator is only made 
+ * accessible. The budget is ignored if libFAUDES is configured without system time. 
+ *
+ * @param rGen
+ *   Generator to minimize
+ * @param msecs
+ *   Time budget in milliseconds, 0 for no limit
+ * @return
+ *   True if the generator has been minimized
+ *
+ * @exception Exception
+ *   Input automaton nondeterministic (id 101)
+ *
+ * @ingroup GeneratorFunctions
+ */
+extern FAUDES_API bool StateMin(Generator& rGen, Idx msecs);
+
 /**
  * State set minimization.
  * This function implements the (n*log n) set partitioning algorithm by
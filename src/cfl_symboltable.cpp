@@ -27,25 +27,107 @@
 namespace faudes {
 
 
+// scoped locks, no-ops without threads or for tables without locking
+namespace {
+
+#ifdef FAUDES_THREADS
+class ReadLock {
+public:
+  explicit ReadLock(faudes_rwlock_t* pLock) : mpLock(pLock) { if(mpLock) faudes_rwlock_rdlock(mpLock); }
+  ~ReadLock(void) { if(mpLock) faudes_rwlock_rdunlock(mpLock); }
+private:
+  faudes_rwlock_t* mpLock;
+};
+class WriteLock {
+public:
+  explicit WriteLock(faudes_rwlock_t* pLock) : mpLock(pLock) { if(mpLock) faudes_rwlock_wrlock(mpLock); }
+  ~WriteLock(void) { if(mpLock) faudes_rwlock_wrunlock(mpLock); }
+private:
+  faudes_rwlock_t* mpLock;
+};
+#define FD_SYMREAD ReadLock _symlock(mLocking ? &mLock : 0)
+#define FD_SYMWRITE WriteLock _symlock(mLocking ? &mLock : 0)
+#else
+#define FD_SYMREAD
+#define FD_SYMWRITE
+#endif
+
+// indices beyond this bound relative to the number of entries go to the sparse map
+inline bool DenseIndex(Idx index, Idx size) {
+  return index < 2*size + 1024;
+}
+
+}
+
+
 // constructor
 SymbolTable:: SymbolTable(void) :
   mMyName("SymbolTable"),
+  mpData(new Data()),
   mMaxIndex(std::numeric_limits<Idx>::max()), 
-  mNextIndex(1) {
+  mNextIndex(1),
+  mLocking(false) {
+#ifdef FAUDES_THREADS
+  faudes_rwlock_init(&mLock);
+#endif
+}
+
+// constructor (with locking)
+SymbolTable:: SymbolTable(bool locking) :
+  mMyName("SymbolTable"),
+  mpData(new Data()),
+  mMaxIndex(std::numeric_limits<Idx>::max()), 
+  mNextIndex(1),
+  mLocking(locking) {
+#ifdef FAUDES_THREADS
+  faudes_rwlock_init(&mLock);
+#endif
 }
 
 // constructor
-SymbolTable:: SymbolTable(const SymbolTable& rSrc) {
+SymbolTable:: SymbolTable(const SymbolTable& rSrc) :
+  mpData(new Data()),
+  mLocking(false)
+{
+#ifdef FAUDES_THREADS
+  faudes_rwlock_init(&mLock);
+#endif
   DoAssign(rSrc);
 }
 
+// destructor
+SymbolTable::~SymbolTable(void) {
+#ifdef FAUDES_THREADS
+  faudes_rwlock_destroy(&mLock);
+#endif
+}
+
 // asignment
 void SymbolTable::DoAssign(const SymbolTable& rSrc) {
-  mMyName=rSrc.mMyName;
-  mIndexMap=rSrc.mIndexMap;
-  mNameMap=rSrc.mNameMap;
-  mMaxIndex=rSrc.mMaxIndex;
-  mNextIndex=rSrc.mNextIndex;
+  if(&rSrc==this) return;
+  // share source entries, read under its lock
+  std::shared_ptr<Data> data;
+  Idx maxindex, nextindex;
+  {
+#ifdef FAUDES_THREADS
+    ReadLock _srclock(rSrc.mLocking ? &rSrc.mLock : 0);
+#endif
+    mMyName=rSrc.mMyName;
+    data=rSrc.mpData;
+    maxindex=rSrc.mMaxIndex;
+    nextindex=rSrc.mNextIndex;
+  }
+  // install under my write lock
+  FD_SYMWRITE;
+  mpData=data;
+  mMaxIndex=maxindex;
+  mNextIndex=nextindex;
+}
+
+// DoDetach()
+void SymbolTable::DoDetach(void) {
+  // the count cannot increase concurrently, since copies are taken under my lock
+  if(mpData.use_count()>1) mpData.reset(new Data(*mpData));
 }
 
 
@@ -61,25 +143,33 @@ void SymbolTable::Name(const std::string& rName) {
 
 // Clear()
 void SymbolTable::Clear(void) {   
+  FD_SYMWRITE;
+  DoClear();
+}
+
+// DoClear()
+void SymbolTable::DoClear(void) {   
   mMaxIndex=std::numeric_limits<Idx>::max();
   mNextIndex=1;
-  mIndexMap.clear();
-  mNameMap.clear();
+  mpData.reset(new Data());
 }
 
 // Size()
 Idx SymbolTable::Size(void) const {   
-  return mIndexMap.size();
+  FD_SYMREAD;
+  return mpData->mSize;
 }
 
 // MaxIndex()
 Idx SymbolTable::MaxIndex(void) const {
+  FD_SYMREAD;
   return mMaxIndex;
 }
 		
 // MaxIndex(index)
 void SymbolTable::MaxIndex(Idx index) {
   if(index <= std::numeric_limits<Idx>::max()) {
+    FD_SYMWRITE;
     mMaxIndex = index;
     return;
   }
@@ -90,6 +180,7 @@ void SymbolTable::MaxIndex(Idx index) {
 		
 // LastIndex()
 Idx SymbolTable::LastIndex(void) const {
+  FD_SYMREAD;
   return mNextIndex - 1;
 }
 		
@@ -110,9 +201,124 @@ bool SymbolTable::ValidSymbol(const std::string& rName)  {
   return true;
 }
 
+// HashValue(rName), FNV-1a
+Idx SymbolTable::HashValue(const std::string& rName) {
+  uint32_t h=2166136261u;
+  for(std::size_t cp=0;cp<rName.size();cp++) {
+    h ^= (unsigned char) rName[cp];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+// DoFindName(rName)
+long int SymbolTable::DoFindName(const std::string& rName) const {
+  if(mpData->mHash.empty()) return -1;
+  std::size_t mask=mpData->mHash.size()-1;
+  std::size_t slot=HashValue(rName) & mask;
+  while(true) {
+    Idx val=mpData->mHash[slot];
+    if(val==0) return -1;
+    if(val!=std::numeric_limits<Idx>::max())
+    if(mpData->mNames[val-1]==rName) return (long int) val-1;
+    slot=(slot+1) & mask;
+  }
+}
+
+// DoFindIndex(index)
+long int SymbolTable::DoFindIndex(Idx index) const {
+  if(index<mpData->mDense.size()) {
+    Idx val=mpData->mDense[index];
+    if(val!=0) return (long int) val-1;
+  }
+  if(mpData->mSparse.empty()) return -1;
+  std::map<Idx,Idx>::const_iterator it=mpData->mSparse.find(index);
+  if(it==mpData->mSparse.end()) return -1;
+  return (long int) it->second;
+}
+
+// DoRehash(slots)
+void SymbolTable::DoRehash(std::size_t slots) {
+  mpData->mHash.assign(slots,0);
+  mpData->mHashDeleted=0;
+  std::size_t mask=slots-1;
+  for(std::size_t e=0; e<mpData->mIndices.size(); ++e) {
+    if(mpData->mNames[e].empty()) continue;
+    std::size_t slot=HashValue(mpData->mNames[e]) & mask;
+    while(mpData->mHash[slot]!=0) slot=(slot+1) & mask;
+    mpData->mHash[slot]=e+1;
+  }
+}
+
+// DoInsert(index,rName)
+void SymbolTable::DoInsert(Idx index, const std::string& rName) {
+  DoDetach();
+  // allocate entry
+  Idx entry;
+  if(!mpData->mFreeEntries.empty()) {
+    entry=mpData->mFreeEntries.back();
+    mpData->mFreeEntries.pop_back();
+    mpData->mNames[entry]=rName;
+    mpData->mIndices[entry]=index;
+  } else {
+    entry=mpData->mNames.size();
+    mpData->mNames.push_back(rName);
+    mpData->mIndices.push_back(index);
+  }
+  ++mpData->mSize;
+  // hash index: keep load incl. deleted slots below 1/2
+  if(2*(mpData->mSize+mpData->mHashDeleted) > mpData->mHash.size()) {
+    std::size_t slots=16;
+    while(slots < 4*mpData->mSize) slots*=2;
+    DoRehash(slots);
+  } else {
+    std::size_t mask=mpData->mHash.size()-1;
+    std::size_t slot=HashValue(rName) & mask;
+    while(mpData->mHash[slot]!=0 && mpData->mHash[slot]!=std::numeric_limits<Idx>::max()) 
+      slot=(slot+1) & mask;
+    if(mpData->mHash[slot]!=0) --mpData->mHashDeleted;
+    mpData->mHash[slot]=entry+1;
+  }
+  // index lookup
+  if(index<mpData->mDense.size()) {
+    mpData->mDense[index]=entry+1;
+  } else if(DenseIndex(index,mpData->mSize)) {
+    mpData->mDense.resize(index+1+index/2,0);
+    mpData->mDense[index]=entry+1;
+  } else {
+    mpData->mSparse[index]=entry;
+  }
+}
+
+// DoErase(entry)
+void SymbolTable::DoErase(Idx entry) {
+  DoDetach();
+  // hash index
+  std::size_t mask=mpData->mHash.size()-1;
+  std::size_t slot=HashValue(mpData->mNames[entry]) & mask;
+  while(mpData->mHash[slot]!=entry+1) slot=(slot+1) & mask;
+  mpData->mHash[slot]=std::numeric_limits<Idx>::max();
+  ++mpData->mHashDeleted;
+  // index lookup
+  Idx index=mpData->mIndices[entry];
+  if(index<mpData->mDense.size() && mpData->mDense[index]==entry+1) mpData->mDense[index]=0;
+  else mpData->mSparse.erase(index);
+  // release entry
+  mpData->mNames[entry].clear();
+  mpData->mIndices[entry]=0;
+  mpData->mFreeEntries.push_back(entry);
+  --mpData->mSize;
+}
+
 // UniqueSymbol(rName)
 std::string SymbolTable::UniqueSymbol(const std::string& rName) const {
-  if(!Exists(rName)) return (rName);
+  FD_SYMREAD;
+  return DoUniqueSymbol(rName);
+}
+
+// DoUniqueSymbol(rName)
+std::string SymbolTable::DoUniqueSymbol(const std::string& rName) const {
+  if(DoFindName(rName)<0) return (rName);
   long int count=0;
   std::string name=rName;
   std::string bname=rName;
@@ -129,26 +335,32 @@ std::string SymbolTable::UniqueSymbol(const std::string& rName) const {
   do {
     count++;
     name=bname + "_" + ToStringInteger(count);
-  } while(Exists(name));
+  } while(DoFindName(name)>=0);
   return name;
 }
 
 
 // InsEntry(index, rName)
 Idx SymbolTable::InsEntry(Idx index, const std::string& rName) {
+  FD_SYMWRITE;
+  return DoInsEntry(index,rName);
+}
+
+// DoInsEntry(index, rName)
+Idx SymbolTable::DoInsEntry(Idx index, const std::string& rName) {
   if( ! (index <= mMaxIndex)) {
     std::stringstream errstr;
     errstr << "symboltable overflow in \"" << mMyName << "\"";
     throw Exception("SymbolTable::InsEntry(index,name))", errstr.str(), 40);
   }
-  Idx nidx=Index(rName);
-  if((nidx!=0) && (nidx!=index)) {
+  long int nentry=DoFindName(rName);
+  if((nentry>=0) && (mpData->mIndices[nentry]!=index)) {
     std::stringstream errstr;
     errstr << "Name " << rName << " allready exists in \"" << mMyName << "\"";
     throw Exception("SymbolTable::InsEntry(index,name)", errstr.str(), 41);
   }
-  std::string idxname=Symbol(index);
-  if((idxname != "") && (idxname != rName)) {
+  long int ientry=DoFindIndex(index);
+  if((ientry>=0) && (mpData->mNames[ientry] != rName)) {
     std::stringstream errstr;
     errstr << "Index " << index << " allready exists in \"" << mMyName << "\"";
     throw Exception("SymbolTable::InsEntry(index,name)", errstr.str(), 42);
@@ -159,8 +371,7 @@ Idx SymbolTable::InsEntry(Idx index, const std::string& rName) {
     throw Exception("SymbolTable::InsEntry(index,name)", errstr.str(), 43);
   }
 
-  mIndexMap[rName] = index;
-  mNameMap[index] = rName;
+  if(ientry<0) DoInsert(index,rName);
 
   if(mNextIndex<=index) mNextIndex=index+1; 
   return index;
@@ -168,9 +379,17 @@ Idx SymbolTable::InsEntry(Idx index, const std::string& rName) {
 
 // InsEntry(rName)
 Idx SymbolTable::InsEntry(const std::string& rName) {
-  Idx index=Index(rName);
-  if( index != 0) return index;
-  return InsEntry(mNextIndex,rName);
+  // fast path: lookup only
+  {
+    FD_SYMREAD;
+    long int entry=DoFindName(rName);
+    if(entry>=0) return mpData->mIndices[entry];
+  }
+  // lookup again and insert
+  FD_SYMWRITE;
+  long int entry=DoFindName(rName);
+  if(entry>=0) return mpData->mIndices[entry];
+  return DoInsEntry(mNextIndex,rName);
 }
 
 
@@ -180,8 +399,9 @@ void SymbolTable::SetEntry(Idx index, const std::string& rName) {
     ClrEntry(index);
     return;
   }
-  Idx nidx=Index(rName);
-  if((nidx!=0) && (nidx!=index)) {
+  FD_SYMWRITE;
+  long int nentry=DoFindName(rName);
+  if((nentry>=0) && (mpData->mIndices[nentry]!=index)) {
     std::stringstream errstr;
     errstr << "Name " << rName << " allready exists in \"" << mMyName << "\"";
     throw Exception("SymbolTable::SetEntry(index,name)", errstr.str(), 41);
@@ -191,91 +411,90 @@ void SymbolTable::SetEntry(Idx index, const std::string& rName) {
     errstr << "Name " << rName << " is not a valid symbol";
     throw Exception("SymbolTable::SetEntry(index,name)", errstr.str(), 43);
   }
-  // remove old entry from reverse map
-  std::map<Idx,std::string>::iterator nit = mNameMap.find(index);
-  if(nit != mNameMap.end()) mIndexMap.erase(nit->second);
-  // insert new name/index to maps
-  mIndexMap[rName] = index;
-  mNameMap[index] = rName;
+  // same entry
+  if(nentry>=0) return;
+  // remove old entry
+  long int ientry=DoFindIndex(index);
+  if(ientry>=0) DoErase(ientry);
+  // insert new name/index 
+  DoInsert(index,rName);
 }
 
 // SetDefaultSymbol(index)
 void SymbolTable::SetDefaultSymbol(Idx index) {
-  ClrEntry(index); 
+  FD_SYMWRITE;
+  long int ientry=DoFindIndex(index);
+  if(ientry>=0) DoErase(ientry);
   std::string dname;
-  dname = UniqueSymbol(ToStringInteger(index));
-  InsEntry(index,dname);
+  dname = DoUniqueSymbol(ToStringInteger(index));
+  DoInsEntry(index,dname);
 }
 
 
 // ClrEntry(index)
 void SymbolTable::ClrEntry(Idx index) {
-  std::map<Idx,std::string>::iterator it = mNameMap.find(index);
-  if (it == mNameMap.end()) return;
-  mIndexMap.erase(it->second);
-  mNameMap.erase(it);
+  FD_SYMWRITE;
+  long int entry=DoFindIndex(index);
+  if(entry<0) return;
+  DoErase(entry);
 }
 
 // ClrEntry(rName)
 void SymbolTable::ClrEntry(const std::string& rName) {
-  std::map<std::string,Idx>::iterator it = mIndexMap.find(rName);
-  if (it == mIndexMap.end()) return;
-  mNameMap.erase(it->second);
-  mIndexMap.erase(it);
+  FD_SYMWRITE;
+  long int entry=DoFindName(rName);
+  if(entry<0) return;
+  DoErase(entry);
 }
 
 // RestrictDomain(set)
 void SymbolTable::RestrictDomain(const IndexSet& rDomain) {
+  FD_SYMWRITE;
   // trivial cases
-  if(rDomain.Empty()) { Clear(); return;}
-  if(Size()==0) return;
-  // lazy loop (todo: sorted iterate)
-  std::map<Idx,std::string>::iterator it, oit;
-  it = mNameMap.begin();
-  while(it!=mNameMap.end()) {
-    oit=it;
-    it++;
-    if(!rDomain.Exists(oit->first)) mNameMap.erase(oit);
+  if(rDomain.Empty()) { DoClear(); return;}
+  if(mpData->mSize==0) return;
+  // loop entries
+  for(std::size_t e=0; e<mpData->mIndices.size(); ++e) {
+    if(mpData->mNames[e].empty()) continue;
+    if(!rDomain.Exists(mpData->mIndices[e])) DoErase(e);
   }
 }
 
 // Index(rName)
 Idx SymbolTable::Index(const std::string& rName) const {
-  std::map<std::string,Idx>::const_iterator it = mIndexMap.find(rName);
-  if (it == mIndexMap.end()) 
-    return 0;
-  else 
-    return it->second;
+  FD_SYMREAD;
+  long int entry=DoFindName(rName);
+  if(entry<0) return 0;
+  return mpData->mIndices[entry];
 }
 
 // Symbol(index)
 std::string SymbolTable::Symbol(Idx index) const {
-  std::map<Idx,std::string>::const_iterator it = mNameMap.find(index);
-  if (it == mNameMap.end()) 
-    return "";
-  else 
-    return it->second;
+  FD_SYMREAD;
+  long int entry=DoFindIndex(index);
+  if(entry<0) return "";
+  return mpData->mNames[entry];
 }
 
 
 
 // Exists(index)
 bool SymbolTable::Exists(Idx index) const {
-  std::map<Idx,std::string>::const_iterator it = mNameMap.find(index);
-  return (it != mNameMap.end());
+  FD_SYMREAD;
+  return DoFindIndex(index)>=0;
 }
 
 // Exists(rName)
 bool SymbolTable::Exists(const std::string& rName) const {
-  std::map<std::string,Idx>::const_iterator it = mIndexMap.find(rName);
-  return ( it != mIndexMap.end());
+  FD_SYMREAD;
+  return DoFindName(rName)>=0;
 }
 
 
 // GlobalEventSymbolTablep 
-// (initialize on first use pattern)
+// (initialize on first use pattern, shared by all threads and hence locking)
 SymbolTable* SymbolTable::GlobalEventSymbolTablep(void) {
-  static SymbolTable fls;
+  static SymbolTable fls(true);
   return &fls; 
 }
 
@@ -294,11 +513,20 @@ void SymbolTable::DoWrite(TokenWriter& rTw, const std::string& rLabel, const Typ
   int ocol= rTw.Columns();
   rTw.Columns(2);
 
-  // iterate over indices
-  std::map< std::string, Idx >::const_iterator sit = mIndexMap.begin();
-  for(; sit != mIndexMap.end();++sit) {
-    rTw.WriteInteger(sit->second);
-    rTw.WriteString(sit->first);
+  // sort entries by name
+  std::vector< std::pair<std::string,Idx> > entries;
+  {
+    FD_SYMREAD;
+    entries.reserve(mpData->mSize);
+    for(std::size_t e=0; e<mpData->mIndices.size(); ++e) 
+      if(!mpData->mNames[e].empty()) entries.push_back(std::make_pair(mpData->mNames[e],mpData->mIndices[e]));
+  }
+  std::sort(entries.begin(),entries.end());
+
+  // iterate over entries
+  for(std::size_t e=0; e<entries.size(); ++e) {
+    rTw.WriteInteger(entries[e].second);
+    rTw.WriteString(entries[e].first);
   }
   
   // restore columns
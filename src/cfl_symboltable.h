@@ -34,8 +34,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 #include <map>
 #include <set>
 #include <limits>
+#include <memory>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 
 
@@ -56,6 +58,17 @@ class IndexSet;
  * Generators refer to a global symboltable for event names and hold a local 
  * symboltable for state names.
  *
+ * Technically, each name is stored once in an entry vector. Names are looked up
+ * by an open addressing hash index, indices by a vector over the index range plus
+ * a sorted map for outliers far beyond the number of entries. When libFAUDES is
+ * configured with threads (FAUDES_THREADS), all methods of the global event
+ * symbol table are guarded by a reader/writer lock, so that it can be shared by
+ * computations running in concurrent threads. Other symbol tables, in particular
+ * the state symbol tables of generators, are not locked: like any other libFAUDES
+ * object, they may be read concurrently, but modifications require exclusive access.
+ *
+ * Entries are shared on copy and only detached when either copy is modified.
+ * Thus, copying a generator does not copy its state names.
  *
  */
 class FAUDES_API SymbolTable : public Type {
@@ -69,6 +82,9 @@ public:
   /** Copy constructor */
   SymbolTable(const SymbolTable& rSrc);
 
+  /** Destructor */
+  virtual ~SymbolTable(void);
+
   /** Return name of SymbolTable */
   const std::string& Name(void) const;
 		
@@ -259,14 +275,45 @@ public:
 
  private:
 
+  /** Creates a new SymbolTable, guarded by the reader/writer lock if so specified */
+  explicit SymbolTable(bool locking);
+
   /** Name of the SymbolTable */
   std::string mMyName;
-		
-  /** Index lookup map */
-  std::map<std::string,Idx> mIndexMap;
-		
-  /** Name lookup map */
-  std::map<Idx,std::string> mNameMap;
+
+  /** Entries and lookup structures, shared among copies */
+  class Data {
+  public:
+    /** Construct empty */
+    Data(void) : mSize(0), mHashDeleted(0) {};
+
+    /** Entries: symbolic names (empty string for free entries) */
+    std::vector<std::string> mNames;
+
+    /** Entries: indices */
+    std::vector<Idx> mIndices;
+
+    /** Free entries */
+    std::vector<Idx> mFreeEntries;
+
+    /** Number of used entries */
+    Idx mSize;
+
+    /** Name lookup: open addressing hash of entry+1, 0 for empty slots */
+    std::vector<Idx> mHash;
+
+    /** Number of deleted hash slots */
+    Idx mHashDeleted;
+
+    /** Index lookup: entry+1 by index, 0 for unused */
+    std::vector<Idx> mDense;
+
+    /** Index lookup: entries for indices beyond the dense range */
+    std::map<Idx,Idx> mSparse;
+  };
+
+  /** Entries (copy on write) */
+  std::shared_ptr<Data> mpData;
 
   /** Upper limit (incl) */
   Idx mMaxIndex;
@@ -274,6 +321,44 @@ public:
   /** Largest used index + 1 */
   Idx mNextIndex;
 
+  /** Guard methods by the reader/writer lock (global event symbol table only) */
+  bool mLocking;
+
+#ifdef FAUDES_THREADS
+  /** Reader/writer lock */
+  mutable faudes_rwlock_t mLock;
+#endif
+
+  /** Hash function */
+  static Idx HashValue(const std::string& rName);
+
+  /** Find entry by name (no locking), -1 if not found */
+  long int DoFindName(const std::string& rName) const;
+
+  /** Find entry by index (no locking), -1 if not found */
+  long int DoFindIndex(Idx index) const;
+
+  /** Take a private copy of shared entries before write access (no locking) */
+  void DoDetach(void);
+
+  /** Insert entry (no locking, no checks) */
+  void DoInsert(Idx index, const std::string& rName);
+
+  /** Erase entry (no locking) */
+  void DoErase(Idx entry);
+
+  /** Rebuild hash index with the specified number of slots (no locking) */
+  void DoRehash(std::size_t slots);
+
+  /** Clear all entries (no locking) */
+  void DoClear(void);
+
+  /** Unique symbol (no locking) */
+  std::string DoUniqueSymbol(const std::string& rName) const;
+
+  /** Insert entry incl. checks (no locking) */
+  Idx DoInsEntry(Idx index, const std::string& rName);
+
   /** Symboltable token io */
   void DoRead(TokenReader& rTr,  const std::string& rLabel = "", const Type* pContext=0);
 
@@ -587,48 +587,45 @@ int Token::ReadBinary(std::istream* pStream) {
 
 
 // ReadSpace(pStream)
+// (we operate on the stream buffer to avoid the sentry per character; 
+// flags are set as peek()/get() would do)
 int Token::ReadSpace(std::istream* pStream, bool fcomments){
   char c = '\0';
+  int ic;
   int lc = 0;
   FD_DV("Token::ReadSpace()");
+  std::streambuf* sb=pStream->rdbuf();
   // check the whole pStream
   while(*pStream) {
+    // check eof
+    if(pStream->eof()) return lc; 
     // swallow white space
-    while(*pStream) {
-      // check eof
-      if(pStream->eof()) return lc; 
+    while(true) {
       // look one character ahead
-      c = pStream->peek();
-      // count the next lines
-      if(c == '\n') {
-        ++lc;
-        pStream->get();
-        mPreceedingSpace.append(1,c);
-	continue;
+      ic = sb->sgetc();
+      if(ic == std::char_traits<char>::eof()) {
+        pStream->setstate(std::ios::eofbit);
+        return lc;
       }
-      // swallow controls
-      if(iscntrl(c)) {
-        pStream->get();
-        mPreceedingSpace.append(1,c);
-	continue;
-      }
-      // swallow space
-      if(isspace(c)) {
-        pStream->get();
-        mPreceedingSpace.append(1,c);
-	continue;
-      }
-      // regard this non-white 
-      break;
+      c = (char) ic;
+      // count the next lines
+      if(c == '\n') ++lc;
+      // swallow controls and space
+      if(!(iscntrl(c) || isspace(c))) break;
+      sb->sbumpc();
+      mPreceedingSpace.append(1,c);
     }
     // if the next character starts a faudes comment
     if(!fcomments) break;
     if(c != '%') break;
-    while(*pStream) {
-      // check eof
-      if(pStream->eof()) {return(lc);}; 
+    while(true) {
       // get the next character
-      c = pStream->get();
+      ic = sb->sbumpc();
+      if(ic == std::char_traits<char>::eof()) {
+        pStream->setstate(std::ios::eofbit | std::ios::failbit);
+        return lc;
+      }
+      c = (char) ic;
       // count the next lines
       if (c == '\n') ++lc;
       // terminate with the next new line  character
@@ -694,6 +691,25 @@ bool Token::InterpretNumber(const std::string& numstr, int& type, Int& ival, fau
     type|= (Integer | Boolean);
     return true;
   }
+  // fast path: plain decimal integer, as used for indices
+  // (accumulate in 64 bit and fall back for values beyond Int, i.e., 32-bit long)
+  std::size_t len=numstr.size();
+  if(len>0 && len<=15) {
+    const char* cp=numstr.data();
+    const char* cp_end=cp+len;
+    uint64_t uv=0;
+    for(;cp!=cp_end;++cp) {
+      unsigned int d= (unsigned int) (*cp - '0');
+      if(d>9) break;
+      uv = 10*uv + d;
+    }
+    if(cp==cp_end && uv <= (uint64_t) std::numeric_limits<Int>::max()) {
+      ival = (Int) uv;
+      fval = (faudes::Float) uv;
+      type |= (Integer | Float);
+      return true;
+    }
+  }
   // iterate over string
   std::string::const_iterator cit=numstr.begin();
   for(;cit!=numstr.end(); cit++) {
@@ -756,7 +772,18 @@ void Token::Write(std::ostream* pStream) const {
   if(mType & Integer16) {
     *pStream << ExpandString(ToStringInteger16(mIntegerValue), FD_NAMELEN) << " ";
   } else if(mType & Integer) { 
-    *pStream << ExpandString(ToStringInteger(mIntegerValue), FD_NAMELEN) << " ";
+    // fast path: format plain integers in place, padded as by ExpandString
+    if(mIntegerValue>=0 && mIntegerValue<std::numeric_limits<Int>::max()) {
+      char buf[32+FD_NAMELEN];
+      char* end=buf+20;
+      char* pos=end;
+      Int val=mIntegerValue;
+      do { *(--pos) = '0' + (char) (val % 10); val/=10; } while(val>0);
+      while(end-pos<FD_NAMELEN) *(end++)=' ';
+      *(end++)=' ';
+      pStream->write(pos,end-pos);
+    } else
+      *pStream << ExpandString(ToStringInteger(mIntegerValue), FD_NAMELEN) << " ";
   } else if(mType & Float) { 
     *pStream << ExpandString(ToStringFloat(mFloatValue), FD_NAMELEN) << " ";
   }
@@ -855,18 +882,27 @@ int Token::ReadString(std::istream* pStream, char stop) {
 
 
 // ReadEscapedString(pStream, rString, char)
+// (we operate on the stream buffer to avoid the sentry per character)
 int Token::ReadEscapedString(std::istream* pStream, char stop, std::string& rString) {
   int lc=0;
   char c;
+  int ic;
   std::string entref="";
   bool ctrlblank = false;
   rString = "";
+  std::streambuf* sb=pStream->rdbuf();
   // check the whole pStream
   while (*pStream) {
     // check eof
     if(pStream->eof()) return -1;
     // test one character
-    c = pStream->peek();
+    ic = sb->sgetc();
+    // on eof, set flags as peek()/get() would do
+    if(ic == std::char_traits<char>::eof()) {
+      pStream->setstate(std::ios::eofbit | std::ios::failbit);
+      break;
+    }
+    c = (char) ic;
     // break on mark up
     if(c == '<') break;
     if(c == '>') break;
@@ -875,7 +911,7 @@ int Token::ReadEscapedString(std::istream* pStream, char stop, std::string& rStr
     if(isblank(c) && stop==' ') break;
     if(iscntrl(c) && stop==' ') break;
     // get one character
-    c = pStream->get();
+    sb->sbumpc();
     // count the next lines
     if(c=='\n') ++lc;
     // replace sequence of control characters by one blank
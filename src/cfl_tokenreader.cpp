@@ -25,12 +25,16 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
 #include "cfl_tokenwriter.h"
 #include "cfl_tokenreader.h"
+#include "cfl_gzstream.h"
 
 namespace faudes {
 
+// read buffer size for file input
+static const std::size_t TokenReaderBufferSize = 1 << 16;
+
 // TokenReader(mode,instring)
 TokenReader::TokenReader(Mode mode, const std::string& rInString)
-  : mMode(mode), mpStream(NULL), mFileName("") 
+  : mMode(mode), mpStream(NULL), mpGzStream(NULL), mFileName("") 
 {
   switch(mode) {
   case String: 
@@ -44,6 +48,8 @@ TokenReader::TokenReader(Mode mode, const std::string& rInString)
     // set up mFStream
     FD_DV("TokenReader::Tokenreader(File, \"" << rInString <<"\")");
     mFStream.exceptions(std::ios::badbit|std::ios::failbit);
+    mFBuffer.resize(TokenReaderBufferSize);
+    mFStream.rdbuf()->pubsetbuf(&mFBuffer[0],mFBuffer.size());
     try{
       mFStream.open(rInString.c_str(), std::ios::in | std::ios::binary); 
     } 
@@ -54,6 +60,7 @@ TokenReader::TokenReader(Mode mode, const std::string& rInString)
     }
     mFileName=rInString;
     mpStream=&mFStream;
+    DoOpenGzip();
     Rewind();
     break;
   default:
@@ -66,11 +73,13 @@ TokenReader::TokenReader(Mode mode, const std::string& rInString)
 
 // TokenReader(rFilename)
 TokenReader::TokenReader(const std::string& rFilename) 
-  : mMode(File), mpStream(NULL), mFileName(rFilename) 
+  : mMode(File), mpStream(NULL), mpGzStream(NULL), mFileName(rFilename) 
 {
   // set up mFStream
   FD_DV("TokenReader::Tokenreader(File, \"" << rFilename <<"\")");
   mFStream.exceptions(std::ios::badbit|std::ios::failbit);
+  mFBuffer.resize(TokenReaderBufferSize);
+  mFStream.rdbuf()->pubsetbuf(&mFBuffer[0],mFBuffer.size());
   try{
     mFStream.open(rFilename.c_str(), std::ios::in | std::ios::binary); 
   } 
@@ -81,6 +90,7 @@ TokenReader::TokenReader(const std::string& rFilename)
   }
   mFileName=rFilename;
   mpStream=&mFStream;
+  DoOpenGzip();
   Rewind();
 }
 
@@ -88,6 +98,21 @@ TokenReader::TokenReader(const std::string& rFilename)
 //  destruct
 TokenReader::~TokenReader(void) {
   if(mMode==String) delete mpSStream;
+  delete mpGzStream;
+}
+
+// DoOpenGzip(): sense gzip file and use decoding stream
+void TokenReader::DoOpenGzip(void) {
+  if(!GzInBuffer::IsGzip(mFStream.rdbuf())) return;
+  if(!GzSupported()) {
+    std::stringstream errstr;
+    errstr << "Cannot read gzip file \""<< mFileName << "\": requires zlib (configure option core_zlib)";
+    throw Exception("TokenReader::TokenReader", errstr.str(), 1);
+  }
+  FD_DV("TokenReader::DoOpenGzip(): gzip compressed file \"" << mFileName <<"\"");
+  mpGzStream = new GzIStream(mFStream.rdbuf());
+  mpGzStream->exceptions(std::ios::badbit|std::ios::failbit);
+  mpStream=mpGzStream;
 }
 
 // Stream()
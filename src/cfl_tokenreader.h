@@ -34,6 +34,9 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
 namespace faudes {
 
+// forward (gzip input, see cfl_gzstream.h)
+class GzIStream;
+
 /**
  * A TokenReader reads sequential tokens from a file or string. It can get or peek
  * the next token and it will track line numbers for informative diagnosis output.
@@ -87,12 +90,18 @@ public:
    * Creates a TokenReader for reading a file.
    *
    * This is a convenience wrapper for TokenReader(Mode, const std::string&).
+   * Files in gzip format are sensed and decoded on the fly, see also GzInBuffer;
+   * this requires the configure option core_zlib.
+   * Note that any backward seek on a gzip file, i.e. by Rewind(), SeekBegin() or 
+   * Recover(), decompresses the file again from the beginning up to the target 
+   * position.
    *
    * @param rFilename
    *   file to read
    *
    * @exception Exception
    *   - faudes::Exception ios error opening file (id 1)
+   *   - faudes::Exception gzip file without zlib (id 1)
    */
   TokenReader(const std::string& rFilename);
 
@@ -268,6 +277,8 @@ public:
    * required a matching call of SeekEnd(). As of version 2.18a, this is not
    * supported anymore. The previous behaviour was rarely needed and can be
    * mimiqued by an ordinary ReadEnd() with a subsequent Recover(level).
+   * For gzip compressed files, the search restarts decompression from the beginning 
+   * of the file.
    *
    * @param rLabel
    *   Label to specify section
@@ -496,6 +507,9 @@ public:
   /**
    * Recover by skipping tokens until returning to the specified level of section nesting
    *
+   * For gzip compressed files, seeking back to the recorded position restarts 
+   * decompression from the beginning of the file.
+   *
    * @return
    *   True on success
    */ 
@@ -524,12 +538,21 @@ public:
   /** istream object pointer */
   std::istream* mpStream;
 
+  /** read buffer for file input (larger than the std default) */
+  std::vector<char> mFBuffer;
+
   /** actual stream object, file input  */
   std::ifstream mFStream;
 
   /** actual stream object on heap, string input  */
   std::istringstream* mpSStream;
 
+  /** actual stream object on heap, gzip input from mFStream  */
+  GzIStream* mpGzStream;
+
+  /** sense gzip file and set up mpGzStream */
+  void DoOpenGzip(void);
+
   /** Filename */
   std::string mFileName;
 
@@ -22,56 +22,96 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 
 
 #include "cfl_tokenwriter.h"
+#include "cfl_gzstream.h"
 
 namespace faudes {
 
+// write buffer size for file output
+static const std::size_t TokenWriterBufferSize = 1 << 16;
+
+// DoOpen(rFilename, openmode)
+void TokenWriter::DoOpen(const std::string& rFilename, std::ios::openmode openmode) {
+  // set up mFStream with large buffer
+  mFStream.exceptions(std::ios::badbit|std::ios::failbit);
+  mFBuffer.resize(TokenWriterBufferSize);
+  mFStream.rdbuf()->pubsetbuf(&mFBuffer[0],mFBuffer.size());
+  // figure gzip output by suffix
+  bool gz = rFilename.size()>3 && rFilename.compare(rFilename.size()-3,3,".gz")==0;
+  if(gz) openmode |= std::ios::binary;
+  // reject gzip output when not configured with zlib (before creating the file)
+  if(gz && !GzSupported()) {
+    std::stringstream errstr;
+    errstr << "Cannot write gzip file \""<< rFilename << "\": requires zlib (configure option core_zlib)";
+    throw Exception("TokenWriter::TokenWriter", errstr.str(), 2);
+  }
+  // appending would start a second gzip member, which GzInBuffer does not read
+  if(gz && (openmode & std::ios::app)) {
+    std::stringstream errstr;
+    errstr << "Cannot append to gzip file \""<< rFilename << "\"";
+    throw Exception("TokenWriter::TokenWriter", errstr.str(), 2);
+  }
+  mFStream.open(rFilename.c_str(), openmode); 
+  // use mFStream
+  mpStream=&mFStream;      
+  // use gzip stream on mFStream
+  if(gz) {
+    mpGzStream = new GzOStream(mFStream.rdbuf());
+    mpGzStream->exceptions(std::ios::badbit|std::ios::failbit);
+    mpStream=mpGzStream;
+  }
+}
+
 // TokenWriter(rFilename, openmode)
 TokenWriter::TokenWriter(const std::string& rFilename, std::ios::openmode openmode) 
-  : mMode(File), pSStream(0), mHasOutBuffer(false), mFileName(rFilename), mColumns(80/FD_NAMELEN), mColCount(0) {
+  : mMode(File), mpGzStream(0), pSStream(0), mHasOutBuffer(false), mFileName(rFilename), mColumns(80/FD_NAMELEN), mColCount(0), mSymbolicNames(true) {
   // set up mFStream
-  mFStream.exceptions(std::ios::badbit|std::ios::failbit);
   try{
-    mFStream.open(rFilename.c_str(), openmode); 
+    DoOpen(rFilename, openmode);
   }
   catch (std::ios::failure&) {
+    delete mpGzStream;
     std::stringstream errstr;
     errstr << "Exception opening/writing file \""<< rFilename << "\"";
     throw Exception("TokenWriter::TokenWriter", errstr.str(), 2);
   }
-  // use mFStream
-  mpStream=&mFStream;      
+  catch (...) {
+    delete mpGzStream;
+    throw;
+  }
   mEndl=true;
 }
 
 // TokenWriter(rFilename, doctype)
 TokenWriter::TokenWriter(const std::string& rFilename, const std::string& ftype) 
-  : mMode(XmlFile), pSStream(0), mHasOutBuffer(false), mFileName(rFilename), mColumns(80/FD_NAMELEN), mColCount(0) {
+  : mMode(XmlFile), mpGzStream(0), pSStream(0), mHasOutBuffer(false), mFileName(rFilename), mColumns(80/FD_NAMELEN), mColCount(0), mSymbolicNames(true) {
   // set up mFStream
-  mFStream.exceptions(std::ios::badbit|std::ios::failbit);
   try{
-    mFStream.open(rFilename.c_str(), std::ios::out|std::ios::trunc); 
-    mFStream << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>" << std::endl;
+    DoOpen(rFilename, std::ios::out|std::ios::trunc); 
+    *mpStream << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\" standalone=\"no\"?>" << std::endl;
     if(ftype!="") 
     if(ftype!="Void") {
       std::string dtdfile=ftype;
       std::transform(dtdfile.begin(), dtdfile.end(), dtdfile.begin(), tolower);
       dtdfile="http://www.faudes.org/dtd/1.0/"+dtdfile+".dtd";
-      mFStream << "<!DOCTYPE " << ftype << " SYSTEM \"" << dtdfile << "\">" << std::endl;
+      *mpStream << "<!DOCTYPE " << ftype << " SYSTEM \"" << dtdfile << "\">" << std::endl;
     }
   }
   catch (std::ios::failure&) {
+    delete mpGzStream;
     std::stringstream errstr;
     errstr << "Exception opening/writing xml file \""<< rFilename << "\"";
     throw Exception("TokenWriter::TokenWriter", errstr.str(), 2);
   }
-  // use mFStream
-  mpStream=&mFStream;      
+  catch (...) {
+    delete mpGzStream;
+    throw;
+  }
   mEndl=true;
 }
 
 // TokenWriter(mode)
 TokenWriter::TokenWriter(Mode mode)
-  : mMode(mode), pSStream(0), mHasOutBuffer(false), mFileName(""), mColumns(80/FD_NAMELEN), mColCount(0) {
+  : mMode(mode), mpGzStream(0), pSStream(0), mHasOutBuffer(false), mFileName(""), mColumns(80/FD_NAMELEN), mColCount(0), mSymbolicNames(true) {
   switch(mode) {
   case Stdout: 
     // set up mFStream
@@ -116,7 +156,7 @@ TokenWriter::TokenWriter(Mode mode)
 
 // TokenWriter(stream)
 TokenWriter::TokenWriter(std::ostream& stream, const std::string& ftype) 
-  : mMode(Stream), pSStream(&stream), mHasOutBuffer(false), mFileName("stream"), mColumns(0), mColCount(0) {
+  : mMode(Stream), mpGzStream(0), pSStream(&stream), mHasOutBuffer(false), mFileName("stream"), mColumns(0), mColCount(0), mSymbolicNames(true) {
   // xml if there is a doctype
   try {
     if(ftype!="") 
@@ -140,6 +180,10 @@ TokenWriter::TokenWriter(std::ostream& stream, const std::string& ftype)
 // destructor
 TokenWriter::~TokenWriter(void) {
   Flush();
+  if(mpGzStream) {
+    try { mpGzStream->Finish(); } catch(...) {}
+    delete mpGzStream;
+  }
   if(mMode==File) mFStream.close();
 }
 
@@ -189,7 +233,7 @@ void TokenWriter::Columns(int columns) {
 void TokenWriter::Endl(void) {
   DoFlush(1);
   try{
-    if(mEndl) *mpStream << std::endl;
+    if(mEndl) *mpStream << '\n';
     else *mpStream << " ";
   }
   catch (std::ios::failure&) {
@@ -214,7 +258,7 @@ void TokenWriter::DoFlush(bool clf) {
     for(size_t i=0; i< mOutBuffer.mPreceedingSpace.size(); ++i) {
       char c= mOutBuffer.mPreceedingSpace.at(i);
       if(c=='\n') {
-        if(mEndl) *mpStream << std::endl;
+        if(mEndl) *mpStream << '\n';
         else *mpStream << " ";
         mColCount=0; ;
         continue;
@@ -230,7 +274,7 @@ void TokenWriter::DoFlush(bool clf) {
     if(clf) {
       if(mOutBuffer.IsBegin() || mOutBuffer.IsEnd()) 
  	if(mColCount==1)
-          if(mEndl) { *mpStream << std::endl; mColCount=0;}
+          if(mEndl) { *mpStream << '\n'; mColCount=0;}
       mOutBuffer.SetNone();
     }
   }
@@ -30,9 +30,13 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace faudes {
 
+// forward (gzip output, see cfl_gzstream.h)
+class GzOStream;
+
 /**
  * A TokenWriter writes sequential tokens to a file, a string or stdout. It is the counterpart
  * of the TokenReader. Since wrtiting data is comparatively straight foreward, there is no explicit 
@@ -72,12 +76,18 @@ class FAUDES_API TokenWriter {
   /** 
    * File TokenWriter constructor
    *
+   * If the filename ends with ".gz", the output is gzip compressed,
+   * see also GzOutBuffer. This requires the configure option core_zlib. 
+   * Appending to gzip files is not supported.
+   *
    * @param rFilename
    *   File to write
    * @param openmode
    *   std::ios::openmode
    * @exception Exception
    *   - faudes::Exception ios error opening file (id 2)
+   *   - faudes::Exception append mode for gzip file (id 2)
+   *   - faudes::Exception gzip file without zlib (id 2)
    */
   TokenWriter(const std::string& rFilename, 
 	      std::ios::openmode openmode = std::ios::out|std::ios::trunc);
@@ -192,6 +202,26 @@ class FAUDES_API TokenWriter {
    */
   void Endl(bool on);
 
+  /**
+   * Prefer symbolic names in bulk sections
+   *
+   * This is a hint to serialisation functions that sections with many
+   * references to named elements, e.g. the transition relation of a generator,
+   * may be written by index rather than by symbolic name. Defaults to true.
+   *
+   * @param on
+   *   False to prefer indices
+   */
+  void SymbolicNames(bool on) { mSymbolicNames=on; };
+
+  /**
+   * Test whether symbolic names are preferred in bulk sections
+   *
+   * @return
+   *   True if symbolic names are preferred
+   */
+  bool SymbolicNames(void) const { return mSymbolicNames; };
+
   /**
    * Write next token
    *
@@ -487,9 +517,15 @@ class FAUDES_API TokenWriter {
   /** ostream object pointer*/
   std::ostream* mpStream;
 
+  /** Write buffer for file output (larger than the std default) */
+  std::vector<char> mFBuffer;
+
   /** Actual stream object, file output */
   std::ofstream mFStream;
 
+  /** Actual stream object on heap, gzip output to mFStream */
+  GzOStream* mpGzStream;
+
   /** Actual stream object, string output */
   std::ostringstream mSStream;
 
@@ -512,12 +548,18 @@ class FAUDES_API TokenWriter {
   /** Endl seperator on/off */
   bool mEndl;
 
+  /** Prefer symbolic names */
+  bool mSymbolicNames;
+
   /** Xml doctype if in xml mode */
   std::string  mDocType;
 
   /** Flush internal buffer */
   void DoFlush(bool clf=1);
 
+  /** Open file incl. buffer and gzip setup */
+  void DoOpen(const std::string& rFilename, std::ios::openmode openmode);
+
 };
 
 } // namespace faudes
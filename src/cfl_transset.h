@@ -780,6 +780,36 @@ FAUDES_TYPE_DECLARATION(TransSet,TTransSet,(TBaseSet<Transition,Cmp>))
    */
   Iterator EndByX2Ev(Idx x2, Idx ev) const;
 
+  /**
+   * Read-only view on a TTransSet.
+   *
+   * Extends TBaseSet::ConstView by the ranges of transitions with specified
+   * current resp. next state. The view iterators are not tracked; see TBaseSet::ConstView 
+   * for the restrictions that apply. Sorting requirements are the same as for the
+   * corresponding TTransSet members, but they are not checked.
+   */
+  class ConstView : public TBaseSet<Transition,Cmp>::ConstView {
+  public:
+    /** Iterator type: STL const iterator, no tracking */
+    typedef typename TBaseSet<Transition,Cmp>::ConstView::Iterator Iterator;
+    /** Construct view on transition set */
+    explicit ConstView(const TTransSet& rSet) : TBaseSet<Transition,Cmp>::ConstView(rSet) {};
+    using TBaseSet<Transition,Cmp>::ConstView::Begin;
+    using TBaseSet<Transition,Cmp>::ConstView::End;
+    /** Iterator to first transition with current state x1 (X1EvX2, X1X2Ev) */
+    Iterator Begin(Idx x1) const { return this->mpSet->lower_bound(Transition(x1,0,0)); };
+    /** Iterator beyond last transition with current state x1 (X1EvX2, X1X2Ev) */
+    Iterator End(Idx x1) const { return this->mpSet->lower_bound(Transition(x1+1,0,0)); };
+    /** Iterator to first transition with current state x1 and event ev (X1EvX2) */
+    Iterator Begin(Idx x1, Idx ev) const { return this->mpSet->lower_bound(Transition(x1,ev,0)); };
+    /** Iterator beyond last transition with current state x1 and event ev (X1EvX2) */
+    Iterator End(Idx x1, Idx ev) const { return this->mpSet->lower_bound(Transition(x1,ev+1,0)); };
+    /** Iterator to first transition with next state x2 (X2EvX1, X2X1Ev) */
+    Iterator BeginByX2(Idx x2) const { return this->mpSet->lower_bound(Transition(0,0,x2)); };
+    /** Iterator beyond last transition with next state x2 (X2EvX1, X2X1Ev) */
+    Iterator EndByX2(Idx x2) const { return this->mpSet->lower_bound(Transition(0,0,x2+1)); };
+  };
+
   /** @} doxygen group */
 
   /** @name Set Operators
@@ -1442,23 +1472,23 @@ TEMP typename THIS::Iterator THIS::EndByX2Ev(Idx x2, Idx ev) const {
 
 // operator+
 TEMP THIS THIS::operator+ (const TTransSet<Cmp>& rOtherSet) const {
-  TTransSet<Cmp> res(*this);
-  res.InsertSet(rOtherSet);
+  TTransSet<Cmp> res;
+  res.DoSetUnion(*this,rOtherSet);
   return res;
 }
 
 // operator-
 TEMP THIS THIS::operator- (const TTransSet<Cmp>& rOtherSet) const {
-  TTransSet<Cmp> res(*this);
-  res.EraseSet(rOtherSet);
+  TTransSet<Cmp> res;
+  res.DoSetDifference(*this,rOtherSet);
   return res;
 }
 
      
 // operator*
 TEMP TTransSet<Cmp> THIS::operator* (const TTransSet<Cmp>& rOtherSet) const {
-  TTransSet<Cmp> res(*this);
-  res.RestrictSet(rOtherSet);
+  TTransSet<Cmp> res;
+  res.DoSetIntersection(*this,rOtherSet);
   return res;
 }
 
@@ -365,6 +365,171 @@ AttrType::~AttrType(void) {
   FAUDES_OBJCOUNT_DEC("AttrType");
 }
 
+// attribute pool: free lists for objects up to 64 bytes in 16 byte size
+// classes; memory is obtained in chunks of 64KiB and recycled, but never
+// returned to the system; with threads, each thread keeps a bounded number 
+// of free blocks per size class and spills the excess to a shared pool, hands 
+// all its free blocks to the shared pool on exit, and refills from the shared 
+// pool before it obtains a new chunk
+namespace {
+
+struct AttrPool {
+  static const std::size_t Classes = 4;
+  static const std::size_t ChunkSize = 64*1024;
+  static const std::size_t MaxFree = 2048;
+  // free list heads and lengths per size class
+  void* mFree[Classes];
+  std::size_t mCount[Classes];
+  // remaining chunk
+  char* mChunk;
+  std::size_t mChunkLeft;
+  // thread exit handler installed
+  bool mArmed;
+  // thread exit handler done, use shared pool only
+  bool mDone;
+};
+
+static FAUDES_TLS AttrPool gAttrPool = {{0,0,0,0},{0,0,0,0},0,0,false,false};
+
+// free list operations
+inline void AttrPoolPush(void*& rHead, void* pMem) {
+  *static_cast<void**>(pMem)=rHead;
+  rHead=pMem;
+}
+inline void* AttrPoolPop(void*& rHead) {
+  void* res=rHead;
+  if(res) rHead=*static_cast<void**>(res);
+  return res;
+}
+
+#ifdef FAUDES_THREADS
+
+// shared pool, guarded by a global lock (never destroyed, since attributes
+// may be released by static destructors)
+class AttrPoolLock {
+public:
+  AttrPoolLock(void) : mpMutex(Mutex()) { faudes_mutex_lock(mpMutex); }
+  ~AttrPoolLock(void) { faudes_mutex_unlock(mpMutex); }
+  // free list heads of the shared pool
+  static void** Free(void) {
+    static void* free[AttrPool::Classes]={0,0,0,0};
+    return free;
+  }
+private:
+  faudes_mutex_t* mpMutex;
+  static faudes_mutex_t* Mutex(void) {
+    static faudes_mutex_t* mtx = NewMutex();
+    return mtx;
+  }
+  static faudes_mutex_t* NewMutex(void) {
+    faudes_mutex_t* mtx = new faudes_mutex_t;
+    faudes_mutex_init(mtx);
+    return mtx;
+  }
+};
+
+// thread exit handler: move free blocks and the remaining chunk to the 
+// shared pool; the thread pool itself is trivially destructible and remains 
+// accessible for attributes released later on by the exiting thread
+struct AttrPoolExit {
+  ~AttrPoolExit(void) {
+    AttrPool& pool=gAttrPool;
+    AttrPoolLock lock;
+    void** shared=AttrPoolLock::Free();
+    for(std::size_t sc=0; sc<AttrPool::Classes; ++sc) {
+      while(void* mem=AttrPoolPop(pool.mFree[sc]))
+        AttrPoolPush(shared[sc],mem);
+      pool.mCount[sc]=0;
+    }
+    for(std::size_t sc=AttrPool::Classes; sc>0; --sc) {
+      std::size_t bsize=16*sc;
+      for(;pool.mChunkLeft>=bsize; pool.mChunkLeft-=bsize, pool.mChunk+=bsize) 
+        AttrPoolPush(shared[sc-1],pool.mChunk);
+    }
+    pool.mDone=true;
+  }
+};
+
+static FAUDES_TLS AttrPoolExit gAttrPoolExit;
+
+// install exit handler for this thread (odr-use initialises the thread local)
+void AttrPoolArm(AttrPool& rPool) {
+  rPool.mArmed=true;
+  AttrPoolExit& exit=gAttrPoolExit;
+  (void) exit;
+}
+
+#endif
+
+}
+
+// operator new
+void* AttrType::operator new(std::size_t size) {
+  if(size==0 || size>16*AttrPool::Classes) return ::operator new(size);
+  std::size_t sc = (size-1)/16;
+  std::size_t bsize=16*(sc+1);
+  AttrPool& pool=gAttrPool;
+  // recycle
+  void* res=AttrPoolPop(pool.mFree[sc]);
+  if(res) { --pool.mCount[sc]; return res; }
+  // carve from chunk
+  if(pool.mChunkLeft<bsize) {
+#ifdef FAUDES_THREADS
+    if(!pool.mArmed) AttrPoolArm(pool);
+    {
+      AttrPoolLock lock;
+      void*& shared=AttrPoolLock::Free()[sc];
+      // thread has exited: serve from shared pool
+      if(pool.mDone) {
+        res=AttrPoolPop(shared);
+        return res ? res : ::operator new(bsize);
+      }
+      // refill from shared pool (up to half the local limit)
+      for(;pool.mCount[sc]<AttrPool::MaxFree/2; ++pool.mCount[sc]) {
+        void* mem=AttrPoolPop(shared);
+        if(!mem) break;
+        AttrPoolPush(pool.mFree[sc],mem);
+      }
+    }
+    res=AttrPoolPop(pool.mFree[sc]);
+    if(res) { --pool.mCount[sc]; return res; }
+#endif
+    pool.mChunk=static_cast<char*>(::operator new(AttrPool::ChunkSize));
+    pool.mChunkLeft=AttrPool::ChunkSize;
+  }
+  res=pool.mChunk;
+  pool.mChunk+=bsize;
+  pool.mChunkLeft-=bsize;
+  return res;
+}
+
+// operator delete
+void AttrType::operator delete(void* pMem, std::size_t size) {
+  if(!pMem) return;
+  if(size==0 || size>16*AttrPool::Classes) { ::operator delete(pMem); return; }
+  std::size_t sc = (size-1)/16;
+  AttrPool& pool=gAttrPool;
+#ifdef FAUDES_THREADS
+  if(!pool.mArmed) AttrPoolArm(pool);
+  if(pool.mDone) {
+    AttrPoolLock lock;
+    AttrPoolPush(AttrPoolLock::Free()[sc],pMem);
+    return;
+  }
+#endif
+  AttrPoolPush(pool.mFree[sc],pMem);
+  ++pool.mCount[sc];
+#ifdef FAUDES_THREADS
+  // spill excess to shared pool (down to half the local limit)
+  if(pool.mCount[sc]>AttrPool::MaxFree) {
+    AttrPoolLock lock;
+    void*& shared=AttrPoolLock::Free()[sc];
+    for(;pool.mCount[sc]>AttrPool::MaxFree/2; --pool.mCount[sc])
+      AttrPoolPush(shared,AttrPoolPop(pool.mFree[sc]));
+  }
+#endif
+}
+
 //Skip(rTr)
 void AttrType::Skip(TokenReader& rTr) {
   FD_DC("AttrType::Skip()");
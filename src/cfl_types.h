@@ -1087,6 +1087,28 @@ public:
    */
   static void Skip(TokenReader& rTr);
 
+  /**
+   * Allocate attribute.
+   *
+   * Attributed sets allocate one attribute per element on the heap. Small
+   * objects, i.e., typical attributes, are served from a pool of free lists by
+   * size class; the pool obtains memory in chunks and does not return it to
+   * the system. Larger objects, e.g. containers derived from ExtType, use the
+   * global allocator. With FAUDES_THREADS, each thread has its own pool; on thread
+   * exit, its free memory is handed over to a shared pool, from which other threads
+   * refill before they obtain a new chunk. Attributes may be released by any thread.
+   */
+  static void* operator new(std::size_t size);
+
+  /** Release attribute to the pool, see operator new */
+  static void operator delete(void* pMem, std::size_t size);
+
+  /** Placement new (not pooled) */
+  static void* operator new(std::size_t size, void* pMem) { (void) size; return pMem; };
+
+  /** Placement delete (not pooled) */
+  static void operator delete(void* pMem, void* pPlace) { (void) pMem; (void) pPlace; };
+
 protected:
 
   /** Assign (no members, dummy) */
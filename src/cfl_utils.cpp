@@ -418,9 +418,36 @@ bool FileCopy(const std::string& rFromFile, const std::string& rToFile) {
   return !(froms.fail() || tos.fail());
 }
 
+// global locks for console out and object count (construct on first use,
+// never destroyed to survive static destruction)
+#ifdef FAUDES_THREADS
+namespace {
+class UtilsLock {
+public:
+  enum Domain { Instance=0, Console=1, Count=2 };
+  UtilsLock(Domain dom) : mpMutex(Mutex(dom)) { faudes_mutex_lock(mpMutex); }
+  ~UtilsLock(void) { faudes_mutex_unlock(mpMutex); }
+private:
+  faudes_mutex_t* mpMutex;
+  static faudes_mutex_t* Mutex(Domain dom) {
+    static faudes_mutex_t* mtx = NewMutexes();
+    return mtx+dom;
+  }
+  static faudes_mutex_t* NewMutexes(void) {
+    faudes_mutex_t* mtx = new faudes_mutex_t[3];
+    for(int i=0; i<3; ++i) faudes_mutex_init(mtx+i);
+    return mtx;
+  }
+};
+}
+#define FD_UTILSLOCK(dom) UtilsLock utilslock(UtilsLock::dom)
+#else
+#define FD_UTILSLOCK(dom)
+#endif
+
 // ConsoleOut class
-// Note: console-out is not re-entrant; for multithreaded applications
-// you must derive a class that has built-in mutexes; 
+// Note: Write() is serialised by a global lock; redirection is not
+// and should be configured before any threads are started
 ConsoleOut::ConsoleOut(void) : pStream(NULL), mMute(false) , mVerb(0) {
   pInstance=this;
 }
@@ -429,6 +456,7 @@ ConsoleOut::~ConsoleOut(void) {
   if(this==smpInstance) smpInstance=NULL;
 }
 ConsoleOut* ConsoleOut::G(void) {
+  FD_UTILSLOCK(Instance);
   if(!smpInstance) smpInstance= new ConsoleOut();
   return smpInstance->pInstance;
 }
@@ -450,6 +478,7 @@ void ConsoleOut::ToFile(const std::string& filename) {
   void ConsoleOut::Write(const std::string& message,long int cntnow, long int cntdone, int verb) {
   if(mMute) return;
   if(mVerb<verb) return;
+  FD_UTILSLOCK(Console);
   DoWrite(message,cntnow,cntdone,verb);
 }
   void ConsoleOut::DoWrite(const std::string& message,long int cntnow, long int cntdone, int verb) {
@@ -475,14 +504,17 @@ ObjectCount::ObjectCount(void) {
   msDone=true; 
 }
 void  ObjectCount::Init(void) {
+ FD_UTILSLOCK(Count);
  if(!msDone) ObjectCount();
 }
 void  ObjectCount::Inc(const std::string& rTypeName) {
+  FD_UTILSLOCK(Count);
   if(!msDone) ObjectCount();
   long int cnt = ((*mspCount)[rTypeName]+=1);
   if((*mspMax)[rTypeName]<cnt) (*mspMax)[rTypeName]=cnt;
 }
 void  ObjectCount::Dec(const std::string& rTypeName) {
+  FD_UTILSLOCK(Count);
   if(!msDone) ObjectCount();
   (*mspCount)[rTypeName]-=1;
 }
@@ -565,6 +597,8 @@ void TestProtocol(const std::string& rMessage, const Type& rData, bool full) {
   gTestProtocolTw->WriteComment("");
   gTestProtocolTw->WriteComment("");
   *gTestProtocolTw << "\n";
+  // flush, since the protocol may not be closed by the application 
+  gTestProtocolTw->Flush();
 }
 void TestProtocol(const std::string& rMessage, bool data) {
   Boolean fbool(data);
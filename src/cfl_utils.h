@@ -322,6 +322,9 @@ extern FAUDES_API std::set< std::string > ReadDirectory(const std::string& rDire
  * The main motivation of the entire construct is to support gui applications that may
  * grab all console output by 1) deriving a specialised class from ConsoleOut and 2) 
  * redirection by ConsoleOut::G()->Redirect(derived_class_instance).
+ *
+ * With threads enabled, Write() is serialised by a global lock. Redirection 
+ * should be configured before any threads are started.
  */
 class FAUDES_API ConsoleOut {
 public:
@@ -28,15 +28,18 @@
 #include "cfl_platform.h"
 #include "cfl_utils.h"
 #include "cfl_exception.h"
+#include "cfl_gzstream.h"
 #include "cfl_registry.h"
 #include "cfl_attributes.h"
 #include "cfl_baseset.h"
 #include "cfl_basevector.h"
 #include "cfl_elementary.h"
 #include "cfl_indexset.h"
+#include "cfl_densestateset.h"
 #include "cfl_symbolset.h"
 #include "cfl_nameset.h"
 #include "cfl_transset.h"
+#include "cfl_compacttransset.h"
 #include "cfl_generator.h"
 #include "cfl_agenerator.h"
 #include "cfl_graphfncts.h"
@@ -49,5 +52,11 @@
 #include "cfl_bisimulation.h"
 #include "cfl_bisimcta.h"
 #include "cfl_cgenerator.h"
+#include "cfl_genbuilder.h"
+#include "cfl_genbinary.h"
+#include "cfl_dataflow.h"
+#include "cfl_resultcache.h"
+#include "cfl_isomorphism.h"
+#include "cfl_budget.h"
 
 #endif
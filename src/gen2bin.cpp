@@ -0,0 +1,61 @@
+/** gen2bin.cpp  Utility to convert gen files to/from binary generator files  */
+
+/* FAU Discrete Event Systems Library (libfaudes)
+
+   Copyright (C) 2026  libFAUDES contributors
+   Exclusive copyright is granted to Klaus Schmidt
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Lesser General Public
+   License as published by the Free Software Foundation; either
+   version 2.1 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public
+   License along with this library; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA */
+
+#include "corefaudes.h"
+
+using namespace faudes;
+
+int main(int argc, char *argv[]) {
+
+  // simple command line
+  bool reverse = argc==3 && std::string(argv[1])=="-r";
+  if (argc != 2 && !reverse) {
+    std::cerr << "gen2bin: " << VersionString()  << std::endl;
+    std::cerr << "usage: gen2bin <generator>.gen    (writes <generator>.fbg)" << std::endl;
+    std::cerr << "       gen2bin -r <generator>.fbg (writes <generator>.gen)" << std::endl;
+    exit(1);
+  }
+  std::string infilename = argv[argc-1];
+
+  // fix output file name
+  std::string basename = infilename;
+  std::string suffix = reverse ? ".fbg" : ".gen";
+  if (basename.rfind(suffix) < basename.size()) {
+    basename.resize(basename.rfind(suffix));
+  }
+
+  // convert
+  try {
+    if(!reverse) {
+      Generator g(infilename);
+      BinaryWrite(g,basename+".fbg");
+    } else {
+      Generator g;
+      BinaryRead(infilename,g);
+      g.Write(basename+".gen");
+    }
+  } catch (Exception& fexception) {
+    std::cerr << "gen2bin: " << fexception.What() << std::endl;
+    exit(1);
+  }
+
+  return 0;
+}
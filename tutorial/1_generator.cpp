@@ -734,6 +734,437 @@ int main() {
   gsigcomplC.Write("tmp_gsigcomplc.gen");
 
 
+  ///////////////////////////////////
+  // Cached re-sorted transition relations
+  ///////////////////////////////////
+
+  // the cached copies must follow every modification of the transition relation
+  std::cout << "################################\n";
+  std::cout << "# tutorial, cached transition relations \n";
+  Generator gcache("data/simplemachine.gen");
+  bool cacheok=true;
+  auto cachecheck = [&](const Generator& rGen) {
+    TransSetX2EvX1 tx2ev;
+    TransSetEvX1X2 tevx1;
+    rGen.TransRel(tx2ev);
+    rGen.TransRel(tevx1);
+    if(!(rGen.TransRelX2EvX1()==tx2ev)) cacheok=false;
+    if(!(rGen.TransRelEvX1X2()==tevx1)) cacheok=false;
+  };
+  cachecheck(gcache);
+  gcache.SetTransition("idle","alpha","down");
+  cachecheck(gcache);
+  gcache.ClrTransition(gcache.StateIndex("busy"),gcache.EventIndex("beta"),gcache.StateIndex("idle"));
+  cachecheck(gcache);
+  gcache.DelState("down");
+  cachecheck(gcache);
+  TransSet tcache=gcache.TransRel();
+  tcache.Insert(gcache.StateIndex("busy"),gcache.EventIndex("mue"),gcache.StateIndex("idle"));
+  gcache.InjectTransRel(tcache);
+  cachecheck(gcache);
+  Generator gcacheB("data/simplemachine.gen");
+  cachecheck(gcacheB);
+  gcacheB=gcache;
+  cachecheck(gcacheB);
+  gcache.InsState(100);
+  gcache.SetTransition(100,gcache.EventIndex("alpha"),gcache.StateIndex("idle"));
+  cachecheck(gcache);
+  gcache.MinStateIndex();
+  cachecheck(gcache);
+  gcache.ClearTransRelIndices();
+  cachecheck(gcache);
+  gcache.Clear();
+  cachecheck(gcache);
+  if(cacheok) 
+    std::cout << "cached transition relations: ok [expected]\n";
+  else
+    std::cout << "cached transition relations: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("cached transrel",cacheok);
+
+
+  ///////////////////////////////////
+  // Bulk construction by GeneratorBuilder
+  ///////////////////////////////////
+
+  // record the same generator by direct construction and by the builder,
+  // incl. transitions out of order, duplicates and an explicit state index
+  std::cout << "################################\n";
+  std::cout << "# tutorial, generator builder \n";
+  Generator gbsrc("data/simplemachine.gen");
+  Generator gbdirect;
+  Generator gbbuilt;
+  GeneratorBuilder gbuilder;
+  bool builderok=true;
+  std::map<Idx,Idx> gbmap;
+  StateSet::Iterator gbsit;
+  for(gbsit=gbsrc.StatesBegin(); gbsit!=gbsrc.StatesEnd(); ++gbsit) {
+    Idx xd=gbdirect.InsState(gbsrc.StateName(*gbsit));
+    Idx xb=gbuilder.InsState();
+    gbuilder.StateName(xb,gbsrc.StateName(*gbsit));
+    if(xd!=xb) builderok=false;
+    gbmap[*gbsit]=xd;
+  }
+  gbdirect.InsState(10);
+  gbuilder.InsState(10);
+  if(gbdirect.InsState()!=gbuilder.InsState()) builderok=false;
+  gbdirect.InsEvents(gbsrc.Alphabet());
+  gbuilder.InsEvents(gbsrc.Alphabet());
+  for(gbsit=gbsrc.InitStatesBegin(); gbsit!=gbsrc.InitStatesEnd(); ++gbsit) {
+    gbdirect.SetInitState(gbmap[*gbsit]);
+    gbuilder.SetInitState(gbmap[*gbsit]);
+  }
+  gbdirect.SetMarkedState(10);
+  gbuilder.SetMarkedState(10);
+  gbuilder.SetMarkedState(10);
+  std::vector<Transition> gbtrans;
+  TransSet::Iterator gbtsit;
+  for(gbtsit=gbsrc.TransRelBegin(); gbtsit!=gbsrc.TransRelEnd(); ++gbtsit) 
+    gbtrans.push_back(*gbtsit);
+  for(int pass=0; pass<2; ++pass) {
+    std::vector<Transition>::reverse_iterator gbtit;
+    for(gbtit=gbtrans.rbegin(); gbtit!=gbtrans.rend(); ++gbtit) {
+      gbdirect.SetTransition(gbmap[gbtit->X1],gbtit->Ev,gbmap[gbtit->X2]);
+      gbuilder.SetTransition(gbmap[gbtit->X1],gbtit->Ev,gbmap[gbtit->X2]);
+    }
+  }
+  gbdirect.SetTransition(10,gbsrc.EventIndex("alpha"),gbmap[gbsrc.StateIndex("idle")]);
+  gbuilder.SetTransition(10,gbsrc.EventIndex("alpha"),gbmap[gbsrc.StateIndex("idle")]);
+  gbbuilt.Name("built");
+  gbuilder.Finalize(gbbuilt);
+  if(gbbuilt.Name()!="built") builderok=false;
+  if(!(gbbuilt.Alphabet()==gbdirect.Alphabet())) builderok=false;
+  if(!(gbbuilt.States()==gbdirect.States())) builderok=false;
+  if(!(gbbuilt.InitStates()==gbdirect.InitStates())) builderok=false;
+  if(!(gbbuilt.MarkedStates()==gbdirect.MarkedStates())) builderok=false;
+  if(!(gbbuilt.TransRel()==gbdirect.TransRel())) builderok=false;
+  for(gbsit=gbdirect.StatesBegin(); gbsit!=gbdirect.StatesEnd(); ++gbsit) 
+    if(gbbuilt.StateName(*gbsit)!=gbdirect.StateName(*gbsit)) builderok=false;
+  if(gbuilder.TransRelSize()!=0 || gbuilder.MaxStateIndex()!=0) builderok=false;
+  if(builderok) 
+    std::cout << "generator builder: ok [expected]\n";
+  else
+    std::cout << "generator builder: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("builder",builderok);
+  FAUDES_TEST_DUMP("builder result",gbbuilt);
+
+
+  ///////////////////////////////////
+  // Binary file format
+  ///////////////////////////////////
+
+  // write/read roundtrip incl. state names and event flags
+  std::cout << "################################\n";
+  std::cout << "# tutorial, binary file format \n";
+  System sbin("data/csimplemachine.gen");
+  sbin.SetTransition("down","beta","busy");
+  BinaryWrite(sbin,"tmp_csimplemachine.fbg");
+  System sbinback;
+  BinaryRead("tmp_csimplemachine.fbg",sbinback);
+  auto binequal = [](const vGenerator& rA, const vGenerator& rB) {
+    bool eq = rA.Alphabet()==rB.Alphabet();
+    eq = eq && rA.States()==rB.States() && rA.TransRel()==rB.TransRel();
+    eq = eq && rA.InitStates()==rB.InitStates() && rA.MarkedStates()==rB.MarkedStates();
+    StateSet::Iterator sit;
+    for(sit=rA.StatesBegin(); eq && sit!=rA.StatesEnd(); ++sit) 
+      eq = rA.StateName(*sit)==rB.StateName(*sit);
+    return eq;
+  };
+  bool binok=binequal(sbin,sbinback);
+  binok = binok && sbin.ControllableEvents()==sbinback.ControllableEvents();
+
+  // command line tool gen2bin, forth and back (test cases run in the tutorial directory)
+#ifdef FAUDES_POSIX
+  sbin.Write("tmp_gen2bin.gen");
+  binok = binok && std::system("../bin/gen2bin tmp_gen2bin.gen > /dev/null 2>&1")==0;
+  Generator sgen2bin;
+  if(binok) BinaryRead("tmp_gen2bin.fbg",sgen2bin);
+  binok = binok && binequal(sbin,sgen2bin);
+  std::remove("tmp_gen2bin.gen");
+  binok = binok && std::system("../bin/gen2bin -r tmp_gen2bin.fbg > /dev/null 2>&1")==0;
+  sgen2bin.Clear();
+  if(binok) sgen2bin.Read("tmp_gen2bin.gen");
+  binok = binok && binequal(sbin,sgen2bin);
+#endif
+  if(binok) 
+    std::cout << "binary roundtrip: ok [expected]\n";
+  else
+    std::cout << "binary roundtrip: failed [error]\n";
+
+  // corrupted files are rejected on opening: truncated file, unsorted states, 
+  // transitions to unknown events or states; positions are range checked
+  std::string bindata;
+  std::ifstream binin("tmp_csimplemachine.fbg", std::ios::in|std::ios::binary);
+  bindata.assign(std::istreambuf_iterator<char>(binin),std::istreambuf_iterator<char>());
+  binin.close();
+  auto binpatch = [](std::string data, const char* pTag, Idx pos, uint32_t val) {
+    uint32_t nsec;
+    std::memcpy(&nsec,data.data()+16,4);
+    for(uint32_t i=0; i<nsec; ++i) {
+      const char* entry=data.data()+24+24*i;
+      if(std::memcmp(entry,pTag,4)!=0) continue;
+      uint64_t offset;
+      std::memcpy(&offset,entry+8,8);
+      std::memcpy(&data[offset+4*pos],&val,4);
+    }
+    return data;
+  };
+  std::vector<std::string> bincorrupt;
+  bincorrupt.push_back(bindata.substr(0,bindata.size()/2));
+  bincorrupt.push_back(binpatch(bindata,"STAT",0,3));
+  bincorrupt.push_back(binpatch(bindata,"TREV",0,100000));
+  bincorrupt.push_back(binpatch(bindata,"TRX2",0,99));
+  bool binrejected=true;
+  for(std::size_t i=0; i<bincorrupt.size(); ++i) {
+    std::ofstream binout("tmp_corrupt.fbg", std::ios::out|std::ios::binary|std::ios::trunc);
+    binout.write(bincorrupt[i].data(),bincorrupt[i].size());
+    binout.close();
+    try {
+      System sbincorrupt;
+      BinaryRead("tmp_corrupt.fbg",sbincorrupt);
+      binrejected=false;
+    } catch(Exception& ex) {
+      if(ex.Id()!=50) binrejected=false;
+    }
+  }
+  try {
+    BinaryGenerator bgen("tmp_csimplemachine.fbg");
+    bgen.State(bgen.Size());
+    binrejected=false;
+  } catch(Exception& ex) {
+    if(ex.Id()!=62) binrejected=false;
+  }
+  if(binrejected) 
+    std::cout << "binary corrupted files: rejected [expected]\n";
+  else
+    std::cout << "binary corrupted files: accepted [error]\n";
+
+  // load the transition relation in compact representation, i.e., without a TransSet
+  CompactTransSet bintrans;
+  BinaryGenerator("tmp_csimplemachine.fbg").TransRel(bintrans);
+  TransSet bintransback;
+  bintrans.ToTransSet(bintransback);
+  bool compactok = bintransback==sbin.TransRel();
+  // insertion out of order is merged on the next query; positions per state
+  CompactTransSet ctrans;
+  ctrans.Insert(7,3,2);
+  ctrans.Insert(2,5,1);
+  ctrans.Insert(2,3,9);
+  ctrans.Insert(7,3,2);
+  compactok = compactok && ctrans.Size()==3 && ctrans.MaxX1()==7;
+  compactok = compactok && ctrans.Exists(2,3,9) && !ctrans.Exists(2,3,1);
+  compactok = compactok && ctrans.End(2)-ctrans.Begin(2)==2 && ctrans.Begin(5)==ctrans.End(5);
+  compactok = compactok && ctrans.X1(2)==7 && ctrans.Ev(ctrans.Begin(2,5))==5;
+  // invalid indices are rejected
+  try {
+    ctrans.Insert(0,3,2);
+    compactok=false;
+  } catch(Exception& ex) {
+    if(ex.Id()!=61) compactok=false;
+  }
+  if(compactok)
+    std::cout << "binary to compact transitions: ok [expected]\n";
+  else
+    std::cout << "binary to compact transitions: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("binary roundtrip",binok);
+  FAUDES_TEST_DUMP("binary rejected",binrejected);
+  FAUDES_TEST_DUMP("binary compact",compactok);
+
+
+  ///////////////////////////////////
+  // Token input
+  ///////////////////////////////////
+
+  // the tokenizer scans white space, comments and strings on the stream buffer and 
+  // interprets plain decimal integers up to 15 digits by a fast path
+  std::cout << "################################\n";
+  std::cout << "# tutorial, token input \n";
+  TokenReader tokr(TokenReader::String,
+    "12 0 123456789 123456789012345 1234567890123456 -17 0x1F 3.25 12a % comment \n"
+    "\"quoted string\" <Tag value=\"42\"> </Tag> last");
+  Token tok;
+  bool tokok=true;
+  tokok = tokok && tokr.Get(tok) && tok.IsInteger() && tok.IntegerValue()==12;
+  tokok = tokok && tokr.Get(tok) && tok.IsInteger() && tok.IntegerValue()==0;
+  tokok = tokok && tokr.Get(tok) && tok.IsInteger() && tok.IntegerValue()==123456789;
+  tokok = tokok && tokr.Get(tok) && tok.IsFloat() && tok.FloatValue()==123456789012345.0;
+  if(sizeof(Int)>=8) tokok = tokok && tok.IsInteger() && tok.IntegerValue()==(Int) 123456789012345LL;
+  tokok = tokok && tokr.Get(tok) && tok.IsFloat() && tok.FloatValue()==1234567890123456.0;
+  tokok = tokok && tokr.Get(tok) && !tok.IsInteger() && tok.IsFloat() && tok.FloatValue()==-17;
+  tokok = tokok && tokr.Get(tok) && tok.IsInteger16() && tok.IntegerValue()==31;
+  tokok = tokok && tokr.Get(tok) && tok.IsFloat() && tok.FloatValue()==3.25;
+  tokok = tokok && tokr.Get(tok) && tok.IsString() && !tok.IsFloat() && tok.StringValue()=="12a";
+  tokok = tokok && tokr.Get(tok) && tok.IsString() && tok.StringValue()=="quoted string";
+  tokok = tokok && tokr.Get(tok) && tok.IsBegin("Tag") && tok.AttributeIntegerValue("value")==42;
+  tokok = tokok && tokr.Get(tok) && tok.IsEnd("Tag");
+  tokok = tokok && tokr.Get(tok) && tok.IsString() && tok.StringValue()=="last";
+  tokok = tokok && !tokr.Get(tok) && tokr.Line()==2;
+  if(tokok) 
+    std::cout << "token input: ok [expected]\n";
+  else
+    std::cout << "token input: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("token input",tokok);
+
+
+  ///////////////////////////////////
+  // Parallel parsing of the transition relation
+  ///////////////////////////////////
+
+  // read a generator large enough for several chunks by worker threads and sequentially
+  std::cout << "################################\n";
+  std::cout << "# tutorial, parallel parsing \n";
+  Generator gpsrc;
+  Idx gpa=gpsrc.InsEvent("a");
+  Idx gpb=gpsrc.InsEvent("b");
+  for(Idx x=1; x<=5000; ++x) gpsrc.InsState("s"+ToStringInteger(x));
+  for(Idx x=1; x<=5000; ++x) {
+    gpsrc.SetTransition(x,gpa,(7*x)%5000+1);
+    gpsrc.SetTransition(x,gpb,(13*x)%5000+1);
+    gpsrc.SetTransition(x,gpb,x);
+  }
+  gpsrc.InsInitState(5001);
+  gpsrc.SetTransition(5001,gpa,1);
+  gpsrc.Write("tmp_parallel.gen");
+  Generator gpseq;
+  Generator gppar;
+  GeneratorReadThreads(0);
+  gpseq.Read("tmp_parallel.gen");
+  GeneratorReadThreads(4);
+  gppar.Read("tmp_parallel.gen");
+  bool parok = gpseq.TransRel()==gppar.TransRel() && gpseq.States()==gppar.States();
+  parok = parok && gpseq.TransRel()==gpsrc.TransRel() && gppar.Size()==5001;
+  // a malformed file is rejected by both readers, the parallel reader reports the
+  // line of the offending transition
+  std::ofstream gpbad("tmp_parallel_bad.gen");
+  gpbad << "<Generator>\n\"bad\"\n<Alphabet> a b </Alphabet>\n<States> 1 2 3 </States>\n";
+  gpbad << "<TransRel>\n1 a 2\n2 b 3\n3 c 1\n</TransRel>\n</Generator>\n";
+  gpbad.close();
+  for(unsigned int threads=0; threads<=4; threads+=4) {
+    GeneratorReadThreads(threads);
+    try {
+      Generator gbad("tmp_parallel_bad.gen");
+      parok=false;
+    } catch(Exception& ex) {
+      if(threads>0 && std::string(ex.What()).find("tmp_parallel_bad.gen:8)")==std::string::npos) parok=false;
+    }
+  }
+  GeneratorReadThreads(0);
+  if(parok) 
+    std::cout << "parallel parsing: ok [expected]\n";
+  else
+    std::cout << "parallel parsing: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("parallel parsing",parok);
+
+
+  ///////////////////////////////////
+  // Gzip compressed files
+  ///////////////////////////////////
+
+  // token files with suffix ".gz" are written compressed and sensed on reading 
+  // (requires zlib, otherwise ".gz" files are rejected)
+  std::cout << "################################\n";
+  std::cout << "# tutorial, gzip compressed files \n";
+  Generator ggz("data/simplemachine.gen");
+  bool gzok = true;
+  if(GzSupported()) {
+    ggz.Write("tmp_simplemachine.gen.gz");
+    Generator ggzback("tmp_simplemachine.gen.gz");
+    gzok = gzok && ggz.ToText()==ggzback.ToText();
+    // xml format
+    ggz.XWrite("tmp_simplemachine.xml.gz");
+    ggzback.Clear();
+    ggzback.Read("tmp_simplemachine.xml.gz");
+    gzok = gzok && ggz.TransRel()==ggzback.TransRel() && ggz.States()==ggzback.States();
+    // seek backwards, i.e., decompress again from the beginning
+    TokenReader gztr("tmp_simplemachine.gen.gz");
+    gztr.SeekBegin("TransRel");
+    gztr.ReadBegin("TransRel");
+    gztr.Rewind();
+    gztr.SeekBegin("Alphabet");
+    EventSet gzalph;
+    gzalph.Read(gztr);
+    gzok = gzok && gzalph==ggz.Alphabet();
+    // appending to a gzip file is rejected
+    try {
+      TokenWriter gztw("tmp_simplemachine.gen.gz", std::ios::out|std::ios::app);
+      gzok=false;
+    } catch(Exception& ex) {
+      if(ex.Id()!=2) gzok=false;
+    }
+  } else {
+    // without zlib, gzip output is rejected
+    try {
+      ggz.Write("tmp_simplemachine.gen.gz");
+      gzok=false;
+    } catch(Exception& ex) {
+      if(ex.Id()!=2) gzok=false;
+    }
+  }
+  if(gzok) 
+    std::cout << "gzip roundtrip: ok [expected]\n";
+  else
+    std::cout << "gzip roundtrip: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("gzip roundtrip",gzok);
+
+
+  ///////////////////////////////////
+  // Copies share state names
+  ///////////////////////////////////
+
+  // copies share the state symbol table until either side is modified
+  std::cout << "################################\n";
+  std::cout << "# tutorial, copies share state names \n";
+  Generator gnamed("data/simplemachine.gen");
+  Generator gcopy=gnamed;
+  bool cowok = (gcopy.StateSymbolTable().Size()==gnamed.StateSymbolTable().Size());
+  StateSet::Iterator cowit;
+  for(cowit=gnamed.StatesBegin(); cowit!=gnamed.StatesEnd(); ++cowit)
+    cowok = cowok && (gcopy.StateName(*cowit)==gnamed.StateName(*cowit));
+  // renaming a state in the copy leaves the original intact
+  Idx cowidle=gnamed.StateIndex("idle");
+  gcopy.StateName(cowidle,"resting");
+  cowok = cowok && (gnamed.StateName(cowidle)=="idle") && (gcopy.StateName(cowidle)=="resting");
+  cowok = cowok && (gnamed.StateIndex("resting")==0) && (gcopy.StateIndex("idle")==0);
+  // deleting a state in the original leaves the copy intact
+  Idx cowdown=gnamed.StateIndex("down");
+  gnamed.DelState(cowdown);
+  cowok = cowok && (gnamed.StateIndex("down")==0) && (gnamed.StateSymbolTable().Size()==2);
+  cowok = cowok && (gcopy.StateName(cowdown)=="down") && (gcopy.StateSymbolTable().Size()==3);
+  // assignment replaces all state names of the destination by those of the source
+  Generator gother;
+  gother.InsState("x");
+  gother.InsState("y");
+  gother.InsState("z");
+  gother.InsState("w");
+  gother=gnamed;
+  cowok = cowok && (gother.StateSymbolTable().Size()==gother.Size());
+  cowok = cowok && (gother.StateIndex("x")==0) && (gother.StateIndex("w")==0);
+  for(cowit=gother.StatesBegin(); cowit!=gother.StatesEnd(); ++cowit)
+    cowok = cowok && (gother.StateName(*cowit)==gnamed.StateName(*cowit));
+  // new states in the copy get fresh names and indices
+  Idx cownew=gother.InsState("fresh");
+  cowok = cowok && !gnamed.ExistsState(cownew) && (gnamed.StateIndex("fresh")==0);
+  if(cowok) 
+    std::cout << "copies share state names: ok [expected]\n";
+  else
+    std::cout << "copies share state names: failed [error]\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("shared state names",cowok);
+  FAUDES_TEST_DUMP("shared state names copy",gcopy);
+
+
   ///////////////////////////////////
   // Test case evaluation
   ///////////////////////////////////
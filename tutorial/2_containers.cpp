@@ -27,6 +27,68 @@ so you may prefer generator methods for file IO)
 using namespace faudes;
 
 
+// attribute allocation across threads: task record
+struct AttrTask {
+  int mCount;
+  std::vector<AttributeFlags*> mRelease;
+  std::vector<AttributeFlags*> mAttrs;
+  TaStateSet<AttributeFlags>* mpSet;
+};
+
+// attribute allocation across threads: release attributes handed over by another 
+// thread, allocate attributes and an attributed set (thread function)
+void* AttrWorker(void* pArg) {
+  AttrTask* task = static_cast<AttrTask*>(pArg);
+  for(std::size_t i=0; i<task->mRelease.size(); ++i) delete task->mRelease[i];
+  task->mRelease.clear();
+  for(int i=0; i<task->mCount; ++i) {
+    AttributeFlags* attr = new AttributeFlags();
+    attr->mFlags = i;
+    task->mAttrs.push_back(attr);
+  }
+  task->mpSet = new TaStateSet<AttributeFlags>();
+  for(int i=1; i<=task->mCount; ++i) {
+    task->mpSet->Insert(i);
+    task->mpSet->Attributep(i)->mFlags = i;
+  }
+  return NULL;
+}
+
+// attribute allocation across threads: run worker in a thread of its own
+void AttrRun(AttrTask& rTask) {
+#ifdef FAUDES_THREADS
+  faudes_thread_t thread;
+  if(faudes_thread_create(&thread,AttrWorker,&rTask) == FAUDES_THREAD_SUCCESS) {
+    faudes_thread_join(thread,NULL);
+    return;
+  }
+#endif
+  AttrWorker(&rTask);
+}
+
+// global event symbol table shared by threads: task record
+struct SymTask {
+  int mId;
+  int mCount;
+  std::vector<Idx> mCommon;
+  bool mOk;
+};
+
+// global event symbol table shared by threads: insert private names and names 
+// common to all threads, look them up again (thread function)
+void* SymWorker(void* pArg) {
+  SymTask* task = static_cast<SymTask*>(pArg);
+  SymbolTable* symtab = SymbolTable::GlobalEventSymbolTablep();
+  task->mOk=true;
+  for(int i=0; i<task->mCount; ++i) {
+    std::string name = "sym_" + ToStringInteger(task->mId) + "_" + ToStringInteger(i);
+    Idx idx = symtab->InsEntry(name);
+    task->mCommon.push_back(symtab->InsEntry("sym_common_" + ToStringInteger(i)));
+    task->mOk = task->mOk && (symtab->Symbol(idx) == name) && (symtab->Index(name) == idx);
+  }
+  return NULL;
+}
+
 
 int main() {
 
@@ -340,6 +402,42 @@ int main() {
   // record
   FAUDES_TEST_DUMP("vect element cast",vcast);
 
+  // Move entries: append by move, construct in place, take out of the vector
+  EventSet alphabet5=alphabet1;
+  alphvect.Append(std::move(alphabet5));
+  alphvect.Emplace().Insert("epsilon");
+  EventSet* palph=alphvect.Take(0);
+
+  // Report
+  std::cout << "# entry taken from vector:\n";
+  palph->Write();
+  std::cout << "# remaining event sets:\n";
+  alphvect.Write();
+
+  // record
+  FAUDES_TEST_DUMP("vect take",palph->ToText());
+  FAUDES_TEST_DUMP("vect move",alphvect.ToText());
+  delete palph;
+
+  // Same for generators: append by Move(), read from file in place, move out of the vector
+  GeneratorVector genvect;
+  Generator mgen("data/simplemachine.gen");
+  genvect.Append(std::move(mgen));
+  genvect.Emplace("data/csimplemachine.gen");
+  Generator tgen;
+  genvect.Take(0,tgen);
+
+  // Report
+  std::cout << "# generator taken from vector:\n";
+  tgen.Write();
+  std::cout << "# remaining generators: " << genvect.Size() << "\n";
+
+  // record
+  FAUDES_TEST_DUMP("genvect moved-from",(long int) mgen.Size());
+  FAUDES_TEST_DUMP("genvect take",tgen.ToText());
+  FAUDES_TEST_DUMP("genvect emplace",genvect.At(0).ToText());
+  FAUDES_TEST_DUMP("genvect size",(long int) genvect.Size());
+
 
   // Done
   std::cout << "################################\n";
@@ -422,6 +520,315 @@ int main() {
   FAUDES_TEST_DUMP("deferred copy B - 3",setB);
   FAUDES_TEST_DUMP("deferred copy C - 3",setC);
 
+  ////////////////////////////////////////////////////
+  // Set algebra on sets with non-default order
+  ////////////////////////////////////////////////////
+
+  // pseudo random transitions sorted by x2
+  TransSetX2EvX1 transA, transB;
+  unsigned int seed=1;
+  for(int i=0; i<200; ++i) {
+    seed = seed*1103515245 + 12345;
+    Transition trans(1+(seed>>16)%10, 1+(seed>>8)%3, 1+(seed>>20)%10);
+    transA.Insert(trans);
+    if(i%3==0) transB.Insert(trans);
+    if(i%5==0) transB.Insert(Transition(trans.X2,trans.Ev,trans.X1));
+  }
+
+  // reference results by element-wise operations
+  TransSetX2EvX1 transDiffRef, transInterRef, transUnionRef;
+  TransSetX2EvX1::Iterator tit=transA.Begin();
+  for(; tit!=transA.End(); ++tit) {
+    if(transB.Exists(*tit)) transInterRef.Insert(*tit);
+    else transDiffRef.Insert(*tit);
+    transUnionRef.Insert(*tit);
+  }
+  for(tit=transB.Begin(); tit!=transB.End(); ++tit) 
+    transUnionRef.Insert(*tit);
+
+  // bulk operations (EraseSet used to loop forever on this order)
+  TransSetX2EvX1 transErase=transA;
+  transErase.EraseSet(transB);
+  TransSetX2EvX1 transRestrict=transA;
+  transRestrict.RestrictSet(transB);
+  TransSetX2EvX1 transInsert=transA;
+  transInsert.InsertSet(transB);
+  bool transok = true;
+  transok = transok && (transErase == transDiffRef);
+  transok = transok && (transRestrict == transInterRef);
+  transok = transok && (transInsert == transUnionRef);
+  transok = transok && (transA - transB == transDiffRef);
+  transok = transok && (transA * transB == transInterRef);
+  transok = transok && (transA + transB == transUnionRef);
+
+  // operators with an operand that shares data with the result
+  TransSetX2EvX1 transShared=transA;
+  transok = transok && (transA - transShared).Empty();
+  transok = transok && (transA * transShared == transA);
+  transok = transok && (transA + transShared == transA);
+  StateSet sharedA;
+  for(Idx state=1; state<=20; ++state) sharedA.Insert(state);
+  StateSet sharedB=sharedA;
+  transok = transok && (sharedA - sharedB).Empty();
+  transok = transok && (sharedA * sharedB == sharedA);
+  transok = transok && (sharedA + sharedB == sharedA);
+  transok = transok && (sharedA.Size()==20) && (sharedB.Size()==20);
+
+  // report
+  std::cout << "################################\n";
+  std::cout << "# set algebra on transitions sorted by x2: " << (transok ? "passed" : "failed") << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("trans algebra",transok);
+  FAUDES_TEST_DUMP("trans difference",(long int) transDiffRef.Size());
+  FAUDES_TEST_DUMP("trans intersection",(long int) transInterRef.Size());
+  FAUDES_TEST_DUMP("trans union",(long int) transUnionRef.Size());
+
+
+  ////////////////////////////////////////////////////
+  // Read-only views
+  ////////////////////////////////////////////////////
+
+  // same transitions sorted by x1
+  TransSet transX1;
+  for(tit=transA.Begin(); tit!=transA.End(); ++tit) 
+    transX1.Insert(*tit);
+
+  // views see the same elements as tracked iterators
+  bool viewok = true;
+  TransSet::ConstView view(transX1);
+  viewok = viewok && (view.Size()==transX1.Size()) && !view.Empty();
+  TransSet::ConstView::Iterator vit=view.Begin();
+  TransSet::Iterator xit=transX1.Begin();
+  for(; xit!=transX1.End(); ++xit, ++vit) 
+    viewok = viewok && (vit!=view.End()) && (*vit == *xit);
+  viewok = viewok && (vit==view.End());
+
+  // per state ranges match those of the transition set
+  TransSetX2EvX1::ConstView rview(transA);
+  for(Idx x=1; x<=11; ++x) {
+    for(Idx ev=0; ev<=3; ++ev) {
+      vit = (ev==0 ? view.Begin(x) : view.Begin(x,ev)); 
+      xit = (ev==0 ? transX1.Begin(x) : transX1.Begin(x,ev)); 
+      TransSet::ConstView::Iterator vit_end = (ev==0 ? view.End(x) : view.End(x,ev)); 
+      TransSet::Iterator xit_end = (ev==0 ? transX1.End(x) : transX1.End(x,ev)); 
+      for(; xit!=xit_end; ++xit, ++vit) 
+        viewok = viewok && (vit!=vit_end) && (*vit == *xit);
+      viewok = viewok && (vit==vit_end);
+    }
+    TransSetX2EvX1::ConstView::Iterator rvit = rview.BeginByX2(x);
+    TransSetX2EvX1::Iterator rxit = transA.BeginByX2(x);
+    for(; rxit!=transA.EndByX2(x); ++rxit, ++rvit) 
+      viewok = viewok && (rvit!=rview.EndByX2(x)) && (*rvit == *rxit);
+    viewok = viewok && (rvit==rview.EndByX2(x));
+  }
+  viewok = viewok && view.Exists(*transX1.Begin()) && !view.Exists(Transition(11,1,1));
+  viewok = viewok && (view.Find(Transition(11,1,1))==view.End());
+
+  // view on a detached set remains valid while inserting to the set
+  StateSet viewset;
+  for(Idx state=1; state<=20; state+=2) viewset.Insert(state);
+  viewset.Detach();
+  StateSet::ConstView sview(viewset);
+  Idx viewcnt=0;
+  StateSet::ConstView::Iterator svit=sview.Begin();
+  for(; svit!=sview.End(); ++svit) 
+    if(*svit%2==1) { viewset.Insert(*svit+1); ++viewcnt; }
+  viewok = viewok && (viewcnt==10) && (viewset.Size()==20) && (sview.Size()==20);
+
+  // report
+  std::cout << "################################\n";
+  std::cout << "# read-only views: " << (viewok ? "passed" : "failed") << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("views",viewok);
+
+
+  ////////////////////////////////////////////////////
+  // Attribute allocation across threads
+  ////////////////////////////////////////////////////
+
+  // attributes allocated by one thread are released by another thread, 
+  // for several rounds, each with more attributes than a thread keeps for reuse
+  bool poolok = true;
+  std::vector<AttributeFlags*> mattrs;
+  for(int round=0; round<8; ++round) {
+    AttrTask task;
+    task.mCount=5000;
+    task.mRelease.swap(mattrs);
+    AttrRun(task);
+    for(int i=0; i<task.mCount; ++i) {
+      poolok = poolok && (task.mAttrs[i]->mFlags == (fType) i);
+      delete task.mAttrs[i];
+    }
+    poolok = poolok && (task.mpSet->Size() == (Idx) task.mCount);
+    poolok = poolok && (task.mpSet->Attribute(7).mFlags == 7);
+    poolok = poolok && (task.mpSet->Attribute(task.mCount).mFlags == (fType) task.mCount);
+    delete task.mpSet;
+    for(int i=0; i<task.mCount; ++i) {
+      AttributeFlags* attr = new AttributeFlags();
+      attr->mFlags = i+round;
+      mattrs.push_back(attr);
+    }
+  }
+  for(std::size_t i=0; i<mattrs.size(); ++i) {
+    poolok = poolok && (mattrs[i]->mFlags == (fType) (i+7));
+    delete mattrs[i];
+  }
+
+  // report
+  std::cout << "################################\n";
+  std::cout << "# attribute allocation across threads: " << (poolok ? "passed" : "failed") << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("attribute pool",poolok);
+
+
+  ////////////////////////////////////////////////////
+  // Symbol tables
+  ////////////////////////////////////////////////////
+
+  // state names with dense and sparse indices
+  bool symok = true;
+  SymbolTable symtab;
+  for(Idx i=1; i<=5000; ++i) 
+    symtab.InsEntry(i, "s" + ToStringInteger(i));
+  symtab.InsEntry(10000000, "far");
+  symok = symok && (symtab.Size()==5001) && (symtab.LastIndex()==10000000);
+
+  // erase every other entry, so that the hash index has deleted slots
+  for(Idx i=2; i<=5000; i+=2) 
+    symtab.ClrEntry(i);
+  symtab.ClrEntry("far");
+  for(Idx i=1; i<=5000; ++i) {
+    symok = symok && (symtab.Exists(i) == (i%2==1));
+    symok = symok && (symtab.Exists("s" + ToStringInteger(i)) == (i%2==1));
+  }
+  symok = symok && !symtab.Exists(10000000) && (symtab.Index("far")==0);
+
+  // reuse deleted slots and rename
+  for(Idx i=2; i<=5000; i+=2) 
+    symtab.InsEntry(i, "t" + ToStringInteger(i));
+  symtab.SetEntry(1, "first");
+  for(Idx i=2; i<=5000; ++i) {
+    std::string name = (i%2==1 ? "s" : "t") + ToStringInteger(i);
+    symok = symok && (symtab.Index(name)==i) && (symtab.Symbol(i)==name);
+  }
+  symok = symok && (symtab.Index("first")==1) && (symtab.Index("s1")==0);
+  symok = symok && (symtab.Size()==5000);
+
+  // copies share entries until either is modified
+  SymbolTable symcopy(symtab);
+  symcopy.ClrEntry(3);
+  symcopy.InsEntry("extra");
+  symok = symok && symtab.Exists(3) && !symtab.Exists("extra");
+  symok = symok && !symcopy.Exists(3) && (symcopy.Index("extra")==symcopy.LastIndex());
+  symok = symok && (symtab.LastIndex()==10000000);
+
+  // global event symbol table shared by threads
+  std::vector<SymTask> symtasks(4);
+  for(std::size_t t=0; t<symtasks.size(); ++t) {
+    symtasks[t].mId=t;
+    symtasks[t].mCount=500;
+  }
+#ifdef FAUDES_THREADS
+  std::vector<faudes_thread_t> symthreads(symtasks.size());
+  std::vector<bool> symrunning(symtasks.size());
+  for(std::size_t t=0; t<symtasks.size(); ++t) 
+    symrunning[t] = (faudes_thread_create(&symthreads[t],SymWorker,&symtasks[t]) == FAUDES_THREAD_SUCCESS);
+  for(std::size_t t=0; t<symtasks.size(); ++t) {
+    if(symrunning[t]) faudes_thread_join(symthreads[t],NULL);
+    else SymWorker(&symtasks[t]);
+  }
+#else
+  for(std::size_t t=0; t<symtasks.size(); ++t) 
+    SymWorker(&symtasks[t]);
+#endif
+  SymbolTable* gsymtab = SymbolTable::GlobalEventSymbolTablep();
+  for(std::size_t t=0; t<symtasks.size(); ++t) {
+    symok = symok && symtasks[t].mOk;
+    symok = symok && (symtasks[t].mCommon == symtasks[0].mCommon);
+    for(int i=0; i<symtasks[t].mCount; ++i) 
+      symok = symok && gsymtab->Exists("sym_" + ToStringInteger(t) + "_" + ToStringInteger(i));
+  }
+  for(int i=0; i<symtasks[0].mCount; ++i) 
+    symok = symok && (gsymtab->Symbol(symtasks[0].mCommon[i]) == "sym_common_" + ToStringInteger(i));
+
+  // report
+  std::cout << "################################\n";
+  std::cout << "# symbol tables: " << (symok ? "passed" : "failed") << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("symbol tables",symok);
+
+
+  ////////////////////////////////////////////////////
+  // Event flag tables
+  ////////////////////////////////////////////////////
+
+  // system with all kinds of event attributes
+  System fsys("data/csimplemachine.gen");
+  fsys.ClrObservable("mue");
+  fsys.SetForcible("beta");
+  fsys.SetHighlevel("alpha");
+  fsys.InsEvent("omega");
+
+  // take the table and compare per event with the alphabet attributes
+  EventFlagTable ftable=fsys.EventFlags();
+  bool flagsok = true;
+  EventSet::Iterator fit=fsys.AlphabetBegin();
+  for(; fit!=fsys.AlphabetEnd(); ++fit) {
+    flagsok = flagsok && ftable.Exists(*fit);
+    flagsok = flagsok && (ftable.Controllable(*fit) == fsys.Controllable(*fit));
+    flagsok = flagsok && (ftable.Observable(*fit) == fsys.Observable(*fit));
+    flagsok = flagsok && (ftable.Forcible(*fit) == fsys.Forcible(*fit));
+    flagsok = flagsok && (ftable.Highlevel(*fit) == fsys.Highlevel(*fit));
+  }
+  flagsok = flagsok && (ftable.Events() == fsys.Alphabet());
+  flagsok = flagsok && (ftable.ControllableEvents() == fsys.ControllableEvents());
+  flagsok = flagsok && (ftable.ObservableEvents() == fsys.ObservableEvents());
+  flagsok = flagsok && (ftable.ForcibleEvents() == fsys.ForcibleEvents());
+  flagsok = flagsok && (ftable.HighlevelEvents() == fsys.HighlevelEvents());
+
+  // unknown events have no flags
+  Idx fbig=FAUDES_IDX_MAX-1;
+  flagsok = flagsok && !ftable.Exists(0) && !ftable.Exists(fbig);
+  flagsok = flagsok && (ftable.Flags(fbig)==0) && !ftable.Observable(fbig);
+
+  // the table is a snapshot of the alphabet
+  fsys.SetControllable("beta");
+  flagsok = flagsok && !ftable.Controllable(fsys.EventIndex("beta"));
+  flagsok = flagsok && !(ftable.ControllableEvents() == fsys.ControllableEvents());
+
+  // insert overwrites flags
+  ftable.Insert(fsys.EventIndex("beta"),AttributeCFlags::mControllableFlag);
+  flagsok = flagsok && ftable.Controllable(fsys.EventIndex("beta"));
+  flagsok = flagsok && !ftable.Observable(fsys.EventIndex("beta"));
+  flagsok = flagsok && (ftable.ControllableEvents() == fsys.ControllableEvents());
+  flagsok = flagsok && !ftable.ObservableEvents().Exists(fsys.EventIndex("beta"));
+
+  // plain event sets get uniform flags
+  EventFlagTable utable(fsys.Alphabet(),AttributeCFlags::mObservableFlag);
+  flagsok = flagsok && (utable.ObservableEvents() == fsys.Alphabet());
+  flagsok = flagsok && utable.ControllableEvents().Empty();
+  utable.Clear();
+  flagsok = flagsok && utable.Events().Empty() && !utable.Exists(fsys.EventIndex("alpha"));
+
+  // report
+  std::cout << "################################\n";
+  std::cout << "# event flag table: " << (flagsok ? "passed" : "failed") << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("event flags",flagsok);
+  FAUDES_TEST_DUMP("event flags controllable",ftable.ControllableEvents().ToText());
+  FAUDES_TEST_DUMP("event flags unobservable",(fsys.Alphabet()-ftable.ObservableEvents()).ToText());
+
+
   ////////////////////////////////////////////////////
   // Developper internal: memory leak in BaseSet
   ////////////////////////////////////////////////////
@@ -22,6 +22,24 @@ using namespace faudes;
 
 
 
+// render partition for the test protocol, classes ordered by their least state
+std::string PartitionString(const std::list<StateSet>& rPartition) {
+  std::map<Idx,std::string> classes;
+  std::list<StateSet>::const_iterator pit=rPartition.begin();
+  for(;pit!=rPartition.end();++pit) {
+    std::string cstr;
+    StateSet::Iterator sit=pit->Begin();
+    for(;sit!=pit->End();++sit) 
+      cstr+= (cstr.empty() ? "{" : ",") + ToStringInteger(*sit);
+    classes[*pit->Begin()]=cstr+"}";
+  }
+  std::string res;
+  std::map<Idx,std::string>::iterator cit=classes.begin();
+  for(;cit!=classes.end();++cit) res+= (res.empty() ? "" : " ") + cit->second;
+  return res;
+}
+
+
 /////////////////
 // main program
 /////////////////
@@ -75,6 +93,35 @@ int main() {
   // Test protocol
   FAUDES_TEST_DUMP("minimal",minimal_min);
 
+  // minimize in-place (representative states are maintained)
+  Generator minimal_inplace(minimal_nonmin);
+  StateMin(minimal_inplace);
+  FAUDES_TEST_DUMP("minimal in-place",minimal_inplace);
+
+  // compare structure: both results are isomorphic, however, with different state indices
+  bool minimal_iso = IsIsomorphic(minimal_min,minimal_inplace);
+  bool minimal_fp = (Fingerprint(minimal_min) == Fingerprint(minimal_inplace));
+  bool minimal_niso = IsIsomorphic(minimal_min,minimal_nonmin);
+
+  // report result to console
+  std::cout << "################################\n";
+  std::cout << "# minimal generators \n";
+  std::cout << "# fingerprint " << Fingerprint(minimal_min).Str() << "\n";
+  if(minimal_iso && minimal_fp) 
+     std::cout << "# isomorphism test: passed (expected)\n";
+  else
+     std::cout << "# isomorphism test: failed (test case error!)\n";
+  if(minimal_niso) 
+     std::cout << "# isomorphism test with non-minimal: passed (test case error!)\n";
+  else
+     std::cout << "# isomorphism test with non-minimal: failed (expected)\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("minimal isomorphic",minimal_iso);
+  FAUDES_TEST_DUMP("minimal fingerprint",minimal_fp);
+  FAUDES_TEST_DUMP("minimal non-isomorphic",minimal_niso);
+
   ////////////////////////////
   // project
   ////////////////////////////
@@ -145,6 +192,38 @@ int main() {
   // Test protocol
   FAUDES_TEST_DUMP("parallel",parallel_g1g2);
 
+  // perform composition with aliased arguments, incl. composed state names
+  Generator parallel_alias=parallel_g1;
+  Parallel(parallel_alias, parallel_g2, parallel_alias);
+  bool parallel_aliasok = (parallel_alias.ToText()==parallel_g1g2.ToText());
+  if(parallel_aliasok) 
+     std::cout << "# parallel with aliased arguments: passed (expected)\n";
+  else
+     std::cout << "# parallel with aliased arguments: failed (test case error!)\n";
+  FAUDES_TEST_DUMP("parallel aliased",parallel_aliasok);
+
+  // perform composition within an execution budget of two states
+  Generator parallel_partial;
+  long int parallel_exid=0;
+  {
+    ExecutionBudget budget;
+    budget.MaxStates(2);
+    budget.PartialResult(true);
+    try {
+      Parallel(parallel_g1, parallel_g2, parallel_partial);
+    } catch(const Exception& exception) {
+      parallel_exid=exception.Id();
+    }
+    std::cout << "################################\n";
+    std::cout << "# parallel composition within budget: exceeded (" << budget.Reason() << ")\n";
+    parallel_partial.DWrite();
+    std::cout << "################################\n";
+  }
+
+  // Test protocol
+  FAUDES_TEST_DUMP("parallel budget",parallel_exid);
+  FAUDES_TEST_DUMP("parallel partial",parallel_partial);
+
 
   ////////////////////////////
   // boolean language operations
@@ -491,6 +570,139 @@ int main() {
   std::cout << "################################\n";
 
 
+  ////////////////////////////
+  // silent transitions
+  ////////////////////////////
+
+  // read generator with silent loops
+  Generator silent_g("data/silent_g.gen");
+  EventSet silent_tau;
+  silent_tau.Insert("tau");
+
+  // saturate: delayed (half) and observed (full) transitions
+  Generator silent_delayed=silent_g;
+  ExtendTransRel(silent_delayed,silent_tau,1);
+  Generator silent_observed=silent_g;
+  ExtendTransRel(silent_observed,silent_tau,2);
+
+  // bisimulation on saturated generator with silent selfloops
+  Generator silent_sat=silent_observed;
+  InstallSelfloops(silent_sat,silent_tau);
+  std::list<StateSet> silent_satpart;
+  ComputeBisimulationCTA(silent_sat,silent_satpart);
+
+  // same partition obtained with on-the-fly saturation 
+  std::list<StateSet> silent_weakpart;
+  ComputeWeakBisimulationSatCTA(silent_g,silent_tau,silent_weakpart);
+  std::list<StateSet> silent_delayedpart;
+  ComputeDelayedBisimulationSatCTA(silent_g,silent_tau,silent_delayedpart);
+
+  // report result to console
+  std::cout << "################################\n";
+  std::cout << "# saturated transitions (observed)\n";
+  silent_observed.WriteTransRel();
+  std::cout << "# weak bisimulation " << PartitionString(silent_weakpart) << "\n";
+  std::cout << "# delayed bisimulation " << PartitionString(silent_delayedpart) << "\n";
+  std::cout << "################################\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("silent saturation 1",silent_delayed.TransRelToText());
+  FAUDES_TEST_DUMP("silent saturation 2",silent_observed.TransRelToText());
+  FAUDES_TEST_DUMP("silent saturated",PartitionString(silent_satpart));
+  FAUDES_TEST_DUMP("silent weak",PartitionString(silent_weakpart));
+  FAUDES_TEST_DUMP("silent delayed",PartitionString(silent_delayedpart));
+
+
+  // bisimulation by both available algorithms on a selection of generators
+  const char* bisim_files[] = {"data/silent_g.gen", "data/minimal_nonmin.gen", 
+    "data/deterministic_nondet.gen", "data/noblo_yt1.gen", "data/noblo_g9.gen", "data/noblo_g10.gen"};
+  std::string bisim_parts;
+  bool bisim_agree=true;
+  for(int i=0; i<10; ++i) {
+    Generator bisim_g;
+    // generators from file
+    if(i<6) bisim_g.Read(bisim_files[i]);
+    // saturated generator from above
+    if(i==6) bisim_g=silent_sat;
+    // pseudo random generators with 30 states, nondeterministic and partial
+    if(i>6) {
+      unsigned int seed=i;
+      bisim_g.InsEvent("a");
+      bisim_g.InsEvent("b");
+      for(Idx q=1; q<=30; ++q) bisim_g.InsState(q);
+      bisim_g.SetInitState(1);
+      for(Idx q=1; q<=30; ++q) {
+        seed = seed*1103515245 + 12345;
+        if((seed>>16)%3==0) bisim_g.SetMarkedState(q);
+        for(int t=0; t<3; ++t) {
+          seed = seed*1103515245 + 12345;
+          Idx x2 = 1 + (seed>>16)%30;
+          unsigned int ev = (seed>>8)%3;
+          if(ev<2) bisim_g.SetTransition(q, bisim_g.EventIndex(ev==0 ? "a" : "b"), x2);
+        }
+      }
+    }
+    std::list<StateSet> bisim_fpart, bisim_ptpart;
+    BisimulationAlgorithm("fernandez");
+    ComputeBisimulation(bisim_g,bisim_fpart);
+    BisimulationAlgorithm("paigetarjan");
+    ComputeBisimulation(bisim_g,bisim_ptpart);
+    if(PartitionString(bisim_fpart)!=PartitionString(bisim_ptpart)) bisim_agree=false;
+    bisim_parts += PartitionString(bisim_fpart) + "; ";
+  }
+  BisimulationAlgorithm("fernandez");
+  if(bisim_agree) 
+     std::cout << "# bisimulation algorithms agree: passed (expected)\n";
+  else
+     std::cout << "# bisimulation algorithms agree: failed (test case error!)\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("bisimulation partitions",bisim_parts);
+  FAUDES_TEST_DUMP("bisimulation agree",bisim_agree);
+
+  // signature refinement with worker threads vs sequential change tracking
+  Generator bisim_large;
+  bisim_large.InsEvent("a");
+  bisim_large.InsEvent("b");
+  for(Idx q=1; q<=5000; ++q) bisim_large.InsState(q);
+  bisim_large.SetInitState(1);
+  for(Idx k=0; k<100; ++k) {
+    // 100 copies of one pseudo random component with 50 states, i.e.,
+    // each state is bisimilar at least to its 99 counterparts
+    unsigned int seed=1;
+    for(Idx q=1; q<=50; ++q) {
+      seed = seed*1103515245 + 12345;
+      if((seed>>16)%7==0) bisim_large.SetMarkedState(50*k+q);
+      if(q<50) bisim_large.SetTransition(50*k+q, bisim_large.EventIndex("a"), 50*k+q+1);
+      seed = seed*1103515245 + 12345;
+      if((seed>>16)%3==0)
+        bisim_large.SetTransition(50*k+q, bisim_large.EventIndex("b"), 50*k+1+(seed>>8)%50);
+    }
+  }
+  std::string bisim_threadparts;
+  long int bisim_threadclasses=0;
+  bool bisim_threadagree=true;
+  for(unsigned int threads=0; threads<=4; threads+=2) {
+    std::list<StateSet> bisim_tpart;
+    BisimulationCTAThreads(threads);
+    ComputeBisimulationCTA(bisim_large,bisim_tpart);
+    if(threads==0) {
+      bisim_threadclasses=bisim_tpart.size();
+      bisim_threadparts=PartitionString(bisim_tpart);
+    }
+    else if(PartitionString(bisim_tpart)!=bisim_threadparts) bisim_threadagree=false;
+  }
+  BisimulationCTAThreads(0);
+  if(bisim_threadagree) 
+     std::cout << "# bisimulation threads agree: passed (expected)\n";
+  else
+     std::cout << "# bisimulation threads agree: failed (test case error!)\n";
+
+  // Test protocol
+  FAUDES_TEST_DUMP("bisimulation threads",bisim_threadagree);
+  FAUDES_TEST_DUMP("bisimulation threads classes",bisim_threadclasses);
+
+
   ////////////////////////////
   // nonconflicting
   ////////////////////////////
@@ -511,6 +723,39 @@ int main() {
 
   FAUDES_TEST_DUMP("nonblocking 0", nonblocking_g);
 
+  // conflict equivalent abstraction with silent events not shared with the respective other
+  // generator, single pass and fixpoint iteration
+  std::cout << "# conflict equiv. abstract test 2 \n";
+  Generator confleq_g1("data/noblo_yt1.gen");
+  Generator confleq_g2("data/noblo_yt2.gen");
+  EventSet confleq_silent1 = confleq_g1.Alphabet() - confleq_g2.Alphabet();
+  EventSet confleq_silent2 = confleq_g2.Alphabet() - confleq_g1.Alphabet();
+  Generator confleq_g1once=confleq_g1;
+  Generator confleq_g2once=confleq_g2;
+  ConflictEquivalentAbstraction(confleq_g1once,confleq_silent1);
+  ConflictEquivalentAbstraction(confleq_g2once,confleq_silent2);
+  Generator confleq_silentonce("data/silent_g.gen");
+  ConflictEquivalentAbstraction(confleq_silentonce,silent_tau);
+  ConflictEquivalentAbstractionFixpoint(true);
+  Generator confleq_g1fix=confleq_g1;
+  Generator confleq_g2fix=confleq_g2;
+  confleq_silent1 = confleq_g1.Alphabet() - confleq_g2.Alphabet();
+  confleq_silent2 = confleq_g2.Alphabet() - confleq_g1.Alphabet();
+  ConflictEquivalentAbstraction(confleq_g1fix,confleq_silent1);
+  ConflictEquivalentAbstraction(confleq_g2fix,confleq_silent2);
+  Generator confleq_silentfix("data/silent_g.gen");
+  ConflictEquivalentAbstraction(confleq_silentfix,silent_tau);
+  ConflictEquivalentAbstractionFixpoint(false);
+  confleq_silentfix.Write();
+
+  // Test protocol
+  FAUDES_TEST_DUMP("confleq once 1", confleq_g1once.ToText());
+  FAUDES_TEST_DUMP("confleq once 2", confleq_g2once.ToText());
+  FAUDES_TEST_DUMP("confleq once 3", confleq_silentonce.ToText());
+  FAUDES_TEST_DUMP("confleq fixpoint 1", confleq_g1fix);
+  FAUDES_TEST_DUMP("confleq fixpoint 2", confleq_g2fix);
+  FAUDES_TEST_DUMP("confleq fixpoint 3", confleq_silentfix.ToText());
+
   // test cases from Michael Meyer's thesis
   // Nonblocking: 	(1,2,3,6,7); (1,2,3,4,5,6,7); (1,2,3,4,5,6); (2,4,6,8); (2,3,4,5); (5,6,7,8,9)
   // Blocking:		(3,4,5,6,7); (1,3,5,7)
@@ -102,6 +102,143 @@ int main(){
   // record test case
   FAUDES_TEST_DUMP("rti parallel",*data2);
 
+  // ******************** dataflow of function calls
+
+  // provide an alphabet to project on (ownership remains with us)
+  EventSet sigma;
+  sigma.Insert("alpha");
+  sigma.Insert("beta");
+
+  // set up flow: values are referred to by name, nodes by the order of insertion
+  DataFlow flow;
+  flow.Value("Sigma",&sigma);
+  flow.Read("M","Generator","./data/simplemachine.gen");
+  flow.Read("B","Generator","./data/buffer.gen");
+  flow.Call("Parallel",{"M","B","MB"});
+  flow.Call("Project",{"MB","Sigma","MBp"});
+  flow.Call("Deterministic",{"MBp","MBd"});
+  flow.Call("StateMin",{"MBd","MBmin"});
+  flow.Write("MBmin","tmp_flow_min.gen");
+  // an independent branch
+  flow.Read("C","Generator","./data/csimplemachine.gen");
+  flow.Call("StateMin",{"C","Cmin"});
+
+  // execute on 4 threads, and once more sequentially
+  flow.Threads(4);
+  flow.Execute();
+  std::string flowthreads = flow.Value("MBmin")->ToText();
+  flow.Threads(0);
+  flow.Execute();
+  bool flowok = (flowthreads == flow.Value("MBmin")->ToText());
+
+  // report to console
+  std::cout << "################################\n";
+  std::cout << "# tutorial, rti dataflow \n";
+  flow.DWrite();
+  flow.Value("MBmin")->Write();
+  if(flowok)
+    std::cout << " threaded and sequential execution match: ok [expected]\n";
+  else
+    std::cout << " threaded and sequential execution match: failed\n";
+  std::cout << "################################\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("rti dataflow",*flow.Value("MBmin"));
+  FAUDES_TEST_DUMP("rti dataflow threads",flowok);
+
+  // values provided by the application may share data, here a generator and its copy:
+  // the flow does not process them concurrently
+  Generator shared1("./data/simplemachine.gen");
+  Generator shared2=shared1;
+  DataFlow sflow;
+  sflow.Value("G1",&shared1);
+  sflow.Value("G2",&shared2);
+  sflow.Call("StateMin",{"G1","G1min"});
+  sflow.Call("StateMin",{"G2","G2min"});
+  sflow.Call("Deterministic",{"G1min","G1d"});
+  sflow.Call("Deterministic",{"G2min","G2d"});
+  sflow.Threads(4);
+  sflow.Execute();
+  bool sflowok = (sflow.Value("G1d")->ToText() == sflow.Value("G2d")->ToText());
+  sflowok = sflowok && (shared1.ToText() == shared2.ToText());
+
+  // report to console
+  std::cout << "################################\n";
+  std::cout << "# tutorial, rti dataflow on shared values \n";
+  if(sflowok)
+    std::cout << " results match: ok [expected]\n";
+  else
+    std::cout << " results match: failed\n";
+  std::cout << "################################\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("rti dataflow shared",sflowok);
+
+  // ******************** result cache
+
+  // enable cache (by default, Parallel, Project, Deterministic and StateMin are cacheable)
+  ResultCache::G()->Enabled(true);
+
+  // execute flow twice: first run records results, second run looks them up
+  flow.Execute();
+  Idx cachemisses=ResultCache::G()->Misses();
+  flow.Execute();
+  Idx cachehits=ResultCache::G()->Hits();
+  bool cacheok = (flowthreads == flow.Value("MBmin")->ToText());
+
+  // report to console
+  std::cout << "################################\n";
+  std::cout << "# tutorial, rti result cache \n";
+  std::cout << " cache misses on first run: " << cachemisses << "\n";
+  std::cout << " cache hits on second run: " << cachehits << "\n";
+  if(cacheok)
+    std::cout << " cached results match: ok [expected]\n";
+  else
+    std::cout << " cached results match: failed\n";
+  std::cout << "################################\n";
+
+  // keys consist of two independent hashes and the size of the arguments: provoke an entry 
+  // in the store directory under a key that only differs in the second hash
+  Generator kgen("./data/simplemachine.gen");
+  Generator kres, kget;
+  Deterministic(kgen,kres);
+  std::string key=ResultCache::Key("Deterministic",{&kgen});
+  std::string fakekey=key;
+  fakekey[16] = (fakekey[16]=='0' ? '1' : '0');
+  ResultCache::G()->Directory(".");
+  ResultCache::G()->Insert(key,{&kres});
+  FileCopy(key+".rcache",fakekey+".rcache");
+  ResultCache::G()->Clear();
+  bool keyok = (key.size()>33) && (key[32]=='-');
+  keyok = keyok && ResultCache::G()->Lookup(key,{&kget}) && (kget.ToText()==kres.ToText());
+  keyok = keyok && !ResultCache::G()->Lookup(fakekey,{&kget});
+  kgen.InsEvent("omega");
+  keyok = keyok && (ResultCache::Key("Deterministic",{&kgen}).substr(0,16)!=key.substr(0,16));
+  keyok = keyok && (ResultCache::Key("Deterministic",{&kgen}).substr(16,16)!=key.substr(16,16));
+  ResultCache::G()->Directory("");
+  FileDelete(key+".rcache");
+  FileDelete(fakekey+".rcache");
+
+  // report to console
+  std::cout << "################################\n";
+  std::cout << "# tutorial, rti result cache keys \n";
+  if(keyok)
+    std::cout << " entries are verified by their full key: ok [expected]\n";
+  else
+    std::cout << " entries are verified by their full key: failed\n";
+  std::cout << "################################\n";
+
+  // record test case
+  FAUDES_TEST_DUMP("rti cache keys",keyok);
+
+  // disable cache for below demos
+  ResultCache::G()->Enabled(false);
+  ResultCache::G()->Clear();
+
+  // record test case
+  FAUDES_TEST_DUMP("rti cache hits",(long int) cachehits);
+  FAUDES_TEST_DUMP("rti cache ok",cacheok);
+
   // clear registry for below demos
   ClearRegistry();
 